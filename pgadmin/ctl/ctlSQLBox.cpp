@@ -18,6 +18,7 @@
 
 // App headers
 #include "db/pgSet.h"
+#include "db/pgCatalogCache.h"
 #include "ctl/ctlSQLBox.h"
 #include "dlg/dlgFindReplace.h"
 #include "frm/menu.h"
@@ -46,6 +47,7 @@ BEGIN_EVENT_TABLE(ctlSQLBox, wxStyledTextCtrl)
 	EVT_STC_UPDATEUI(-1, ctlSQLBox::OnPositionStc)
 #endif
 	EVT_STC_MARGINCLICK(-1, ctlSQLBox::OnMarginClick)
+	EVT_STC_MODIFIED(-1, ctlSQLBox::OnModified)
 	EVT_END_PROCESS(-1,  ctlSQLBox::OnEndProcess)
 END_EVENT_TABLE()
 
@@ -56,6 +58,8 @@ IMPLEMENT_DYNAMIC_CLASS(ctlSQLBox, wxStyledTextCtrl)
 ctlSQLBox::ctlSQLBox()
 {
 	m_dlgFindReplace = 0;
+	m_database = NULL;
+	m_catalog = NULL;
 	m_autoIndent = false;
 	m_autocompDisabled = false;
 	process = 0;
@@ -68,6 +72,7 @@ ctlSQLBox::ctlSQLBox(wxWindow *parent, wxWindowID id, const wxPoint &pos, const
 	m_dlgFindReplace = 0;
 
 	m_database = NULL;
+	m_catalog = NULL;
 
 	m_autocompDisabled = false;
 	process = 0;
@@ -181,7 +186,14 @@ void ctlSQLBox::Create(wxWindow *parent, wxWindowID id, const wxPoint &pos, cons
 
 void ctlSQLBox::SetDatabase(pgConn *db)
 {
+	// Attach before detaching, so a cache used by this box alone isn't
+	// dropped when the box is merely attached again
+	pgCatalogCache *catalog = pgCatalogCache::Attach(db);
+	if (m_catalog)
+		m_catalog->Detach();
+
 	m_database = db;
+	m_catalog = catalog;
 }
 
 void ctlSQLBox::SetChanged(bool b)
@@ -794,8 +806,15 @@ void ctlSQLBox::OnPositionStc(wxStyledTextEvent &event)
 			BraceHighlight(pos, match);
 	}
 
-	// Roll back through the doc and highlight any unmatched braces
-	while ((pos--) >= 0)
+	// Roll back through the statement and highlight any unmatched braces;
+	// those of the statements before don't bear on it
+	int first = 0;
+	const sqlStatementIndex &statements = GetStatements();
+	int index = statements.FindStatement(pos);
+	if (index >= 0)
+		first = statements.Item(index).start;
+
+	while ((pos--) > first)
 	{
 		ch = GetCharAt(pos);
 		st = GetStyleAt(pos);
@@ -827,6 +846,58 @@ void ctlSQLBox::OnMarginClick(wxStyledTextEvent &event)
 }
 
 
+void ctlSQLBox::OnModified(wxStyledTextEvent &event)
+{
+	int type = event.GetModificationType();
+	if (type & wxSTC_MOD_INSERTTEXT)
+		m_statements.Changed(event.GetPosition(), event.GetLength());
+	else if (type & wxSTC_MOD_DELETETEXT)
+		m_statements.Changed(event.GetPosition(), -event.GetLength());
+
+	event.Skip();
+}
+
+
+const sqlStatementIndex &ctlSQLBox::GetStatements()
+{
+	m_statements.Update(this);
+	return m_statements;
+}
+
+
+bool ctlSQLBox::GetStatementRange(int pos, int &start, int &end)
+{
+	const sqlStatementIndex &statements = GetStatements();
+	int index = statements.FindStatement(pos);
+	if (index < 0)
+		return false;
+
+	// In the white space after a statement, on the line it ended, the
+	// statement meant is that one; on the lines after it, the next one,
+	// unless there is none
+	const sqlStatementInfo *info = &statements.Item(index);
+	if (index > 0 && (info->contentStart < 0 || pos < info->contentStart))
+	{
+		if (info->contentStart < 0 || LineFromPosition(info->start - 1) == LineFromPosition(pos))
+			info = &statements.Item(--index);
+	}
+	if (info->contentStart < 0)
+		return false;
+
+	start = info->contentStart;
+	end = statements.GetEnd(index);
+	while (end > start)
+	{
+		int c = GetCharAt(end - 1);
+		if (c != ' ' && c != '\t' && c != '\r' && c != '\n')
+			break;
+		end--;
+	}
+
+	return true;
+}
+
+
 extern "C" char *tab_complete(const char *allstr, const int startptr, const int endptr, void *dbptr);
 void ctlSQLBox::OnAutoComplete(wxCommandEvent &rev)
 {
@@ -842,9 +913,9 @@ void ctlSQLBox::OnAutoComplete(wxCommandEvent &rev)
 
 	char *tab_ret;
 	if (spaceidx == -1)
-		tab_ret = tab_complete(what.mb_str(wxConvUTF8), 0, what.Len() + 1, m_database);
+		tab_ret = tab_complete(what.mb_str(wxConvUTF8), 0, what.Len() + 1, this);
 	else
-		tab_ret = tab_complete(what.mb_str(wxConvUTF8), spaceidx + 1, what.Len() + 1, m_database);
+		tab_ret = tab_complete(what.mb_str(wxConvUTF8), spaceidx + 1, what.Len() + 1, this);
 
 	if (tab_ret == NULL || tab_ret[0] == '\0')
 		return; /* No autocomplete available for this string */
@@ -878,6 +949,155 @@ ctlSQLBox::~ctlSQLBox()
 		m_dlgFindReplace = 0;
 	}
 	AbortProcess();
+
+	if (m_catalog)
+	{
+		m_catalog->Detach();
+		m_catalog = NULL;
+	}
+}
+
+
+/*
+ * Turn completions into the tab separated string tab-complete.c expects,
+ * with a space after each full name.
+ */
+static char *CompletionString(wxArrayString &items, bool sort)
+{
+	if (sort)
+		items.Sort();
+
+	wxString ret;
+	size_t i;
+	for (i = 0 ; i < items.GetCount() ; i++)
+	{
+		if (i > 0 && items.Item(i) == items.Item(i - 1))
+			continue;
+
+		if (items.Item(i).Last() == '.')
+			ret += items.Item(i) + wxT("\t");
+		else
+			ret += items.Item(i) + wxT(" \t");
+	}
+
+	ret.Trim();
+	// Trims both space and tab, but we want to keep the space!
+	if (ret.Length() > 0)
+		ret += wxT(" ");
+
+	return strdup(ret.mb_str(wxConvUTF8));
+}
+
+
+/*
+ * The words quoted in the addon of a tab-complete.c query, such as
+ * " UNION SELECT 'ALL'", which are offered whatever the text.
+ */
+static void AddonWords(const char *addon, wxArrayString &items)
+{
+	if (!addon)
+		return;
+
+	wxString str(addon, wxConvUTF8);
+	int start;
+	while ((start = str.Find('\'')) >= 0)
+	{
+		str = str.Mid(start + 1);
+		int end = str.Find('\'');
+		if (end < 0)
+			break;
+		items.Add(str.Left(end));
+		str = str.Mid(end + 1);
+	}
+}
+
+
+/*
+ * Callbacks from tab-complete.c, answering its schema queries and its
+ * queries for schemas and columns from the catalog cache of the SQL box.
+ * They return 0 if the cache can't answer (yet), and the query is to be
+ * sent to the server instead.
+ */
+extern "C"
+int pg_complete_from_catalog(const char *text, const char *kinds, int systemNames, const char *addon, void *dbptr, char **result)
+{
+	ctlSQLBox *box = (ctlSQLBox *)dbptr;
+	pgCatalogCache *catalog = box->GetCatalog();
+	if (!catalog || !catalog->IsReady(box->GetDatabase()))
+		return 0;
+
+	wxArrayString items;
+	catalog->Complete(text, kinds, systemNames != 0, items);
+	AddonWords(addon, items);
+
+	*result = CompletionString(items, true);
+	return 1;
+}
+
+
+extern "C"
+int pg_complete_schemas(const char *text, void *dbptr, char **result)
+{
+	ctlSQLBox *box = (ctlSQLBox *)dbptr;
+	pgCatalogCache *catalog = box->GetCatalog();
+	if (!catalog || !catalog->IsReady(box->GetDatabase()))
+		return 0;
+
+	wxArrayString items;
+	catalog->CompleteSchemas(text, items);
+
+	*result = CompletionString(items, true);
+	return 1;
+}
+
+
+extern "C"
+int pg_complete_columns(const char *text, const char *relation, void *dbptr, char **result)
+{
+	ctlSQLBox *box = (ctlSQLBox *)dbptr;
+	pgCatalogCache *catalog = box->GetCatalog();
+	if (!catalog || !catalog->IsReady(box->GetDatabase()))
+		return 0;
+
+	OID oid = catalog->FindRelation(relation);
+	if (!oid)
+		return 0;
+
+	wxArrayString columns;
+	if (!catalog->GetColumns(oid, columns))
+	{
+		pgSet *set = box->GetDatabase()->ExecuteSet(
+		                 wxT("SELECT pg_catalog.quote_ident(attname) FROM pg_catalog.pg_attribute\n")
+		                 wxT(" WHERE attrelid = ") + NumToStr(oid) + wxT(" AND attnum > 0 AND NOT attisdropped"), false);
+		if (!set)
+			return 0;
+
+		bool ok = box->GetDatabase()->GetLastResultStatus() == PGRES_TUPLES_OK;
+		while (!set->Eof())
+		{
+			columns.Add(set->GetVal(0));
+			set->MoveNext();
+		}
+		delete set;
+
+		if (!ok)
+			return 0;
+
+		columns.Sort();
+		catalog->SetColumns(oid, columns);
+	}
+
+	wxString prefix(text, wxConvUTF8);
+	wxArrayString items;
+	size_t i;
+	for (i = 0 ; i < columns.GetCount() ; i++)
+	{
+		if (columns.Item(i).StartsWith(prefix))
+			items.Add(columns.Item(i));
+	}
+
+	*result = CompletionString(items, false);
+	return 1;
 }
 
 
@@ -891,7 +1111,7 @@ ctlSQLBox::~ctlSQLBox()
 extern "C"
 char *pg_query_to_single_ordered_string(char *query, void *dbptr)
 {
-	pgConn *db = (pgConn *)dbptr;
+	pgConn *db = ((ctlSQLBox *)dbptr)->GetDatabase();
 	pgSet *res = db->ExecuteSet(wxString(query, wxConvUTF8) + wxT(" ORDER BY 1"));
 	if (!res)
 		return NULL;
@@ -472,18 +472,42 @@ void ctlSQLGrid::AutoSizeColumn(int col, bool setAsMin, bool doLimit)
 	}
 }
 
+// Width of the widest of the first rows of each column, for those with a
+// width of 0 (the others have been sized by the user)
+void ctlSQLGrid::MeasureColumns(int rows, wxArrayInt &widths)
+{
+	int col, row;
+	for (col = 0 ; col < (int)widths.GetCount() ; col++)
+	{
+		if (widths[col] < 0)
+			continue;
+
+		for (row = 0 ; row < rows ; row++)
+		{
+			wxSize size = GetBestSize(row, col);
+			if (size.x > widths[col])
+				widths[col] = size.x;
+		}
+	}
+}
+
 void ctlSQLGrid::AutoSizeColumns(bool setAsMin)
 {
-	wxCoord newSize, oldSize;
-	wxCoord maxSize, totalSize = 0, availSize;
+	wxCoord newSize;
 	int col, nCols = GetNumberCols();
-	int row, nRows = GetNumberRows();
+	int nRows = GetNumberRows();
 	colMaxSizes.Empty();
 
 	/* We need to check each cell's width to choose best. wxGrid::AutoSizeColumns()
 	 * is good, but looping through long result sets gives a noticeable slowdown.
 	 * Thus we'll check every first 500 cells for each column.
 	 */
+	wxArrayInt widths;
+	for (col = 0 ; col < nCols ; col++)
+		widths.Add(colSizes.find(GetColKeyValue(col)) != colSizes.end() ? -1 : 0);
+	MeasureColumns(wxMin(nRows, CTLSQLGRID_SIZE_ROWS), widths);
+
+	wxClientDC dc(GetGridWindow());
 
 	// First pass: auto-size columns
 	for (col = 0 ; col < nCols; col++)
@@ -496,15 +520,8 @@ void ctlSQLGrid::AutoSizeColumns(bool setAsMin)
 		}
 		else
 		{
-			wxClientDC dc(GetGridWindow());
-			newSize = 0;
 			// get cells's width
-			for (row = 0 ; row < wxMin(nRows, 500) ; row++)
-			{
-				wxSize size = GetBestSize(row, col);
-				if ( size.x > newSize )
-					newSize = size.x;
-			}
+			newSize = widths[col];
 			// get column's label width
 			wxCoord w, h;
 			dc.SetFont( GetLabelFont() );
@@ -524,12 +541,49 @@ void ctlSQLGrid::AutoSizeColumns(bool setAsMin)
 			colMaxSizes.Add(newSize);
 		}
 		SetColSize(col, newSize);
-		totalSize += newSize;
 	}
 
+	// Second pass: shrink wide columns if exceeded available width
+	ShrinkWideColumns();
+}
+
+// Widen the automatically sized columns to the widths of cells measured
+// later on
+void ctlSQLGrid::WidenColumns(const wxArrayInt &widths)
+{
+	int col, nCols = wxMin(GetNumberCols(), (int)colMaxSizes.GetCount());
+	bool widened = false;
+
+	for (col = 0 ; col < nCols && col < (int)widths.GetCount() ; col++)
+	{
+		if (colMaxSizes[col] < 0 || colSizes.find(GetColKeyValue(col)) != colSizes.end())
+			continue;
+
+		// leave some space around text
+		int newSize = widths[col] + 6;
+		if (newSize > colMaxSizes[col])
+		{
+			colMaxSizes[col] = newSize;
+			SetColSize(col, newSize);
+			widened = true;
+		}
+	}
+
+	if (widened)
+		ShrinkWideColumns();
+}
+
+void ctlSQLGrid::ShrinkWideColumns()
+{
+	wxCoord newSize, oldSize;
+	wxCoord maxSize, totalSize = 0, availSize;
+	int col, nCols = GetNumberCols();
+
+	for (col = 0 ; col < nCols ; col++)
+		totalSize += GetColSize(col);
+
 	availSize = GetClientSize().GetWidth() - GetRowLabelSize();
 
-	// Second pass: shrink wide columns if exceeded available width
 	if (totalSize > availSize)
 	{
 		// A wide column shouldn't take up more than 50% of the visible space
@@ -538,7 +592,8 @@ void ctlSQLGrid::AutoSizeColumns(bool setAsMin)
 		{
 			oldSize = GetColSize(col);
 			// Is too wide and no user-specified size
-			if (oldSize > maxSize && !(col < (int)colMaxSizes.GetCount() && colMaxSizes[col] == -1))
+			if (oldSize > maxSize && !(col < (int)colMaxSizes.GetCount() && colMaxSizes[col] == -1) &&
+			        colSizes.find(GetColKeyValue(col)) == colSizes.end())
 			{
 				totalSize -= oldSize;
 				/* Shrink wide column to maxSize.
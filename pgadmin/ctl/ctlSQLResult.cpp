@@ -14,12 +14,20 @@
 // wxWindows headers
 #include <wx/wx.h>
 #include <wx/clipbrd.h>
+#include <wx/progdlg.h>
 
 #include "db/pgConn.h"
 #include "db/pgQueryThread.h"
+#include "db/pgQueryResultEvent.h"
 #include "ctl/ctlSQLResult.h"
+#include "ctl/sqlResultSort.h"
+#include "ctl/sqlResultFilter.h"
+#include "ctl/sqlResultCopy.h"
+#include "ctl/sqlResultWidths.h"
 #include "utils/sysSettings.h"
+#include "utils/pgDefs.h"
 #include "frm/frmExport.h"
+#include "frm/menu.h"
 
 
 
@@ -28,6 +36,12 @@ ctlSQLResult::ctlSQLResult(wxWindow *parent, pgConn *_conn, wxWindowID id, const
 {
 	conn = _conn;
 	thread = NULL;
+	streamedSet = NULL;
+	sortMenuCol = -1;
+	filter = NULL;
+	filterSeq = 0;
+	widthThread = NULL;
+	widthSeq = 0;
 
 	SetTable(new sqlResultTable(), true);
 
@@ -35,6 +49,10 @@ ctlSQLResult::ctlSQLResult(wxWindow *parent, pgConn *_conn, wxWindowID id, const
 	SetSizer(new wxBoxSizer(wxVERTICAL));
 
 	Connect(wxID_ANY, wxEVT_GRID_RANGE_SELECT, wxGridRangeSelectEventHandler(ctlSQLResult::OnGridSelect));
+	Connect(wxID_ANY, wxEVT_GRID_LABEL_RIGHT_CLICK, wxGridEventHandler(ctlSQLResult::OnLabelRightClick));
+	Connect(MNU_SORT_ASCENDING, MNU_SORT_NONE, wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(ctlSQLResult::OnSort));
+	Connect(FILTER_COMPLETE, wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(ctlSQLResult::OnFilterComplete));
+	Connect(COLUMN_WIDTHS, wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(ctlSQLResult::OnColumnWidths));
 }
 
 
@@ -65,11 +83,14 @@ void ctlSQLResult::SetConnection(pgConn *_conn)
 
 bool ctlSQLResult::Export()
 {
-	if (NumRows() > 0)
+	if (CanExport())
 	{
 		frmExport dlg(this);
 		if (dlg.ShowModal() == wxID_OK)
-			return dlg.Export(NULL);
+		{
+			sqlResultTable *table = (sqlResultTable *)GetTable();
+			return dlg.Export(thread->DataSet(), table->GetViewRows(), table->GetViewCount());
+		}
 	}
 	return false;
 }
@@ -85,15 +106,6 @@ bool ctlSQLResult::ToFile()
 	return false;
 }
 
-bool ctlSQLResult::ToFile(frmExport *frm)
-{
-	if (NumRows() > 0)
-	{
-		return frm->Export(thread->DataSet());
-	}
-	return false;
-}
-
 bool ctlSQLResult::IsColText(int col)
 {
 	switch (colTypClasses.Item(col))
@@ -107,10 +119,39 @@ bool ctlSQLResult::IsColText(int col)
 }
 
 
-int ctlSQLResult::Execute(const wxString &query, int resultToRetrieve, wxWindow *caller, long eventId, void *data)
+int ctlSQLResult::Execute(const wxString &query, int resultToRetrieve, wxWindow *caller, long eventId, void *data, bool streamRows,
+                          const wxArrayString *statements, const wxArrayInt *offsets)
+{
+	ClearResult();
+
+	thread = new pgQueryThread(conn, query, resultToRetrieve, caller, eventId, data);
+
+	if (streamRows)
+		thread->SetStreaming(CTLSQL_STREAM_BATCH_ROWS, wxLongLong(settings->GetStreamMemoryLimit()) * 1024 * 1024);
+	if (statements && offsets)
+		thread->SetStatements(*statements, *offsets);
+
+	if (thread->Create() != wxTHREAD_NO_ERROR)
+	{
+		Abort();
+		return -1;
+	}
+
+	((sqlResultTable *)GetTable())->SetThread(thread);
+
+	thread->Run();
+	return RunStatus();
+}
+
+
+// Remove the rows and columns of the result shown, and the thread of it
+void ctlSQLResult::ClearResult()
 {
 	wxGridTableMessage *msg;
 	sqlResultTable *table = (sqlResultTable *)GetTable();
+	CancelFilter();
+	table->ClearFilter();
+	table->ClearSort();
 	msg = new wxGridTableMessage(table, wxGRIDTABLE_NOTIFY_ROWS_DELETED, 0, GetNumberRows());
 	ProcessTableMessage(*msg);
 	delete msg;
@@ -123,24 +164,123 @@ int ctlSQLResult::Execute(const wxString &query, int resultToRetrieve, wxWindow
 	colNames.Empty();
 	colTypes.Empty();
 	colTypClasses.Empty();
+	streamedSet = NULL;
+}
 
-	thread = new pgQueryThread(conn, query, resultToRetrieve, caller, eventId, data);
 
-	if (thread->Create() != wxTHREAD_NO_ERROR)
+#ifdef __WXDEBUG__
+/*
+ * Show a made up result, which needs no query: every third column is an
+ * integer, the others text of varying length. The result is built on the
+ * client, but the column types are looked up on the connection as usual.
+ */
+void ctlSQLResult::DisplayTestData(long rows, int cols)
+{
+	ClearResult();
+
+	PGresult *res = PQmakeEmptyPGresult(NULL, PGRES_TUPLES_OK);
+	PGresAttDesc *attrs = new PGresAttDesc[cols];
+	char *names = new char[cols * 16];
+	char value[64];
+	long row;
+	int col;
+
+	for (col = 0 ; col < cols ; col++)
 	{
-		Abort();
-		return -1;
+		sprintf(names + col * 16, "column%d", col + 1);
+		memset(&attrs[col], 0, sizeof(PGresAttDesc));
+		attrs[col].name = names + col * 16;
+		attrs[col].typid = (col % 3 ? PGOID_TYPE_TEXT : PGOID_TYPE_INT4);
+		attrs[col].typlen = (col % 3 ? -1 : 4);
+		attrs[col].atttypmod = -1;
+	}
+	PQsetResultAttrs(res, cols, attrs);
+	delete[] attrs;
+	delete[] names;
+
+	for (row = 0 ; row < rows ; row++)
+	{
+		for (col = 0 ; col < cols ; col++)
+		{
+			if (col % 3)
+				sprintf(value, "value %ld of column %d%.*s", row + 1, col + 1,
+				        (int)((row + col) % 24), "........................");
+			else
+				sprintf(value, "%ld", (row + 1) * (col + 1) * 997);
+			PQsetvalue(res, row, col, value, (int)strlen(value));
+		}
 	}
 
+	thread = new pgQueryThread(conn);
+	thread->SetTestResult(wxT("-- test data"), new pgSet(res, conn, *conn->GetConv(), false));
 	((sqlResultTable *)GetTable())->SetThread(thread);
 
-	thread->Run();
-	return RunStatus();
+	DisplayData();
 }
 
 
+/*
+ * Scroll down the result a page at a time, and then across it a column at
+ * a time, repainting the grid at each step as a user scrolling would; the
+ * milliseconds taken per step are returned.
+ */
+void ctlSQLResult::TimeScrolling(double &msPerPage, double &msPerColumn)
+{
+	int rows = GetNumberRows(), cols = GetNumberCols();
+	int pageRows = wxMax(1, GetGridWindow()->GetClientSize().y / GetDefaultRowSize());
+	int row, col, steps;
+
+	msPerPage = msPerColumn = 0;
+	if (!rows || !cols)
+		return;
+
+	wxStopWatch watch;
+	for (row = 0, steps = 0 ; row < rows ; row += pageRows, steps++)
+	{
+		MakeCellVisible(row, 0);
+		GetGridWindow()->Update();
+	}
+	msPerPage = (double)watch.Time() / steps;
+
+	watch.Start();
+	for (col = 0 ; col < cols ; col++)
+	{
+		MakeCellVisible(rows - 1, col);
+		GetGridWindow()->Update();
+	}
+	msPerColumn = (double)watch.Time() / cols;
+}
+
+
+/*
+ * Time sizing the columns as a result is shown, and measuring the same
+ * cells with the device context instead, as ctlSQLGrid does; the columns
+ * are left as sized first.
+ */
+void ctlSQLResult::TimeColumnWidths(long &msSized, long &msMeasured)
+{
+	int col, nCols = GetNumberCols();
+	wxArrayInt widths;
+
+	wxStopWatch watch;
+	AutoSizeColumns(false);
+	msSized = watch.Time();
+
+	for (col = 0 ; col < nCols ; col++)
+		widths.Add(0);
+
+	watch.Start();
+	ctlSQLGrid::MeasureColumns(wxMin(GetNumberRows(), CTLSQLGRID_SIZE_ROWS), widths);
+	msMeasured = watch.Time();
+}
+#endif
+
+
 int ctlSQLResult::Abort()
 {
+	CancelFilter();
+	CancelColumnWidths();
+
 	if (thread)
 	{
 		((sqlResultTable *)GetTable())->SetThread(0);
@@ -154,22 +294,62 @@ int ctlSQLResult::Abort()
 		delete thread;
 		thread = NULL;
 	}
+	streamedSet = NULL;
 	return 0;
 }
 
 
-
-void ctlSQLResult::DisplayData(bool single)
+/*
+ * Show the rows of a result, which is still being received. The first batch
+ * of a result set sets up the columns, later ones just extend the grid.
+ */
+long ctlSQLResult::AppendRows(pgQueryResultEvent &ev)
 {
-	if (!thread || !thread->DataValid())
-		return;
+	if (!thread)
+	{
+		PGresult *rows = (PGresult *)ev.GetClientData();
+		if (rows)
+			PQclear(rows);
+		return 0;
+	}
 
-	if (thread->ReturnCode() != PGRES_TUPLES_OK)
-		return;
+	bool newSet;
+	long oldRows = GetNumberRows();
+	pgSet *set = thread->AppendStreamedRows(ev, newSet);
 
-	rowcountSuppressed = single;
-	Freeze();
+	if (newSet)
+	{
+		rowcountSuppressed = false;
+		streamedSet = set;
+
+		Freeze();
+		colNames.Empty();
+		colTypes.Empty();
+		colTypClasses.Empty();
 
+		if (set)
+		{
+			((sqlResultTable *)GetTable())->TakeFormatSnapshot();
+			ResizeGrid(set->NumRows(), set->NumCols());
+			AutoSizeColumns(false);
+			SetColumns(set);
+		}
+		else
+			ResizeGrid(0, 0);
+		Thaw();
+	}
+	else if (set && set->NumRows() > oldRows)
+	{
+		wxGridTableMessage msg(GetTable(), wxGRIDTABLE_NOTIFY_ROWS_APPENDED, set->NumRows() - oldRows);
+		ProcessTableMessage(msg);
+	}
+
+	return set ? set->NumRows() : 0;
+}
+
+
+void ctlSQLResult::ResizeGrid(long rows, long cols)
+{
 	/*
 	 * Resize and repopulate by informing it to delete all the rows and
 	 * columns, then append the correct number of them. Probably is a
@@ -183,12 +363,72 @@ void ctlSQLResult::DisplayData(bool single)
 	msg = new wxGridTableMessage(table, wxGRIDTABLE_NOTIFY_COLS_DELETED, 0, GetNumberCols());
 	ProcessTableMessage(*msg);
 	delete msg;
-	msg = new wxGridTableMessage(table, wxGRIDTABLE_NOTIFY_ROWS_APPENDED, NumRows());
+	msg = new wxGridTableMessage(table, wxGRIDTABLE_NOTIFY_ROWS_APPENDED, rows);
 	ProcessTableMessage(*msg);
 	delete msg;
-	msg = new wxGridTableMessage(table, wxGRIDTABLE_NOTIFY_COLS_APPENDED, thread->DataSet()->NumCols());
+	msg = new wxGridTableMessage(table, wxGRIDTABLE_NOTIFY_COLS_APPENDED, cols);
 	ProcessTableMessage(*msg);
 	delete msg;
+}
+
+
+void ctlSQLResult::SetColumns(pgSet *set)
+{
+	long col, nCols = set->NumCols();
+
+	for (col = 0 ; col < nCols ; col++)
+	{
+		colNames.Add(set->ColName(col));
+		colTypes.Add(set->ColFullType(col));
+		colTypClasses.Add(set->ColTypClass(col));
+
+		if (set->ColTypClass(col) == PGTYPCLASS_NUMERIC)
+		{
+			/*
+			 * For numeric columns, set alignment to right.
+			 */
+			wxGridCellAttr *attr = new wxGridCellAttr();
+			attr->SetAlignment(wxALIGN_RIGHT, wxALIGN_TOP);
+			SetColAttr(col, attr);
+		}
+	}
+}
+
+
+
+void ctlSQLResult::DisplayData(bool single)
+{
+	if (!thread || !thread->DataValid())
+		return;
+
+	if (thread->ReturnCode() != PGRES_TUPLES_OK)
+		return;
+
+	/*
+	 * The rows have been shown while they were streamed in already; the
+	 * column types could not be looked up while the query was running,
+	 * so these are refreshed only.
+	 */
+	if (!single && streamedSet && streamedSet == thread->DataSet() &&
+	        GetNumberRows() == NumRows())
+	{
+		Freeze();
+		colNames.Empty();
+		colTypes.Empty();
+		colTypClasses.Empty();
+		SetColumns(streamedSet);
+		((sqlResultTable *)GetTable())->TakeFormatSnapshot();
+		ForceRefresh();
+		Thaw();
+		StartColumnWidths();
+		return;
+	}
+
+	rowcountSuppressed = single;
+	Freeze();
+
+	((sqlResultTable *)GetTable())->TakeFormatSnapshot();
+	ResizeGrid(NumRows(), thread->DataSet()->NumCols());
 
 	if (single)
 	{
@@ -200,28 +440,92 @@ void ctlSQLResult::DisplayData(bool single)
 	}
 	else
 	{
-		long col, nCols = thread->DataSet()->NumCols();
-
+		SetColumns(thread->DataSet());
 		AutoSizeColumns(false);
+	}
+	Thaw();
 
-		for (col = 0 ; col < nCols ; col++)
-		{
-			colNames.Add(thread->DataSet()->ColName(col));
-			colTypes.Add(thread->DataSet()->ColFullType(col));
-			colTypClasses.Add(thread->DataSet()->ColTypClass(col));
+	if (!single)
+		StartColumnWidths();
+}
 
-			if (thread->DataSet()->ColTypClass(col) == PGTYPCLASS_NUMERIC)
-			{
-				/*
-				 * For numeric columns, set alignment to right.
-				 */
-				wxGridCellAttr *attr = new wxGridCellAttr();
-				attr->SetAlignment(wxALIGN_RIGHT, wxALIGN_TOP);
-				SetColAttr(col, attr);
-			}
-		}
+
+// Estimated from the raw values, rather than measured cell by cell
+void ctlSQLResult::MeasureColumns(int rows, wxArrayInt &widths)
+{
+	if (!thread || !thread->DataValid())
+	{
+		ctlSQLGrid::MeasureColumns(rows, widths);
+		return;
+	}
+
+	sqlResultWidths estimate(thread->DataSet(), sqlResultGlyphWidths::Get(GetGridWindow(), GetDefaultCellFont()), colTypClasses);
+
+	int col;
+	for (col = 0 ; col < (int)widths.GetCount() ; col++)
+	{
+		if (widths[col] >= 0)
+			widths[col] = estimate.ColumnWidth(col, 0, rows);
+	}
+}
+
+
+// The columns are sized by the first rows at once, and widened while the
+// rows after those are measured by another thread
+void ctlSQLResult::StartColumnWidths()
+{
+	CancelColumnWidths();
+
+	if (!thread || !thread->DataValid() || RunStatus() == CTLSQL_RUNNING)
+		return;
+
+	pgSet *set = thread->DataSet();
+	long nRows = wxMin(set->NumRows(), SQLRESULT_WIDTH_MAX_ROWS);
+	if (nRows <= CTLSQLGRID_SIZE_ROWS)
+		return;
+
+	sqlResultWidths estimate(set, sqlResultGlyphWidths::Get(GetGridWindow(), GetDefaultCellFont()), colTypClasses);
+	widthThread = new sqlResultWidthThread(estimate, set->NumCols(), CTLSQLGRID_SIZE_ROWS, nRows,
+	                                       this, COLUMN_WIDTHS, ++widthSeq);
+	if (widthThread->Create() != wxTHREAD_NO_ERROR || widthThread->Run() != wxTHREAD_NO_ERROR)
+	{
+		delete widthThread;
+		widthThread = NULL;
+	}
+}
+
+
+void ctlSQLResult::CancelColumnWidths()
+{
+	if (widthThread)
+	{
+		widthThread->Cancel();
+		widthThread->Wait();
+		delete widthThread;
+		widthThread = NULL;
+	}
+}
+
+
+void ctlSQLResult::OnColumnWidths(wxCommandEvent &event)
+{
+	// The event of a thread cancelled meanwhile
+	if (!widthThread || event.GetInt() != widthSeq)
+		return;
+
+	wxArrayInt widths;
+	widthThread->GetWidths(widths);
+
+	BeginBatch();
+	WidenColumns(widths);
+	EndBatch();
+
+	if (event.GetExtraLong())
+	{
+		widthThread->Wait();
+		delete widthThread;
+		widthThread = NULL;
 	}
-	Thaw();
 }
 
 
@@ -249,6 +553,14 @@ pgError ctlSQLResult::GetResultError()
 	return dummy;
 }
 
+const pgStatementTimingArray *ctlSQLResult::GetStatementTimings() const
+{
+	if (thread && !thread->IsRunning())
+		return &thread->GetStatementTimings();
+	return NULL;
+}
+
+
 long ctlSQLResult::NumRows() const
 {
 	if (thread && thread->DataValid())
@@ -298,7 +610,7 @@ wxString ctlSQLResult::OnGetItemText(long item, long col) const
 		}
 		if (item >= 0)
 		{
-			thread->DataSet()->Locate(item + 1);
+			thread->DataSet()->Locate(((sqlResultTable *)GetTable())->DataRow(item) + 1);
 			return thread->DataSet()->GetVal(col);
 		}
 		else
@@ -312,53 +624,274 @@ void ctlSQLResult::OnGridSelect(wxGridRangeSelectEvent &event)
 	SetFocus();
 }
 
+
+// The rows fetched can be sorted by a column without running the query
+// again; this is offered once the query is complete.
+void ctlSQLResult::OnLabelRightClick(wxGridEvent &event)
+{
+	int col = event.GetCol();
+	if (col < 0 || !CanExport())
+	{
+		event.Skip();
+		return;
+	}
+
+	sortMenuCol = col;
+	int sortCol = ((sqlResultTable *)GetTable())->GetSortColumn();
+
+	wxMenu menu;
+	menu.Append(MNU_SORT_ASCENDING, _("Sort &ascending"), _("Sort the rows by this column."));
+	menu.Append(MNU_SORT_DESCENDING, _("Sort &descending"), _("Sort the rows by this column, in descending order."));
+	menu.Append(MNU_SORT_NONE, _("&Original order"), _("Show the rows in the order of the query result."));
+	menu.Enable(MNU_SORT_NONE, sortCol >= 0);
+
+	PopupMenu(&menu, event.GetPosition());
+}
+
+
+void ctlSQLResult::OnSort(wxCommandEvent &event)
+{
+	sqlResultTable *table = (sqlResultTable *)GetTable();
+
+	if (sortMenuCol < 0 || sortMenuCol >= GetNumberCols())
+		return;
+
+	wxBusyCursor wait;
+	BeginBatch();
+
+	if (event.GetId() == MNU_SORT_NONE)
+		table->ClearSort();
+	else
+		table->SortRows(sortMenuCol, event.GetId() == MNU_SORT_ASCENDING);
+
+	EndBatch();
+	ForceRefresh();
+}
+
+
+// The label may carry the sort marker
+wxString ctlSQLResult::GetColumnName(int colNum)
+{
+	if (thread && thread->DataValid())
+		return thread->DataSet()->ColName(colNum);
+	return ctlSQLGrid::GetColumnName(colNum);
+}
+
+
+// The raw values of the set are copied by another thread, rather than the
+// text of the cells; large selections show the progress meanwhile, and the
+// clipboard is only filled once all is done.
+int ctlSQLResult::Copy()
+{
+	if (!CanExport())
+		return ctlSQLGrid::Copy();
+	if (GetNumberRows() == 0 || GetNumberCols() == 0)
+		return 0;
+
+	sqlResultTable *table = (sqlResultTable *)GetTable();
+	sqlResultCopy *copy = new sqlResultCopy(thread->DataSet(), table->GetViewRows());
+	wxArrayInt cols;
+	int col;
+
+	if (GetSelectedRows().GetCount())
+	{
+		for (col = 0 ; col < GetNumberCols() ; col++)
+			cols.Add(col);
+		copy->SetRows(GetSelectedRows());
+	}
+	else if (GetSelectedCols().GetCount())
+	{
+		cols = GetSelectedCols();
+		copy->SetRows(0, GetNumberRows() - 1);
+	}
+	else if (GetSelectionBlockTopLeft().GetCount() > 0 &&
+	         GetSelectionBlockBottomRight().GetCount() > 0)
+	{
+		int x1 = GetSelectionBlockTopLeft()[0].GetCol();
+		int x2 = GetSelectionBlockBottomRight()[0].GetCol();
+		for (col = x1 ; col <= x2 ; col++)
+			cols.Add(col);
+		copy->SetRows(GetSelectionBlockTopLeft()[0].GetRow(), GetSelectionBlockBottomRight()[0].GetRow());
+	}
+	else
+	{
+		cols.Add(GetGridCursorCol());
+		copy->SetRows(GetGridCursorRow(), GetGridCursorRow());
+	}
+
+	wxArrayInt quoteCols;
+	size_t i;
+	for (i = 0 ; i < cols.GetCount() ; i++)
+	{
+		bool quote = settings->GetCopyQuoting() == 2 ||
+		             (settings->GetCopyQuoting() == 1 && IsColText(cols.Item(i)));
+		quoteCols.Add(quote ? 1 : 0);
+	}
+
+	wxString header;
+	AppendColumnHeader(header, cols);
+
+	copy->SetColumns(cols, quoteCols);
+	copy->SetFormat(header, settings->GetCopyColSeparator(), settings->GetCopyQuoteChar(), END_OF_LINE);
+
+	if (copy->Create() != wxTHREAD_NO_ERROR || copy->Run() != wxTHREAD_NO_ERROR)
+	{
+		delete copy;
+		return 0;
+	}
+
+	long rows, total;
+	wxStopWatch stopwatch;
+	wxProgressDialog *progress = NULL;
+
+	while (copy->IsRunning())
+	{
+		wxMilliSleep(SQLRESULT_COPY_PROGRESS_INTERVAL);
+
+		if (stopwatch.Time() < SQLRESULT_COPY_PROGRESS_DELAY)
+			continue;
+
+		copy->GetProgress(rows, total);
+		wxString msg = wxString::Format(_("%ld of %ld rows copied"), rows, total);
+
+		if (!progress)
+			progress = new wxProgressDialog(_("Copy"), msg, total, this,
+			                                wxPD_APP_MODAL | wxPD_CAN_ABORT | wxPD_AUTO_HIDE | wxPD_ELAPSED_TIME | wxPD_REMAINING_TIME);
+
+		// Reaching the maximum would close the dialog before the thread
+		if (!progress->Update(wxMin(rows, total - 1), msg))
+			copy->Cancel();
+	}
+	copy->Wait();
+
+	if (progress)
+		delete progress;
+
+	int copied = 0;
+	if (!copy->Cancelled() && wxTheClipboard->Open())
+	{
+		wxTheClipboard->SetData(new wxTextDataObject(copy->GetText()));
+		wxTheClipboard->Close();
+		copied = copy->GetRowCount();
+	}
+	delete copy;
+
+	return copied;
+}
+
+
+void ctlSQLResult::SetFilter(const wxString &text)
+{
+	sqlResultTable *table = (sqlResultTable *)GetTable();
+
+	CancelFilter();
+
+	if (text.Strip(wxString::both).IsEmpty())
+	{
+		if (table->IsFiltered())
+		{
+			table->ClearFilter();
+			UpdateRows();
+		}
+		return;
+	}
+
+	if (!CanExport())
+		return;
+
+	// The set is scanned by another thread, so typing on isn't held up by
+	// large results; a filter outdated by the next key is cancelled.
+	filter = new sqlResultFilter(thread->DataSet(), this, FILTER_COMPLETE, ++filterSeq);
+	filter->Parse(text);
+	if (filter->Create() != wxTHREAD_NO_ERROR || filter->Run() != wxTHREAD_NO_ERROR)
+	{
+		delete filter;
+		filter = NULL;
+	}
+}
+
+
+void ctlSQLResult::CancelFilter()
+{
+	if (filter)
+	{
+		filter->Cancel();
+		filter->Wait();
+		delete filter;
+		filter = NULL;
+	}
+}
+
+
+bool ctlSQLResult::IsFiltered()
+{
+	return ((sqlResultTable *)GetTable())->IsFiltered();
+}
+
+
+// Passed on to the parent when a filter was applied
+void ctlSQLResult::OnFilterComplete(wxCommandEvent &event)
+{
+	// The event of a filter cancelled meanwhile
+	if (!filter || event.GetInt() != filterSeq)
+		return;
+
+	filter->Wait();
+	if (!filter->Cancelled())
+	{
+		((sqlResultTable *)GetTable())->SetFilter(filter->TakeMatches());
+		UpdateRows();
+	}
+	delete filter;
+	filter = NULL;
+
+	event.Skip();
+}
+
+
+// Tell the grid about the rows the table shows now
+void ctlSQLResult::UpdateRows()
+{
+	int oldRows = GetNumberRows(), newRows = GetTable()->GetNumberRows();
+
+	BeginBatch();
+	ClearSelection();
+	if (newRows < oldRows)
+	{
+		wxGridTableMessage msg(GetTable(), wxGRIDTABLE_NOTIFY_ROWS_DELETED, newRows, oldRows - newRows);
+		ProcessTableMessage(msg);
+	}
+	else if (newRows > oldRows)
+	{
+		wxGridTableMessage msg(GetTable(), wxGRIDTABLE_NOTIFY_ROWS_APPENDED, newRows - oldRows);
+		ProcessTableMessage(msg);
+	}
+	EndBatch();
+	ForceRefresh();
+}
+
 wxString sqlResultTable::GetValue(int row, int col)
 {
 	if (thread && thread->DataValid())
 	{
 		if (col >= 0)
 		{
-			thread->DataSet()->Locate(row + 1);
-			if (settings->GetIndicateNull() && thread->DataSet()->IsNull(col))
-				return wxT("<NULL>");
-			else
-			{
+			pgSet *set = thread->DataSet();
+			long dataRow = DataRow(row);
+			wxLongLong_t key = (wxLongLong_t)dataRow * set->NumCols() + col;
 
-				wxString decimalMark = wxT(".");
-				wxString s = thread->DataSet()->GetVal(col);
-
-				if(thread->DataSet()->ColTypClass(col) == PGTYPCLASS_NUMERIC &&
-				        settings->GetDecimalMark().Length() > 0)
-				{
-					decimalMark = settings->GetDecimalMark();
-					s.Replace(wxT("."), decimalMark);
-
-				}
-				if (thread->DataSet()->ColTypClass(col) == PGTYPCLASS_NUMERIC &&
-				        settings->GetThousandsSeparator().Length() > 0)
-				{
-					/* Add thousands separator */
-					size_t pos = s.find(decimalMark);
-					if (pos == wxString::npos)
-						pos = s.length();
-					while (pos > 3)
-					{
-						pos -= 3;
-						if (pos > 1 || !s.StartsWith(wxT("-")))
-							s.insert(pos, settings->GetThousandsSeparator());
-					}
-					return s;
-				}
-				else
-				{
-					wxString data = thread->DataSet()->GetVal(col);
-
-					if (data.Length() > (size_t)settings->GetMaxColSize())
-						return thread->DataSet()->GetVal(col).Left(settings->GetMaxColSize()) + wxT(" (...)");
-					else
-						return thread->DataSet()->GetVal(col);
-				}
-			}
+			wxString value;
+			if (cache.Lookup(key, value))
+				return value;
+
+			if (!formatValid)
+				TakeFormatSnapshot();
+
+			set->Locate(dataRow + 1);
+			value = FormatValue(set, col);
+			cache.Store(key, value);
+
+			return value;
 		}
 		else
 			return thread->DataSet()->ColName(col);
@@ -366,15 +899,197 @@ wxString sqlResultTable::GetValue(int row, int col)
 	return wxEmptyString;
 }
 
+
+wxString sqlResultTable::FormatValue(pgSet *set, int col)
+{
+	if (indicateNull && set->IsNull(col))
+		return wxT("<NULL>");
+
+	wxString s = set->GetVal(col);
+
+	if (col < (int)colTypClasses.GetCount() && colTypClasses.Item(col) == PGTYPCLASS_NUMERIC)
+	{
+		wxString mark = wxT(".");
+		if (!decimalMark.IsEmpty())
+		{
+			s.Replace(wxT("."), decimalMark);
+			mark = decimalMark;
+		}
+		if (!thousandsSeparator.IsEmpty())
+		{
+			/* Add thousands separator */
+			size_t pos = s.find(mark);
+			if (pos == wxString::npos)
+				pos = s.length();
+			while (pos > 3)
+			{
+				pos -= 3;
+				if (pos > 1 || !s.StartsWith(wxT("-")))
+					s.insert(pos, thousandsSeparator);
+			}
+			return s;
+		}
+	}
+
+	if (s.Length() > maxColSize)
+		return s.Left(maxColSize) + wxT(" (...)");
+	return s;
+}
+
+
+/*
+ * The display settings are read from the configuration once per result
+ * instead of for every cell painted, and the rendered cells are cached.
+ */
+void sqlResultTable::TakeFormatSnapshot()
+{
+	indicateNull = settings->GetIndicateNull();
+	decimalMark = settings->GetDecimalMark();
+	thousandsSeparator = settings->GetThousandsSeparator();
+	maxColSize = (size_t)settings->GetMaxColSize();
+
+	colTypClasses.Empty();
+	if (thread && thread->DataValid())
+	{
+		pgSet *set = thread->DataSet();
+		long col, nCols = set->NumCols();
+		for (col = 0 ; col < nCols ; col++)
+			colTypClasses.Add(set->ColTypClass(col));
+	}
+
+	formatValid = true;
+	cache.Clear();
+}
+
+
 sqlResultTable::sqlResultTable()
+	: cache(SQLRESULT_CELL_CACHE_SIZE)
 {
 	thread = NULL;
+	formatValid = false;
+	sortIndex = NULL;
+	sortRows = 0;
+	sortCol = -1;
+	sortAscending = true;
+	filterMatches = NULL;
+	filterRows = NULL;
+	filterCount = 0;
+}
+
+
+sqlResultTable::~sqlResultTable()
+{
+	ClearFilter();
+	ClearSort();
+}
+
+
+void sqlResultTable::SortRows(int col, bool ascending)
+{
+	ClearSort();
+
+	if (!thread || !thread->DataValid())
+		return;
+
+	if (!formatValid)
+		TakeFormatSnapshot();
+
+	pgSet *set = thread->DataSet();
+	int typClass = PGTYPCLASS_STRING;
+	if (col < (int)colTypClasses.GetCount())
+		typClass = colTypClasses.Item(col);
+
+	sortIndex = sqlResultSort::Sort(set, col, typClass, ascending);
+	sortRows = set->NumRows();
+	sortCol = col;
+	sortAscending = ascending;
+
+	BuildFilterRows();
+}
+
+
+void sqlResultTable::ClearSort()
+{
+	if (sortIndex)
+	{
+		delete[] sortIndex;
+		sortIndex = NULL;
+	}
+	sortRows = 0;
+	sortCol = -1;
+
+	BuildFilterRows();
+}
+
+
+void sqlResultTable::SetFilter(char *matches)
+{
+	ClearFilter();
+
+	if (!thread || !thread->DataValid())
+	{
+		delete[] matches;
+		return;
+	}
+
+	filterMatches = matches;
+	BuildFilterRows();
+}
+
+
+void sqlResultTable::ClearFilter()
+{
+	if (filterMatches)
+	{
+		delete[] filterMatches;
+		filterMatches = NULL;
+	}
+	if (filterRows)
+	{
+		delete[] filterRows;
+		filterRows = NULL;
+	}
+	filterCount = 0;
+}
+
+
+// The rows matching, taken in the order of the sort so sorting and
+// filtering can be combined either way round
+void sqlResultTable::BuildFilterRows()
+{
+	if (!filterMatches || !thread || !thread->DataValid())
+		return;
+
+	if (filterRows)
+		delete[] filterRows;
+
+	long row, nRows = thread->DataSet()->NumRows();
+	filterRows = new long[nRows > 0 ? nRows : 1];
+	filterCount = 0;
+
+	for (row = 0 ; row < nRows ; row++)
+	{
+		long dataRow = (sortIndex && row < sortRows) ? sortIndex[row] : row;
+		if (filterMatches[dataRow])
+			filterRows[filterCount++] = dataRow;
+	}
 }
 
+
+long sqlResultTable::GetViewCount()
+{
+	return GetNumberRows();
+}
+
+
 int sqlResultTable::GetNumberRows()
 {
 	if (thread && thread->DataValid())
+	{
+		if (filterMatches)
+			return filterCount;
 		return thread->DataSet()->NumRows();
+	}
 	return 0;
 }
 
@@ -382,8 +1097,15 @@ int sqlResultTable::GetNumberRows()
 wxString sqlResultTable::GetColLabelValue(int col)
 {
 	if (thread && thread->DataValid())
-		return thread->DataSet()->ColName(col) + wxT("\n") +
-		       thread->DataSet()->ColFullType(col);
+	{
+		wxString label = thread->DataSet()->ColName(col);
+
+		// Mark the column the rows are sorted by
+		if (sortIndex && col == sortCol)
+			label += wxString(wxT(" ")) + (wxChar)(sortAscending ? 0x25B2 : 0x25BC);
+
+		return label + wxT("\n") + thread->DataSet()->ColFullType(col);
+	}
 	return wxEmptyString;
 }
 
@@ -394,3 +1116,93 @@ int sqlResultTable::GetNumberCols()
 	return 0;
 }
 
+
+
+sqlResultCellCache::sqlResultCellCache(int _size)
+{
+	size = _size;
+	cells = new sqlResultCell[size];
+	used = 0;
+	first = last = -1;
+}
+
+
+sqlResultCellCache::~sqlResultCellCache()
+{
+	delete[] cells;
+}
+
+
+bool sqlResultCellCache::Lookup(wxLongLong_t key, wxString &value)
+{
+	sqlResultCellIndex::iterator it = index.find(key);
+	if (it == index.end())
+		return false;
+
+	int slot = it->second;
+	if (slot != first)
+	{
+		Unlink(slot);
+		LinkFirst(slot);
+	}
+	value = cells[slot].value;
+	return true;
+}
+
+
+void sqlResultCellCache::Store(wxLongLong_t key, const wxString &value)
+{
+	int slot;
+	if (used < size)
+		slot = used++;
+	else
+	{
+		// Reuse the least recently used cell
+		slot = last;
+		Unlink(slot);
+		index.erase(cells[slot].key);
+	}
+
+	cells[slot].key = key;
+	cells[slot].value = value;
+	LinkFirst(slot);
+	index[key] = slot;
+}
+
+
+void sqlResultCellCache::Clear()
+{
+	int slot;
+	for (slot = 0 ; slot < used ; slot++)
+		cells[slot].value = wxEmptyString;
+
+	index.clear();
+	used = 0;
+	first = last = -1;
+}
+
+
+void sqlResultCellCache::Unlink(int slot)
+{
+	if (cells[slot].prev >= 0)
+		cells[cells[slot].prev].next = cells[slot].next;
+	else
+		first = cells[slot].next;
+
+	if (cells[slot].next >= 0)
+		cells[cells[slot].next].prev = cells[slot].prev;
+	else
+		last = cells[slot].prev;
+}
+
+
+void sqlResultCellCache::LinkFirst(int slot)
+{
+	cells[slot].prev = -1;
+	cells[slot].next = first;
+	if (first >= 0)
+		cells[first].prev = slot;
+	first = slot;
+	if (last < 0)
+		last = slot;
+}
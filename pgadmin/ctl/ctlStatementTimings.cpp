@@ -0,0 +1,215 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// ctlStatementTimings.cpp - Timings of the statements of a query
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/imaglist.h>
+
+// App headers
+#include "ctl/ctlStatementTimings.h"
+
+// Icons
+#include "images/down.pngc"
+#include "images/up.pngc"
+
+
+enum
+{
+	COL_NUMBER,
+	COL_STATEMENT,
+	COL_COMMAND,
+	COL_ROWS,
+	COL_TIME,
+	COL_PLAN
+};
+
+
+BEGIN_EVENT_TABLE(ctlStatementTimings, ctlListView)
+	EVT_LIST_COL_CLICK(wxID_ANY, ctlStatementTimings::OnColumnClick)
+END_EVENT_TABLE()
+
+
+ctlStatementTimings::ctlStatementTimings(wxWindow *parent, wxWindowID id)
+	: ctlListView(parent, id, wxDefaultPosition, wxDefaultSize, wxLC_SINGLE_SEL)
+{
+	sortColumn = COL_NUMBER;
+	sortAscending = true;
+
+	images = new wxImageList(13, 8, true, 2);
+	images->Add(*down_png_ico);
+	images->Add(*up_png_ico);
+	SetImageList(images, wxIMAGE_LIST_SMALL);
+
+	AddColumn(_("#"), 25, wxLIST_FORMAT_RIGHT);
+	AddColumn(_("Statement"), 250);
+	AddColumn(_("Command"), 80);
+	AddColumn(_("Rows"), 50, wxLIST_FORMAT_RIGHT);
+	AddColumn(_("Time (ms)"), 60, wxLIST_FORMAT_RIGHT);
+	AddColumn(_("Plan"), 70);
+}
+
+
+ctlStatementTimings::~ctlStatementTimings()
+{
+	delete images;
+}
+
+
+void ctlStatementTimings::SetTimings(const pgStatementTimingArray &_timings)
+{
+	timings = _timings;
+
+	order.Empty();
+	for (size_t i = 0 ; i < timings.GetCount() ; i++)
+		order.Add((int)i);
+
+	Fill();
+}
+
+
+void ctlStatementTimings::ClearTimings()
+{
+	timings.Empty();
+	order.Empty();
+	DeleteAllItems();
+}
+
+
+int ctlStatementTimings::GetSlowest() const
+{
+	int slowest = -1;
+
+	for (size_t i = 0 ; i < timings.GetCount() ; i++)
+	{
+		if (slowest < 0 || timings[i].elapsed > timings[slowest].elapsed)
+			slowest = (int)i;
+	}
+	return slowest;
+}
+
+
+int ctlStatementTimings::GetStatement(long row) const
+{
+	if (row < 0 || (size_t)row >= order.GetCount())
+		return -1;
+	return order[row];
+}
+
+
+// What the comparison of the rows sorts by; wxArrayInt::Sort() takes no
+// context, and the list is only sorted from the main thread
+static const pgStatementTimingArray *sortTimings = NULL;
+static int sortBy = COL_NUMBER;
+static bool sortUp = true;
+
+static int CompareTimings(int *first, int *second)
+{
+	const pgStatementTiming &a = sortTimings->Item(*first), &b = sortTimings->Item(*second);
+	int cmp = 0;
+
+	switch (sortBy)
+	{
+		case COL_STATEMENT:
+			cmp = a.statement.CmpNoCase(b.statement);
+			break;
+		case COL_COMMAND:
+			cmp = a.command.CmpNoCase(b.command);
+			break;
+		case COL_ROWS:
+			cmp = a.rows < b.rows ? -1 : a.rows > b.rows;
+			break;
+		case COL_TIME:
+			cmp = a.elapsed < b.elapsed ? -1 : a.elapsed > b.elapsed;
+			break;
+		case COL_PLAN:
+			cmp = a.plan - b.plan;
+			break;
+	}
+
+	// Statements which compare equal stay in the order they were run
+	if (!cmp)
+		cmp = *first - *second;
+
+	return sortUp ? cmp : -cmp;
+}
+
+
+void ctlStatementTimings::OnColumnClick(wxListEvent &event)
+{
+	if (sortColumn == event.GetColumn())
+		sortAscending = !sortAscending;
+	else
+	{
+		sortColumn = event.GetColumn();
+		// The slowest first, as that's what is looked for
+		sortAscending = (sortColumn != COL_TIME);
+	}
+
+	sortTimings = &timings;
+	sortBy = sortColumn;
+	sortUp = sortAscending;
+	order.Sort(CompareTimings);
+	sortTimings = NULL;
+
+	Fill();
+}
+
+
+void ctlStatementTimings::Fill()
+{
+	Freeze();
+	DeleteAllItems();
+
+	for (int i = 0 ; i < GetColumnCount() ; i++)
+	{
+		wxListItem item;
+		item.SetMask(wxLIST_MASK_IMAGE);
+		item.SetImage(i == sortColumn ? (sortAscending ? 0 : 1) : -1);
+		SetColumn(i, item);
+	}
+
+	for (size_t i = 0 ; i < order.GetCount() ; i++)
+	{
+		const pgStatementTiming &timing = timings[order[i]];
+
+		// On one line, and only the start of a long statement
+		wxString statement = timing.statement;
+		statement.Replace(wxT("\r"), wxT(""));
+		statement.Replace(wxT("\n"), wxT(" "));
+		statement.Replace(wxT("\t"), wxT(" "));
+		if (statement.Length() > CTLSTATEMENTTIMINGS_STATEMENT_LENGTH)
+			statement = statement.Left(CTLSTATEMENTTIMINGS_STATEMENT_LENGTH) + wxT("...");
+
+		long row = InsertItem(i, NumToStr((long)order[i] + 1), -1);
+		SetItem(row, COL_STATEMENT, statement);
+		SetItem(row, COL_COMMAND, timing.failed ? wxString(_("ERROR")) : timing.command);
+		if (timing.rows >= 0)
+			SetItem(row, COL_ROWS, NumToStr(timing.rows));
+		SetItem(row, COL_TIME, wxString::Format(wxT("%.3f"), timing.elapsed));
+
+		switch (timing.plan)
+		{
+			case PGPLAN_PREPARED:
+				SetItem(row, COL_PLAN, _("prepared"));
+				break;
+			case PGPLAN_GENERIC:
+				SetItem(row, COL_PLAN, _("generic (cached)"));
+				break;
+			case PGPLAN_CUSTOM:
+				SetItem(row, COL_PLAN, _("custom"));
+				break;
+		}
+	}
+
+	Thaw();
+}
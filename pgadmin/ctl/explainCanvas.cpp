@@ -43,6 +43,7 @@ void ExplainCanvas::Clear()
 {
 	GetDiagram()->DeleteAllShapes();
 	rootShape = NULL;
+	plan.Clear();
 }
 
 
@@ -50,6 +51,13 @@ void ExplainCanvas::SetExplainString(const wxString &str)
 {
 	Clear();
 
+	if (ExplainPlan::IsJson(str))
+	{
+		if (plan.Parse(str))
+			SetExplainPlan();
+		return;
+	}
+
 	// We can have multiple plans in a single explain string
 	// Add a empty root shape, which will never get drawn, but it will help us
 	// to keep track of all these plans
@@ -122,11 +130,61 @@ void ExplainCanvas::SetExplainString(const wxString &str)
 		last = s;
 	}
 
+	LayoutShapes(maxLevel);
+}
+
+
+void ExplainCanvas::SetExplainPlan()
+{
+	rootShape = ExplainShape::Create(0, NULL, wxEmptyString);
+	AddShape(rootShape);
+
+	int maxLevel = 0;
+	size_t n;
+	for (n = 0 ; n < plan.GetPlanCount() ; n++)
+	{
+		ExplainShape *s = AddPlanShapes(plan.GetRoot(n), rootShape, 1, maxLevel);
+		if (!s)
+			continue;
+
+		if (plan.GetPlanningTime(n) >= 0)
+			s->stats.Add(wxString::Format(_("Planning time: %.3f ms"), plan.GetPlanningTime(n)));
+		if (plan.GetExecutionTime(n) >= 0)
+			s->stats.Add(wxString::Format(_("Execution time: %.3f ms"), plan.GetExecutionTime(n)));
+	}
+
+	LayoutShapes(maxLevel);
+}
+
 
-	int x0 = (int)(rootShape->GetWidth() * 3);
-	int y0 = (int)(rootShape->GetHeight() * 3 / 2);
-	int xoffs = (int)(rootShape->GetWidth() * 3);
-	int yoffs = (int)(rootShape->GetHeight() * 5 / 4);
+// Adds the shapes of a node and its children in the order the text format
+// lists them in
+ExplainShape *ExplainCanvas::AddPlanShapes(ExplainPlanNode *node, ExplainShape *upper, long level, int &maxLevel)
+{
+	ExplainShape *s = ExplainShape::Create(level, upper, node->GetTextLine());
+	if (!s)
+		return NULL;
+	s->SetPlanNode(node, plan);
+	s->SetCanvas(this);
+	InsertShape(s);
+	s->Show(true);
+
+	if (level > maxLevel)
+		maxLevel = level;
+
+	size_t i;
+	for (i = 0 ; i < node->GetChildren().GetCount() ; i++)
+		AddPlanShapes(node->GetChildren().Item(i), s, level + 1, maxLevel);
+
+	return s;
+}
+
+
+void ExplainCanvas::LayoutShapes(int maxLevel)
+{
+	// Shapes of JSON plans may be larger than the root shape; every shape
+	// gets the room of the largest one
+	double shapeWidth = rootShape->GetWidth(), shapeHeight = rootShape->GetHeight();
 
 	wxNode *current = GetDiagram()->GetShapeList()->GetFirst();
 	while (current)
@@ -137,9 +195,18 @@ void ExplainCanvas::SetExplainString(const wxString &str)
 			s->totalShapes = 1;
 		if (s->GetUpper())
 			s->GetUpper()->totalShapes += s->totalShapes;
+		if (s->GetWidth() > shapeWidth)
+			shapeWidth = s->GetWidth();
+		if (s->GetHeight() > shapeHeight)
+			shapeHeight = s->GetHeight();
 		current = current->GetNext();
 	}
 
+	int x0 = (int)(shapeWidth * 3);
+	int y0 = (int)(shapeHeight * 3 / 2);
+	int xoffs = (int)(shapeWidth * 3);
+	int yoffs = (int)(shapeHeight * 5 / 4);
+
 	current = GetDiagram()->GetShapeList()->GetLast();
 	while (current)
 	{
@@ -262,6 +329,7 @@ private:
 	void OnPaint(wxPaintEvent &ev);
 
 	wxString m_desc, m_detail, m_condition, m_cost, m_actual;
+	wxArrayString m_stats;
 
 	DECLARE_EVENT_TABLE()
 };
@@ -288,6 +356,7 @@ ExplainText::ExplainText(ExplainPopup *parent, ExplainShape *s) : wxWindow(paren
 	m_condition = s->condition;
 	m_cost = s->cost;
 	m_actual = s->actual;
+	m_stats = s->stats;
 
 	int w1, w2, h;
 	dc.GetTextExtent(m_desc, &w1, &h);
@@ -300,6 +369,12 @@ ExplainText::ExplainText(ExplainPopup *parent, ExplainShape *s) : wxWindow(paren
 	if (w1 < w2)    w1 = w2;
 	dc.GetTextExtent(m_actual, &w2, &h);
 	if (w1 < w2)    w1 = w2;
+	size_t i;
+	for (i = 0 ; i < m_stats.GetCount() ; i++)
+	{
+		dc.GetTextExtent(m_stats.Item(i), &w2, &h);
+		if (w1 < w2)    w1 = w2;
+	}
 
 	int n = 2;
 	if (!m_detail.IsEmpty())
@@ -310,11 +385,12 @@ ExplainText::ExplainText(ExplainPopup *parent, ExplainShape *s) : wxWindow(paren
 		n++;
 	if (!m_actual.IsEmpty())
 		n++;
+	n += m_stats.GetCount();
 
 	if (!h)
 		h = GetCharHeight();
 
-	SetSize(GetCharHeight() + w1, GetCharHeight() + h * n + h / 3);
+	SetSize(GetCharHeight() + w1, GetCharHeight() + h * n + h / 3 + (m_stats.IsEmpty() ? 0 : h / 3));
 }
 
 void ExplainText::OnMouseMove(wxMouseEvent &ev)
@@ -385,6 +461,18 @@ void ExplainText::OnPaint(wxPaintEvent &ev)
 		dc.DrawText(m_actual, x, y);
 	}
 
+	if (!m_stats.IsEmpty())
+	{
+		y += yoffs / 3;
+
+		size_t i;
+		for (i = 0 ; i < m_stats.GetCount() ; i++)
+		{
+			y += yoffs;
+			dc.DrawText(m_stats.Item(i), x, y);
+		}
+	}
+
 #if wxUSE_POPUPWIN
 
 	wxPen pen1 = wxPen(wxSystemSettings::GetColour(wxSYS_COLOUR_3DFACE)),
@@ -0,0 +1,934 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// explainPlan.cpp - Plans of EXPLAIN (FORMAT JSON)
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/arrimpl.cpp>
+
+#include <math.h>
+
+// App headers
+#include "ctl/explainPlan.h"
+#include "utils/misc.h"
+
+WX_DEFINE_OBJARRAY(ExplainWorkerArray);
+
+// Number of nodes highlighted as the hottest ones, and the smallest share of
+// the time (or cost) of the plan a node needs for that
+#define EXPLAIN_HOT_NODES   3
+#define EXPLAIN_HOT_SHARE   0.1
+
+
+class jsonValue;
+WX_DEFINE_ARRAY_PTR(jsonValue *, jsonValueArray);
+
+// A JSON value, as much of it as EXPLAIN makes use of
+class jsonValue
+{
+public:
+	enum jsonType
+	{
+		JSON_NULL,
+		JSON_BOOL,
+		JSON_NUMBER,
+		JSON_STRING,
+		JSON_ARRAY,
+		JSON_OBJECT
+	};
+
+	jsonValue()
+	{
+		type = JSON_NULL;
+		number = 0;
+	}
+	~jsonValue()
+	{
+		WX_CLEAR_ARRAY(items);
+	}
+
+	const jsonValue *Get(const char *key) const;
+	double GetNumber(const char *key, double defaultValue = 0) const;
+	wxString GetString(const char *key) const;
+	bool GetBool(const char *key) const;
+	// Strings, numbers and lists of them as in the text format
+	wxString ToString() const;
+
+	jsonType type;
+	double number;
+	wxString str;
+	// Members of objects have keys, elements of arrays don't
+	wxArrayString keys;
+	jsonValueArray items;
+};
+
+
+const jsonValue *jsonValue::Get(const char *key) const
+{
+	if (type != JSON_OBJECT)
+		return NULL;
+
+	int n = keys.Index(wxString::FromAscii(key));
+	return n == wxNOT_FOUND ? NULL : items.Item(n);
+}
+
+
+double jsonValue::GetNumber(const char *key, double defaultValue) const
+{
+	const jsonValue *v = Get(key);
+	if (!v)
+		return defaultValue;
+
+	if (v->type == JSON_NUMBER)
+		return v->number;
+
+	// Numbers of older servers come as strings
+	if (v->type == JSON_STRING && !v->str.IsEmpty())
+		return StrToDouble(v->str);
+
+	return defaultValue;
+}
+
+
+wxString jsonValue::GetString(const char *key) const
+{
+	const jsonValue *v = Get(key);
+	return v ? v->ToString() : wxString();
+}
+
+
+bool jsonValue::GetBool(const char *key) const
+{
+	const jsonValue *v = Get(key);
+	return v && v->type == JSON_BOOL && v->number != 0;
+}
+
+
+wxString jsonValue::ToString() const
+{
+	switch (type)
+	{
+		case JSON_BOOL:
+			return number != 0 ? wxT("true") : wxT("false");
+
+		case JSON_NUMBER:
+			if (number == floor(number) && fabs(number) < 1e15)
+				return wxString::Format(wxT("%.0f"), number);
+			return wxString::Format(wxT("%g"), number);
+
+		case JSON_STRING:
+			return str;
+
+		case JSON_ARRAY:
+		{
+			wxString list;
+			size_t i;
+			for (i = 0 ; i < items.GetCount() ; i++)
+			{
+				if (i)
+					list += wxT(", ");
+				list += items.Item(i)->ToString();
+			}
+			return list;
+		}
+
+		default:
+			return wxEmptyString;
+	}
+}
+
+
+// A recursive descent parser; EXPLAIN output is small enough for that
+class jsonParser
+{
+public:
+	jsonParser(const wxString &text)
+	{
+		p = text.c_str();
+	}
+
+	bool Parse(jsonValue &value)
+	{
+		if (!ParseValue(value))
+			return false;
+		SkipSpace();
+		return *p == 0;
+	}
+
+private:
+	void SkipSpace()
+	{
+		while (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')
+			p++;
+	}
+
+	bool ParseValue(jsonValue &value);
+	bool ParseString(wxString &str);
+	bool ParseNumber(double &number);
+	bool ParseLiteral(const wxChar *literal);
+
+	const wxChar *p;
+};
+
+
+bool jsonParser::ParseValue(jsonValue &value)
+{
+	SkipSpace();
+
+	switch (*p)
+	{
+		case '{':
+			value.type = jsonValue::JSON_OBJECT;
+			p++;
+			SkipSpace();
+			if (*p == '}')
+			{
+				p++;
+				return true;
+			}
+			while (true)
+			{
+				wxString key;
+				SkipSpace();
+				if (*p != '"' || !ParseString(key))
+					return false;
+				SkipSpace();
+				if (*p++ != ':')
+					return false;
+
+				jsonValue *member = new jsonValue;
+				value.keys.Add(key);
+				value.items.Add(member);
+				if (!ParseValue(*member))
+					return false;
+
+				SkipSpace();
+				if (*p == '}')
+				{
+					p++;
+					return true;
+				}
+				if (*p++ != ',')
+					return false;
+			}
+
+		case '[':
+			value.type = jsonValue::JSON_ARRAY;
+			p++;
+			SkipSpace();
+			if (*p == ']')
+			{
+				p++;
+				return true;
+			}
+			while (true)
+			{
+				jsonValue *element = new jsonValue;
+				value.items.Add(element);
+				if (!ParseValue(*element))
+					return false;
+
+				SkipSpace();
+				if (*p == ']')
+				{
+					p++;
+					return true;
+				}
+				if (*p++ != ',')
+					return false;
+			}
+
+		case '"':
+			value.type = jsonValue::JSON_STRING;
+			return ParseString(value.str);
+
+		case 't':
+			value.type = jsonValue::JSON_BOOL;
+			value.number = 1;
+			return ParseLiteral(wxT("true"));
+
+		case 'f':
+			value.type = jsonValue::JSON_BOOL;
+			value.number = 0;
+			return ParseLiteral(wxT("false"));
+
+		case 'n':
+			value.type = jsonValue::JSON_NULL;
+			return ParseLiteral(wxT("null"));
+
+		default:
+			value.type = jsonValue::JSON_NUMBER;
+			return ParseNumber(value.number);
+	}
+}
+
+
+bool jsonParser::ParseLiteral(const wxChar *literal)
+{
+	size_t len = wxStrlen(literal);
+	if (wxStrncmp(p, literal, len))
+		return false;
+
+	p += len;
+	return true;
+}
+
+
+bool jsonParser::ParseNumber(double &number)
+{
+	const wxChar *start = p;
+
+	if (*p == '-')
+		p++;
+	while ((*p >= '0' && *p <= '9') || *p == '.' || *p == 'e' || *p == 'E' || *p == '+' || *p == '-')
+		p++;
+
+	if (p == start)
+		return false;
+
+	number = StrToDouble(wxString(start, p - start));
+	return true;
+}
+
+
+// The four hex digits of a \u escape
+static bool ParseHex(const wxChar *p, unsigned long &c)
+{
+	int i;
+	for (i = 0 ; i < 4 ; i++)
+	{
+		if (!wxIsxdigit(p[i]))
+			return false;
+	}
+	return wxString(p, 4).ToULong(&c, 16);
+}
+
+
+bool jsonParser::ParseString(wxString &str)
+{
+	// At the opening quote
+	p++;
+
+	const wxChar *start = p;
+	while (*p && *p != '"' && *p != '\\')
+		p++;
+	str = wxString(start, p - start);
+
+	while (*p != '"')
+	{
+		if (!*p)
+			return false;
+
+		if (*p != '\\')
+		{
+			str += *p++;
+			continue;
+		}
+
+		p++;
+		switch (*p++)
+		{
+			case '"':
+				str += wxT('"');
+				break;
+			case '\\':
+				str += wxT('\\');
+				break;
+			case '/':
+				str += wxT('/');
+				break;
+			case 'b':
+				str += wxT('\b');
+				break;
+			case 'f':
+				str += wxT('\f');
+				break;
+			case 'n':
+				str += wxT('\n');
+				break;
+			case 'r':
+				str += wxT('\r');
+				break;
+			case 't':
+				str += wxT('\t');
+				break;
+			case 'u':
+			{
+				unsigned long c;
+				if (!ParseHex(p, c))
+					return false;
+				p += 4;
+
+#if SIZEOF_WCHAR_T == 4
+				// Surrogate pairs make up a single character
+				if (c >= 0xD800 && c < 0xDC00 && p[0] == '\\' && p[1] == 'u')
+				{
+					unsigned long low;
+					if (ParseHex(p + 2, low) && low >= 0xDC00 && low < 0xE000)
+					{
+						c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+						p += 6;
+					}
+				}
+#endif
+				str += (wxChar)c;
+				break;
+			}
+			default:
+				return false;
+		}
+	}
+
+	p++;
+	return true;
+}
+
+
+static void ParseBuffers(const jsonValue &v, ExplainBuffers &buffers)
+{
+	buffers.sharedHit = v.GetNumber("Shared Hit Blocks");
+	buffers.sharedRead = v.GetNumber("Shared Read Blocks");
+	buffers.sharedDirtied = v.GetNumber("Shared Dirtied Blocks");
+	buffers.sharedWritten = v.GetNumber("Shared Written Blocks");
+	buffers.localHit = v.GetNumber("Local Hit Blocks");
+	buffers.localRead = v.GetNumber("Local Read Blocks");
+	buffers.localDirtied = v.GetNumber("Local Dirtied Blocks");
+	buffers.localWritten = v.GetNumber("Local Written Blocks");
+	buffers.tempRead = v.GetNumber("Temp Read Blocks");
+	buffers.tempWritten = v.GetNumber("Temp Written Blocks");
+	buffers.ioReadTime = v.GetNumber("I/O Read Time");
+	buffers.ioWriteTime = v.GetNumber("I/O Write Time");
+}
+
+
+ExplainBuffers::ExplainBuffers()
+{
+	sharedHit = sharedRead = sharedDirtied = sharedWritten = 0;
+	localHit = localRead = localDirtied = localWritten = 0;
+	tempRead = tempWritten = 0;
+	ioReadTime = ioWriteTime = 0;
+}
+
+
+void ExplainBuffers::Add(const ExplainBuffers &buffers)
+{
+	sharedHit += buffers.sharedHit;
+	sharedRead += buffers.sharedRead;
+	sharedDirtied += buffers.sharedDirtied;
+	sharedWritten += buffers.sharedWritten;
+	localHit += buffers.localHit;
+	localRead += buffers.localRead;
+	localDirtied += buffers.localDirtied;
+	localWritten += buffers.localWritten;
+	tempRead += buffers.tempRead;
+	tempWritten += buffers.tempWritten;
+	ioReadTime += buffers.ioReadTime;
+	ioWriteTime += buffers.ioWriteTime;
+}
+
+
+bool ExplainBuffers::IsEmpty() const
+{
+	return !sharedHit && !sharedRead && !sharedDirtied && !sharedWritten &&
+	       !localHit && !localRead && !localDirtied && !localWritten &&
+	       !tempRead && !tempWritten && !ioReadTime && !ioWriteTime;
+}
+
+
+// As the text format of EXPLAIN shows them, on a single line
+wxString ExplainBuffers::ToString() const
+{
+	wxString str, part;
+
+	if (sharedHit || sharedRead || sharedDirtied || sharedWritten)
+	{
+		str += wxT(" shared");
+		if (sharedHit)
+			str += wxString::Format(wxT(" hit=%.0f"), sharedHit);
+		if (sharedRead)
+			str += wxString::Format(wxT(" read=%.0f"), sharedRead);
+		if (sharedDirtied)
+			str += wxString::Format(wxT(" dirtied=%.0f"), sharedDirtied);
+		if (sharedWritten)
+			str += wxString::Format(wxT(" written=%.0f"), sharedWritten);
+	}
+	if (localHit || localRead || localDirtied || localWritten)
+	{
+		if (!str.IsEmpty())
+			str += wxT(",");
+		str += wxT(" local");
+		if (localHit)
+			str += wxString::Format(wxT(" hit=%.0f"), localHit);
+		if (localRead)
+			str += wxString::Format(wxT(" read=%.0f"), localRead);
+		if (localDirtied)
+			str += wxString::Format(wxT(" dirtied=%.0f"), localDirtied);
+		if (localWritten)
+			str += wxString::Format(wxT(" written=%.0f"), localWritten);
+	}
+	if (tempRead || tempWritten)
+	{
+		if (!str.IsEmpty())
+			str += wxT(",");
+		str += wxT(" temp");
+		if (tempRead)
+			str += wxString::Format(wxT(" read=%.0f"), tempRead);
+		if (tempWritten)
+			str += wxString::Format(wxT(" written=%.0f"), tempWritten);
+	}
+	if (!str.IsEmpty())
+		str = wxT("Buffers:") + str;
+
+	if (ioReadTime || ioWriteTime)
+	{
+		if (!str.IsEmpty())
+			str += wxT("; ");
+		str += wxT("I/O Timings:");
+		if (ioReadTime)
+			str += wxString::Format(wxT(" read=%.3f"), ioReadTime);
+		if (ioWriteTime)
+			str += wxString::Format(wxT(" write=%.3f"), ioWriteTime);
+	}
+
+	return str;
+}
+
+
+ExplainWorker::ExplainWorker()
+{
+	number = -1;
+	actualStartup = actualTotal = actualRows = actualLoops = 0;
+}
+
+
+ExplainPlanNode::ExplainPlanNode(ExplainPlanNode *_parent)
+{
+	parent = _parent;
+	startupCost = totalCost = planRows = planWidth = -1;
+	analyzed = executed = false;
+	actualStartup = actualTotal = actualRows = actualLoops = 0;
+	workersPlanned = workersLaunched = -1;
+	inclusiveTime = exclusiveTime = 0;
+}
+
+
+ExplainPlanNode::~ExplainPlanNode()
+{
+	WX_CLEAR_ARRAY(children);
+}
+
+
+// The name of the node as the text format has it, see ExplainNode() of
+// postgresql/src/backend/commands/explain.c
+static wxString GetNodeName(const jsonValue &plan)
+{
+	wxString type = plan.GetString("Node Type");
+	wxString name = type;
+
+	if (type == wxT("Aggregate"))
+	{
+		wxString strategy = plan.GetString("Strategy");
+		if (strategy == wxT("Sorted"))
+			name = wxT("GroupAggregate");
+		else if (strategy == wxT("Hashed"))
+			name = wxT("HashAggregate");
+		else if (strategy == wxT("Mixed"))
+			name = wxT("MixedAggregate");
+	}
+	else if (type == wxT("SetOp"))
+	{
+		if (plan.GetString("Strategy") == wxT("Hashed"))
+			name = wxT("HashSetOp");
+		name += wxT(" ") + plan.GetString("Command");
+	}
+	else if (type == wxT("ModifyTable"))
+		name = plan.GetString("Operation");
+
+	wxString partialMode = plan.GetString("Partial Mode");
+	if (!partialMode.IsEmpty() && partialMode != wxT("Simple"))
+		name = partialMode + wxT(" ") + name;
+	if (plan.GetBool("Parallel Aware"))
+		name = wxT("Parallel ") + name;
+
+	wxString joinType = plan.GetString("Join Type");
+	if (!joinType.IsEmpty() && joinType != wxT("Inner"))
+	{
+		if (name.EndsWith(wxT(" Join")))
+			name = name.Left(name.Length() - 5);
+		name += wxT(" ") + joinType + wxT(" Join");
+	}
+
+	if (plan.GetString("Scan Direction") == wxT("Backward"))
+		name += wxT(" Backward");
+
+	wxString index = plan.GetString("Index Name");
+	if (!index.IsEmpty())
+	{
+		if (type == wxT("Bitmap Index Scan"))
+			name += wxT(" on ") + index;
+		else
+			name += wxT(" using ") + index;
+	}
+
+	// The alias is left out if it's the name of what's scanned anyway
+	wxString target = plan.GetString("Relation Name"), qualifiedTarget;
+	if (target.IsEmpty())
+		target = plan.GetString("CTE Name");
+	if (target.IsEmpty())
+		target = plan.GetString("Function Name");
+	if (target.IsEmpty())
+		target = plan.GetString("Tuplestore Name");
+
+	qualifiedTarget = target;
+	wxString schema = plan.GetString("Schema");
+	if (!target.IsEmpty() && !schema.IsEmpty())
+		qualifiedTarget = schema + wxT(".") + target;
+
+	wxString alias = plan.GetString("Alias");
+	if (!target.IsEmpty())
+	{
+		name += wxT(" on ") + qualifiedTarget;
+		if (!alias.IsEmpty() && alias != target)
+			name += wxT(" ") + alias;
+	}
+	else if (!alias.IsEmpty())
+		name += wxT(" on ") + alias;
+
+	return name;
+}
+
+
+void ExplainPlanNode::AddCondition(const jsonValue &plan, const char *key)
+{
+	const jsonValue *v = plan.Get(key);
+	if (!v || v->type == jsonValue::JSON_NULL)
+		return;
+
+	wxString value = v->ToString();
+	if (value.IsEmpty())
+		return;
+
+	conditions.Add(wxString::FromAscii(key) + wxT(": ") + value);
+}
+
+
+void ExplainPlanNode::Parse(const jsonValue &plan, int processes)
+{
+	nodeType = plan.GetString("Node Type");
+	name = GetNodeName(plan);
+	parentRelationship = plan.GetString("Parent Relationship");
+	subplanName = plan.GetString("Subplan Name");
+
+	startupCost = plan.GetNumber("Startup Cost", -1);
+	totalCost = plan.GetNumber("Total Cost", -1);
+	planRows = plan.GetNumber("Plan Rows", -1);
+	planWidth = plan.GetNumber("Plan Width", -1);
+
+	analyzed = plan.Get("Actual Loops") != NULL;
+	actualLoops = plan.GetNumber("Actual Loops");
+	actualStartup = plan.GetNumber("Actual Startup Time");
+	actualTotal = plan.GetNumber("Actual Total Time");
+	actualRows = plan.GetNumber("Actual Rows");
+	executed = analyzed && actualLoops > 0;
+
+	ParseBuffers(plan, buffers);
+
+	workersPlanned = (long)plan.GetNumber("Workers Planned", -1);
+	workersLaunched = (long)plan.GetNumber("Workers Launched", -1);
+
+	const jsonValue *list = plan.Get("Workers");
+	if (list && list->type == jsonValue::JSON_ARRAY)
+	{
+		size_t i;
+		for (i = 0 ; i < list->items.GetCount() ; i++)
+		{
+			const jsonValue &w = *list->items.Item(i);
+			ExplainWorker worker;
+			worker.number = (long)w.GetNumber("Worker Number", i);
+			worker.actualStartup = w.GetNumber("Actual Startup Time");
+			worker.actualTotal = w.GetNumber("Actual Total Time");
+			worker.actualRows = w.GetNumber("Actual Rows");
+			worker.actualLoops = w.GetNumber("Actual Loops");
+			ParseBuffers(w, worker.buffers);
+			workers.Add(worker);
+		}
+	}
+
+	// In the order the text format shows them
+	AddCondition(plan, "Output");
+	AddCondition(plan, "Group Key");
+	AddCondition(plan, "Sort Key");
+	AddCondition(plan, "Presorted Key");
+	AddCondition(plan, "Hash Cond");
+	AddCondition(plan, "Merge Cond");
+	AddCondition(plan, "Join Filter");
+	AddCondition(plan, "Rows Removed by Join Filter");
+	AddCondition(plan, "Index Cond");
+	AddCondition(plan, "Rows Removed by Index Recheck");
+	AddCondition(plan, "Recheck Cond");
+	AddCondition(plan, "TID Cond");
+	AddCondition(plan, "One-Time Filter");
+	AddCondition(plan, "Filter");
+	AddCondition(plan, "Rows Removed by Filter");
+	AddCondition(plan, "Heap Fetches");
+	AddCondition(plan, "Cache Key");
+
+	wxString sortMethod = plan.GetString("Sort Method");
+	if (!sortMethod.IsEmpty())
+	{
+		conditions.Add(wxString::Format(wxT("Sort Method: %s  %s: %.0fkB"), sortMethod.c_str(),
+		                                plan.GetString("Sort Space Type").c_str(), plan.GetNumber("Sort Space Used")));
+	}
+	if (plan.Get("Hash Buckets"))
+	{
+		conditions.Add(wxString::Format(wxT("Buckets: %.0f  Batches: %.0f  Memory Usage: %.0fkB"),
+		                                plan.GetNumber("Hash Buckets"), plan.GetNumber("Hash Batches"),
+		                                plan.GetNumber("Peak Memory Usage")));
+	}
+	if (plan.Get("Exact Heap Blocks") || plan.Get("Lossy Heap Blocks"))
+	{
+		conditions.Add(wxString::Format(wxT("Heap Blocks: exact=%.0f lossy=%.0f"),
+		                                plan.GetNumber("Exact Heap Blocks"), plan.GetNumber("Lossy Heap Blocks")));
+	}
+
+	// The nodes below a Gather run in the workers and the leader at once;
+	// their loops add up the processes
+	int childProcesses = processes;
+	if (nodeType.StartsWith(wxT("Gather")) && workersLaunched >= 0)
+		childProcesses = workersLaunched + 1;
+
+	list = plan.Get("Plans");
+	if (list && list->type == jsonValue::JSON_ARRAY)
+	{
+		size_t i;
+		for (i = 0 ; i < list->items.GetCount() ; i++)
+		{
+			if (list->items.Item(i)->type != jsonValue::JSON_OBJECT)
+				continue;
+
+			ExplainPlanNode *child = new ExplainPlanNode(this);
+			children.Add(child);
+			child->Parse(*list->items.Item(i), childProcesses);
+		}
+	}
+
+	if (executed)
+	{
+		inclusiveTime = actualTotal * actualLoops / (processes > 0 ? processes : 1);
+
+		double childTime = 0;
+		size_t i;
+		for (i = 0 ; i < children.GetCount() ; i++)
+			childTime += children.Item(i)->inclusiveTime;
+
+		exclusiveTime = inclusiveTime > childTime ? inclusiveTime - childTime : 0;
+	}
+}
+
+
+wxString ExplainPlanNode::GetTextLine() const
+{
+	wxString line = name;
+
+	if (totalCost >= 0)
+		line += wxString::Format(wxT("  (cost=%.2f..%.2f rows=%.0f width=%.0f)"), startupCost, totalCost, planRows, planWidth);
+
+	if (analyzed)
+	{
+		if (executed)
+			line += wxString::Format(wxT(" (actual time=%.3f..%.3f rows=%.0f loops=%.0f)"), actualStartup, actualTotal, actualRows, actualLoops);
+		else
+			line += wxT(" (never executed)");
+	}
+
+	return line;
+}
+
+
+double ExplainPlanNode::GetExclusiveCost() const
+{
+	if (totalCost < 0)
+		return 0;
+
+	double cost = totalCost;
+	size_t i;
+	for (i = 0 ; i < children.GetCount() ; i++)
+	{
+		if (children.Item(i)->totalCost > 0)
+			cost -= children.Item(i)->totalCost;
+	}
+
+	return cost > 0 ? cost : 0;
+}
+
+
+// Buffers are counted with the children included
+double ExplainPlanNode::GetExclusiveReads() const
+{
+	double reads = buffers.GetReads();
+	size_t i;
+	for (i = 0 ; i < children.GetCount() ; i++)
+		reads -= children.Item(i)->buffers.GetReads();
+
+	return reads > 0 ? reads : 0;
+}
+
+
+double ExplainPlanNode::GetRowsEstimateFactor() const
+{
+	if (!executed || planRows < 0)
+		return 1;
+
+	// Both are per loop; the planner never estimates less than a row
+	double actual = actualRows > 1 ? actualRows : 1;
+	double planned = planRows > 1 ? planRows : 1;
+	return planned / actual;
+}
+
+
+ExplainPlan::ExplainPlan()
+{
+	analyzed = false;
+	maxWeight = totalWeight = hotWeight = maxReads = 0;
+}
+
+
+ExplainPlan::~ExplainPlan()
+{
+	Clear();
+}
+
+
+void ExplainPlan::Clear()
+{
+	WX_CLEAR_ARRAY(roots);
+	nodes.Empty();
+	planningTimes.Empty();
+	executionTimes.Empty();
+	analyzed = false;
+	maxWeight = totalWeight = hotWeight = maxReads = 0;
+}
+
+
+static int CompareDoubles(double *a, double *b)
+{
+	return *a < *b ? -1 : *a > *b ? 1 : 0;
+}
+
+
+bool ExplainPlan::IsJson(const wxString &str)
+{
+	wxString start = str.Left(16).Strip(wxString::leading);
+	return start.StartsWith(wxT("["));
+}
+
+
+bool ExplainPlan::Parse(const wxString &str)
+{
+	Clear();
+
+	jsonValue doc;
+	jsonParser parser(str);
+	if (!parser.Parse(doc) || doc.type != jsonValue::JSON_ARRAY)
+		return false;
+
+	size_t i;
+	for (i = 0 ; i < doc.items.GetCount() ; i++)
+	{
+		const jsonValue *stmt = doc.items.Item(i);
+		const jsonValue *plan = stmt->Get("Plan");
+		if (!plan || plan->type != jsonValue::JSON_OBJECT)
+			continue;
+
+		ExplainPlanNode *root = new ExplainPlanNode(NULL);
+		roots.Add(root);
+		root->Parse(*plan, 1);
+
+		planningTimes.Add(stmt->GetNumber("Planning Time", -1));
+		// Called Total Runtime before 9.4
+		executionTimes.Add(stmt->GetNumber("Execution Time", stmt->GetNumber("Total Runtime", -1)));
+
+		AddNodes(root);
+	}
+
+	// The weight a node needs to be one of the hottest
+	wxArrayDouble weights;
+	for (i = 0 ; i < nodes.GetCount() ; i++)
+		weights.Add(GetWeight(nodes.Item(i)));
+	weights.Sort(CompareDoubles);
+
+	hotWeight = totalWeight * EXPLAIN_HOT_SHARE;
+	if (weights.GetCount() >= EXPLAIN_HOT_NODES && weights.Item(weights.GetCount() - EXPLAIN_HOT_NODES) > hotWeight)
+		hotWeight = weights.Item(weights.GetCount() - EXPLAIN_HOT_NODES);
+
+	return roots.GetCount() > 0;
+}
+
+
+void ExplainPlan::AddNodes(ExplainPlanNode *node)
+{
+	nodes.Add(node);
+	if (node->analyzed)
+		analyzed = true;
+
+	size_t i;
+	for (i = 0 ; i < node->children.GetCount() ; i++)
+		AddNodes(node->children.Item(i));
+
+	// Once all nodes are known to be analyzed or not
+	if (!node->parent)
+	{
+		maxWeight = totalWeight = maxReads = 0;
+		for (i = 0 ; i < nodes.GetCount() ; i++)
+		{
+			double weight = GetWeight(nodes.Item(i));
+			double reads = nodes.Item(i)->GetExclusiveReads();
+
+			totalWeight += weight;
+			if (weight > maxWeight)
+				maxWeight = weight;
+			if (reads > maxReads)
+				maxReads = reads;
+		}
+	}
+}
+
+
+double ExplainPlan::GetWeight(const ExplainPlanNode *node) const
+{
+	return analyzed ? node->exclusiveTime : node->GetExclusiveCost();
+}
+
+
+double ExplainPlan::GetHeat(const ExplainPlanNode *node) const
+{
+	return maxWeight > 0 ? GetWeight(node) / maxWeight : 0;
+}
+
+
+double ExplainPlan::GetShare(const ExplainPlanNode *node) const
+{
+	return totalWeight > 0 ? GetWeight(node) / totalWeight : 0;
+}
+
+
+bool ExplainPlan::IsHot(const ExplainPlanNode *node) const
+{
+	double weight = GetWeight(node);
+	return weight > 0 && weight >= hotWeight;
+}
+
+
+double ExplainPlan::GetReadShare(const ExplainPlanNode *node) const
+{
+	return maxReads > 0 ? node->GetExclusiveReads() / maxReads : 0;
+}
@@ -74,6 +74,16 @@
 
 #define BMP_BORDER 3
 
+// Height of a line of text below the bitmap
+#define TEXT_HEIGHT 20
+
+// Nodes of JSON plans: the least heat for which a node is coloured, how much
+// larger the bitmap of the node reading the most blocks is drawn, and the
+// factor by which rows must be misestimated to be pointed out
+#define MIN_HEAT          0.05
+#define MAX_READ_SCALE    0.5
+#define MISESTIMATE       10
+
 ExplainShape::ExplainShape(const wxImage &bmp, const wxString &description, long tokenNo, long detailNo)
 {
 	SetBitmap(wxBitmap(bmp));
@@ -82,6 +92,10 @@ ExplainShape::ExplainShape(const wxImage &bmp, const wxString &description, long
 	totalShapes = 0;
 	usedShapes = 0;
 	m_rootShape = false;
+	planNode = NULL;
+	heat = 0;
+	hot = false;
+	misestimated = false;
 }
 
 
@@ -138,6 +152,16 @@ void ExplainShape::OnDraw(wxDC &dc)
 	x = WXROUND(m_xpos - bmp.GetWidth() / 2.0);
 	y = WXROUND(m_ypos - GetHeight() / 2.0);
 
+	if (heat >= MIN_HEAT || hot)
+	{
+		// From light yellow to red for the node most time is spent in
+		wxColour colour(255, (unsigned char)(255 - heat * 159), (unsigned char)(224 - heat * 160));
+		dc.SetBrush(wxBrush(colour));
+		dc.SetPen(hot ? wxPen(*wxRED, 2) : wxPen(colour));
+		dc.DrawRoundedRectangle(x - BMP_BORDER, y - BMP_BORDER,
+		                        bmp.GetWidth() + 2 * BMP_BORDER, bmp.GetHeight() + 2 * BMP_BORDER, BMP_BORDER);
+	}
+
 	dc.DrawBitmap(bmp, x, y, true);
 
 	int w, h;
@@ -148,6 +172,116 @@ void ExplainShape::OnDraw(wxDC &dc)
 	y += bmp.GetHeight() + BMP_BORDER;
 
 	dc.DrawText(label, x, y);
+
+	if (!timeLabel.IsEmpty())
+	{
+		dc.GetTextExtent(timeLabel, &w, &h);
+		y += TEXT_HEIGHT;
+		dc.DrawText(timeLabel, WXROUND(m_xpos - w / 2.0), y);
+	}
+	if (!rowsLabel.IsEmpty())
+	{
+		wxColour fg = dc.GetTextForeground();
+		dc.SetTextForeground(*wxRED);
+		dc.GetTextExtent(rowsLabel, &w, &h);
+		y += TEXT_HEIGHT;
+		dc.DrawText(rowsLabel, WXROUND(m_xpos - w / 2.0), y);
+		dc.SetTextForeground(fg);
+	}
+}
+
+
+void ExplainShape::SetPlanNode(const ExplainPlanNode *node, const ExplainPlan &plan)
+{
+	planNode = node;
+
+	if (node->totalCost >= 0)
+	{
+		costLow = node->startupCost;
+		costHigh = node->totalCost;
+		rows = (long)node->planRows;
+		width = (long)node->planWidth;
+	}
+
+	heat = plan.GetHeat(node);
+	hot = plan.IsHot(node);
+
+	if (!node->subplanName.IsEmpty())
+		stats.Add(node->subplanName);
+	WX_APPEND_ARRAY(stats, node->GetConditions());
+
+	if (node->executed)
+	{
+		timeLabel = wxString::Format(_("%.3f ms (%.0f%%)"), node->GetExclusiveTime(), plan.GetShare(node) * 100);
+		stats.Add(wxString::Format(_("Time: %.3f ms in the node (%.1f%%), %.3f ms with its children"),
+		                           node->GetExclusiveTime(), plan.GetShare(node) * 100, node->GetInclusiveTime()));
+
+		double factor = node->GetRowsEstimateFactor();
+		wxString rowsStat = wxString::Format(_("Rows: %.0f estimated, %.0f actual"), node->planRows, node->actualRows);
+		if (node->actualLoops > 1)
+			rowsStat += wxString::Format(_(" per loop, %.0f loops"), node->actualLoops);
+		if (factor >= MISESTIMATE)
+		{
+			misestimated = true;
+			rowsLabel = wxString::Format(_("rows %.0fx over"), factor);
+			rowsStat += wxString::Format(_("; overestimated %.0f times"), factor);
+		}
+		else if (factor <= 1.0 / MISESTIMATE)
+		{
+			misestimated = true;
+			rowsLabel = wxString::Format(_("rows %.0fx under"), 1 / factor);
+			rowsStat += wxString::Format(_("; underestimated %.0f times"), 1 / factor);
+		}
+		stats.Add(rowsStat);
+	}
+	else if (!plan.IsAnalyzed() && node->totalCost >= 0)
+		timeLabel = wxString::Format(_("%.0f%% of cost"), plan.GetShare(node) * 100);
+
+	if (!node->buffers.IsEmpty())
+		stats.Add(node->buffers.ToString());
+
+	if (node->workersPlanned >= 0)
+	{
+		wxString workers = wxString::Format(_("Workers Planned: %ld"), node->workersPlanned);
+		if (node->workersLaunched >= 0)
+			workers += wxString::Format(_(", Launched: %ld"), node->workersLaunched);
+		stats.Add(workers);
+	}
+
+	size_t i;
+	for (i = 0 ; i < node->workers.GetCount() ; i++)
+	{
+		const ExplainWorker &worker = node->workers.Item(i);
+		wxString str = wxString::Format(_("Worker %ld: actual time=%.3f..%.3f rows=%.0f loops=%.0f"),
+		                                worker.number, worker.actualStartup, worker.actualTotal,
+		                                worker.actualRows, worker.actualLoops);
+		if (!worker.buffers.IsEmpty())
+			str += wxT("; ") + worker.buffers.ToString();
+		stats.Add(str);
+	}
+
+	// The more blocks a node reads, the larger it's drawn
+	double readShare = plan.GetReadShare(node);
+	if (readShare > 0)
+	{
+		wxImage img = GetBitmap().ConvertToImage();
+		double scale = 1 + MAX_READ_SCALE * readShare;
+		img.Rescale(WXROUND(img.GetWidth() * scale), WXROUND(img.GetHeight() * scale), wxIMAGE_QUALITY_HIGH);
+		SetBitmap(wxBitmap(img));
+	}
+
+	int w = 50, h = TEXT_HEIGHT;
+	if (!timeLabel.IsEmpty())
+		h += TEXT_HEIGHT;
+	if (!rowsLabel.IsEmpty())
+		h += TEXT_HEIGHT;
+
+	wxBitmap &bmp = GetBitmap();
+	if (w < bmp.GetWidth())
+		w = bmp.GetWidth();
+
+	SetHeight(bmp.GetHeight() + BMP_BORDER + h);
+	SetWidth(w);
 }
 
 
@@ -173,10 +307,19 @@ wxRealPoint ExplainShape::GetEndPoint(int kidNo)
 
 
 
-ExplainShape *ExplainShape::Create(long level, ExplainShape *last, const wxString &str)
+ExplainShape *ExplainShape::Create(long level, ExplainShape *last, const wxString &line)
 {
 	ExplainShape *s = 0;
 
+	// Parallel and partial nodes are shown like the plain ones
+	wxString prefix, str = line;
+	while (str.StartsWith(wxT("Parallel ")) || str.StartsWith(wxT("Partial ")) || str.StartsWith(wxT("Finalize ")))
+	{
+		wxString word = str.BeforeFirst(' ') + wxT(" ");
+		prefix += word;
+		str = str.Mid(word.Length());
+	}
+
 	int costPos = str.Find(wxT("(cost="));
 	int actPos = str.Find(wxT("(actual"));
 
@@ -202,7 +345,7 @@ ExplainShape *ExplainShape::Create(long level, ExplainShape *last, const wxStrin
 		s->SetDraggable(false);
 		s->m_rootShape = true;
 		s->level = level;
-		int w = 50, h = 20;
+		int w = 50, h = TEXT_HEIGHT;
 
 		wxBitmap &bmp = s->GetBitmap();
 		if (w < bmp.GetWidth())
@@ -410,9 +553,16 @@ ExplainShape *ExplainShape::Create(long level, ExplainShape *last, const wxStrin
 	else if (token == wxT("Redistribute") && token2 == wxT("Motion"))
 		s = new ExplainShape(*ex_redistribute_motion_png_img, descr);
 
+	// Parallel query
+	else if (token == wxT("Gather"))
+		s = new ExplainShape(*ex_gather_motion_png_img, descr);
+
 	if (!s)
 		s = new ExplainShape(*ex_unknown_png_img, descr);
 
+	if (!prefix.IsEmpty())
+		s->description = prefix + s->description;
+
 	s->SetDraggable(false);
 
 	s->level = level;
@@ -430,7 +580,7 @@ ExplainShape *ExplainShape::Create(long level, ExplainShape *last, const wxStrin
 	else if (actPos > 0)
 		s->actual = str.Mid(actPos);
 
-	int w = 50, h = 20;
+	int w = 50, h = TEXT_HEIGHT;
 
 	wxBitmap &bmp = s->GetBitmap();
 	if (w < bmp.GetWidth())
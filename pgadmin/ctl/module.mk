@@ -20,13 +20,19 @@ pgadmin3_SOURCES += \
         ctl/ctlSQLBox.cpp \
         ctl/ctlSQLGrid.cpp \
         ctl/ctlSQLResult.cpp \
+        ctl/ctlStatementTimings.cpp \
         ctl/ctlDefaultSecurityPanel.cpp \
         ctl/ctlSeclabelPanel.cpp \
         ctl/ctlSecurityPanel.cpp \
         ctl/ctlTree.cpp \
 		ctl/ctlProgressStatusBar.cpp \
         ctl/explainCanvas.cpp \
+        ctl/explainPlan.cpp \
         ctl/explainShape.cpp \
+        ctl/sqlResultCopy.cpp \
+        ctl/sqlResultFilter.cpp \
+        ctl/sqlResultSort.cpp \
+        ctl/sqlResultWidths.cpp \
         ctl/timespin.cpp \
         ctl/xh_calb.cpp \
         ctl/xh_ctlcolourpicker.cpp \
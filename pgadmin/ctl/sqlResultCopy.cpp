@@ -0,0 +1,238 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// sqlResultCopy.cpp - Copying query results to the clipboard
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/thread.h>
+
+#include "db/pgSet.h"
+#include "ctl/sqlResultCopy.h"
+
+
+static wxCharBuffer ToBytes(const wxString &str, wxMBConv &conv, size_t &len)
+{
+	wxCharBuffer buf = str.mb_str(conv);
+	if (!buf)
+		buf = wxCharBuffer("");
+	len = strlen(buf);
+	return buf;
+}
+
+
+sqlResultCopy::sqlResultCopy(pgSet *_set, const long *_viewRows)
+	: wxThread(wxTHREAD_JOINABLE)
+{
+	set = _set;
+	viewRows = _viewRows;
+
+	firstRow = 0;
+	lastRow = -1;
+
+	headerLen = colSeparatorLen = quoteCharLen = rowSeparatorLen = 0;
+	endRows = false;
+
+	done = 0;
+	cancelled = false;
+}
+
+
+void sqlResultCopy::SetRows(const wxArrayInt &rows)
+{
+	rowList = rows;
+}
+
+
+void sqlResultCopy::SetRows(long first, long last)
+{
+	rowList.Empty();
+	firstRow = first;
+	lastRow = last;
+}
+
+
+void sqlResultCopy::SetColumns(const wxArrayInt &_cols, const wxArrayInt &_quoteCols)
+{
+	cols = _cols;
+	quoteCols = _quoteCols;
+}
+
+
+void sqlResultCopy::SetFormat(const wxString &_header, const wxString &_colSeparator,
+                              const wxString &_quoteChar, const wxString &_rowSeparator)
+{
+	wxMBConv &conv = set->GetConversion();
+
+	header = ToBytes(_header, conv, headerLen);
+	colSeparator = ToBytes(_colSeparator, conv, colSeparatorLen);
+	quoteChar = ToBytes(_quoteChar, conv, quoteCharLen);
+	rowSeparator = ToBytes(_rowSeparator, conv, rowSeparatorLen);
+}
+
+
+void sqlResultCopy::Cancel()
+{
+	wxCriticalSectionLocker lock(progressLock);
+	cancelled = true;
+}
+
+
+bool sqlResultCopy::CheckCancel()
+{
+	wxCriticalSectionLocker lock(progressLock);
+	return cancelled;
+}
+
+
+void sqlResultCopy::GetProgress(long &_done, long &total)
+{
+	wxCriticalSectionLocker lock(progressLock);
+	_done = done;
+	total = GetRowCount();
+}
+
+
+long sqlResultCopy::DataRow(long n) const
+{
+	long row = rowList.IsEmpty() ? firstRow + n : rowList.Item(n);
+	return viewRows ? viewRows[row] : row;
+}
+
+
+size_t sqlResultCopy::RowLength(long row) const
+{
+	size_t col, len = 0;
+	for (col = 0 ; col < cols.GetCount() ; col++)
+	{
+		if (col)
+			len += colSeparatorLen;
+		if (quoteCols.Item(col))
+			len += 2 * quoteCharLen;
+		len += set->GetLengthAt(row, cols.Item(col));
+	}
+	return len;
+}
+
+
+// NULLs are copied as empty values
+char *sqlResultCopy::AppendRow(char *p, long row) const
+{
+	size_t col;
+	for (col = 0 ; col < cols.GetCount() ; col++)
+	{
+		if (col)
+		{
+			memcpy(p, colSeparator, colSeparatorLen);
+			p += colSeparatorLen;
+		}
+		if (quoteCols.Item(col))
+		{
+			memcpy(p, quoteChar, quoteCharLen);
+			p += quoteCharLen;
+		}
+
+		int c = cols.Item(col);
+		size_t len = set->GetLengthAt(row, c);
+		memcpy(p, set->GetValueAt(row, c), len);
+		p += len;
+
+		if (quoteCols.Item(col))
+		{
+			memcpy(p, quoteChar, quoteCharLen);
+			p += quoteCharLen;
+		}
+	}
+	if (endRows)
+	{
+		memcpy(p, rowSeparator, rowSeparatorLen);
+		p += rowSeparatorLen;
+	}
+	return p;
+}
+
+
+void *sqlResultCopy::Entry()
+{
+	long n, count = GetRowCount();
+	endRows = count > 1;
+
+	// Measure the text first
+	size_t len = headerLen;
+	for (n = 0 ; n < count ; n++)
+	{
+		len += RowLength(DataRow(n));
+		if (endRows)
+			len += rowSeparatorLen;
+
+		if (n % SQLRESULT_COPY_CHECK_ROWS == 0 && CheckCancel())
+			return NULL;
+	}
+
+	char *data = (char *)malloc(len + 1);
+	if (!data)
+		return NULL;
+
+	char *p = data;
+	memcpy(p, header, headerLen);
+	p += headerLen;
+
+	for (n = 0 ; n < count ; n++)
+	{
+		p = AppendRow(p, DataRow(n));
+
+		if ((n + 1) % SQLRESULT_COPY_CHECK_ROWS == 0)
+		{
+			wxCriticalSectionLocker lock(progressLock);
+			done = n + 1;
+			if (cancelled)
+			{
+				free(data);
+				return NULL;
+			}
+		}
+	}
+	*p = 0;
+
+	text = wxString(data, set->GetConversion(), len);
+	if (text.IsEmpty() && len)
+		ConvertRows(data);
+	free(data);
+
+	wxCriticalSectionLocker lock(progressLock);
+	done = count;
+	return NULL;
+}
+
+
+// The text could not be converted as a whole, so at least the rows that
+// can be are kept; the cells of the grid are converted one by one as well.
+void sqlResultCopy::ConvertRows(const char *data)
+{
+	long n, count = GetRowCount();
+	const char *p = data;
+
+	if (headerLen)
+	{
+		text.Append(wxString(p, set->GetConversion(), headerLen));
+		p += headerLen;
+	}
+
+	for (n = 0 ; n < count ; n++)
+	{
+		size_t len = RowLength(DataRow(n));
+		if (endRows)
+			len += rowSeparatorLen;
+
+		text.Append(wxString(p, set->GetConversion(), len));
+		p += len;
+	}
+}
@@ -0,0 +1,364 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// sqlResultFilter.cpp - Client side filtering of query results
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/thread.h>
+
+// PostgreSQL headers
+#include <libpq-fe.h>
+
+#include "db/pgSet.h"
+#include "ctl/sqlResultSort.h"
+#include "ctl/sqlResultFilter.h"
+
+
+static inline char FoldCase(char c)
+{
+	return (c >= 'A' && c <= 'Z') ? (char)(c + 'a' - 'A') : c;
+}
+
+
+// Only ASCII letters are compared ignoring the case, the values being
+// bytes in the client encoding
+static wxCharBuffer FoldText(const wxString &text, wxMBConv &conv, size_t &len)
+{
+	wxCharBuffer buf = text.mb_str(conv);
+	if (!buf)
+		buf = wxCharBuffer("");
+
+	char *p;
+	for (p = buf.data() ; *p ; p++)
+		*p = FoldCase(*p);
+
+	len = strlen(buf);
+	return buf;
+}
+
+
+sqlResultFilter::sqlResultFilter(pgSet *_set, wxEvtHandler *_caller, long _eventId, int _seq)
+	: wxThread(wxTHREAD_JOINABLE)
+{
+	set = _set;
+	caller = _caller;
+	eventId = _eventId;
+	seq = _seq;
+
+	op = SQLFILTER_TEXT;
+	col = -1;
+	typClass = PGTYPCLASS_STRING;
+	literalLen = 0;
+	literalKey = 0;
+	literalKeyValid = false;
+
+	matches = NULL;
+	matchCount = 0;
+	cancelled = false;
+}
+
+
+sqlResultFilter::~sqlResultFilter()
+{
+	if (matches)
+		delete[] matches;
+}
+
+
+void sqlResultFilter::Parse(const wxString &text)
+{
+	if (!ParseCondition(text))
+	{
+		op = SQLFILTER_TEXT;
+		col = -1;
+		literal = FoldText(text, set->GetConversion(), literalLen);
+	}
+}
+
+
+// A condition needs a column of the result on the left; anything else is
+// searched for as text
+bool sqlResultFilter::ParseCondition(const wxString &text)
+{
+	wxString rest = text.Strip(wxString::both);
+	wxString name;
+	bool quoted = false;
+	size_t len = 0;
+
+	if (rest.StartsWith(wxT("\"")))
+	{
+		// "Quoted ""identifier"""
+		quoted = true;
+		for (len = 1 ; len < rest.Length() ; len++)
+		{
+			wxChar c = rest.GetChar(len);
+			if (c == '"')
+			{
+				if (len + 1 < rest.Length() && rest.GetChar(len + 1) == '"')
+					len++;
+				else
+					break;
+			}
+			name += c;
+		}
+		if (len >= rest.Length())
+			return false;
+		len++;
+	}
+	else
+	{
+		while (len < rest.Length())
+		{
+			wxChar c = rest.GetChar(len);
+			if (!wxIsalnum(c) && c != '_' && c != '$')
+				break;
+			len++;
+		}
+		name = rest.Left(len);
+	}
+	if (name.IsEmpty())
+		return false;
+
+	rest = rest.Mid(len).Strip(wxString::leading);
+
+	wxString value;
+	if (rest.Upper().StartsWith(wxT("IS ")))
+	{
+		value = rest.Mid(3).Strip(wxString::both).Upper();
+		if (value == wxT("NULL"))
+			op = SQLFILTER_ISNULL;
+		else if (value == wxT("NOT NULL"))
+			op = SQLFILTER_NOTNULL;
+		else
+			return false;
+		value = wxEmptyString;
+	}
+	else
+	{
+		static const struct
+		{
+			const wxChar *text;
+			int op;
+		} operators[] =
+		{
+			{ wxT("<="), SQLFILTER_LE },
+			{ wxT(">="), SQLFILTER_GE },
+			{ wxT("<>"), SQLFILTER_NE },
+			{ wxT("!="), SQLFILTER_NE },
+			{ wxT("="), SQLFILTER_EQ },
+			{ wxT("<"), SQLFILTER_LT },
+			{ wxT(">"), SQLFILTER_GT },
+			{ wxT("~"), SQLFILTER_CONTAINS },
+			{ NULL, 0 }
+		};
+
+		int i;
+		for (i = 0 ; operators[i].text ; i++)
+		{
+			if (rest.StartsWith(operators[i].text))
+				break;
+		}
+		if (!operators[i].text)
+			return false;
+
+		op = operators[i].op;
+		value = rest.Mid(wxStrlen(operators[i].text)).Strip(wxString::both);
+
+		// 'Literal' with doubled quotes, or the bare rest of the text
+		if (value.StartsWith(wxT("'")))
+		{
+			if (value.Length() < 2 || !value.EndsWith(wxT("'")))
+				return false;
+			value = value.Mid(1, value.Length() - 2);
+			value.Replace(wxT("''"), wxT("'"));
+		}
+		else if (value.IsEmpty())
+			return false;
+	}
+
+	int c;
+	col = -1;
+	for (c = 0 ; c < set->NumCols() && col < 0 ; c++)
+	{
+		if (quoted ? set->ColName(c) == name : !set->ColName(c).CmpNoCase(name))
+			col = c;
+	}
+	if (col < 0)
+		return false;
+
+	typClass = set->ColTypClass(col);
+
+	if (op == SQLFILTER_CONTAINS)
+		literal = FoldText(value, set->GetConversion(), literalLen);
+	else
+	{
+		literal = value.mb_str(set->GetConversion());
+		if (!literal)
+			literal = wxCharBuffer("");
+		literalLen = strlen(literal);
+		literalKeyValid = sqlResultSort::ParseKey(typClass, literal, literalKey);
+	}
+
+	return true;
+}
+
+
+void sqlResultFilter::Cancel()
+{
+	wxCriticalSectionLocker lock(cancelLock);
+	cancelled = true;
+}
+
+
+bool sqlResultFilter::CheckCancel()
+{
+	wxCriticalSectionLocker lock(cancelLock);
+	return cancelled;
+}
+
+
+void *sqlResultFilter::Entry()
+{
+	long row, nRows = set->NumRows();
+
+	matches = new char[nRows > 0 ? nRows : 1];
+	memset(matches, 0, nRows);
+
+	if (op == SQLFILTER_TEXT)
+	{
+		int c;
+		for (c = 0 ; c < set->NumCols() ; c++)
+		{
+			if (!ScanColumn(c))
+				break;
+		}
+	}
+	else
+		ScanColumn(col);
+
+	matchCount = 0;
+	for (row = 0 ; row < nRows ; row++)
+	{
+		if (matches[row])
+			matchCount++;
+	}
+
+	wxCommandEvent ev(wxEVT_COMMAND_MENU_SELECTED, eventId);
+	ev.SetInt(seq);
+	caller->AddPendingEvent(ev);
+
+	return NULL;
+}
+
+
+char *sqlResultFilter::TakeMatches()
+{
+	char *m = matches;
+	matches = NULL;
+	return m;
+}
+
+
+// Look at the values of one column in all results of the set
+bool sqlResultFilter::ScanColumn(int c)
+{
+	size_t n, count = set->GetResultCount();
+	long scanned = 0;
+
+	for (n = 0 ; n < count ; n++)
+	{
+		long firstRow;
+		PGresult *res = set->GetResult(n, firstRow);
+		int row, rows = PQntuples(res);
+		char *match = matches + firstRow;
+
+		for (row = 0 ; row < rows ; row++)
+		{
+			bool isNull = PQgetisnull(res, row, c) != 0;
+
+			switch (op)
+			{
+				case SQLFILTER_TEXT:
+					if (!match[row] && !isNull && ContainsText(PQgetvalue(res, row, c)))
+						match[row] = 1;
+					break;
+				case SQLFILTER_ISNULL:
+					match[row] = isNull;
+					break;
+				case SQLFILTER_NOTNULL:
+					match[row] = !isNull;
+					break;
+				default:
+					match[row] = !isNull && MatchValue(PQgetvalue(res, row, c));
+					break;
+			}
+
+			if (++scanned % SQLRESULT_FILTER_CHECK_ROWS == 0 && CheckCancel())
+				return false;
+		}
+	}
+
+	return !CheckCancel();
+}
+
+
+bool sqlResultFilter::MatchValue(const char *value) const
+{
+	if (op == SQLFILTER_CONTAINS)
+		return ContainsText(value);
+
+	int cmp;
+	double key;
+	if (literalKeyValid && sqlResultSort::ParseKey(typClass, value, key))
+		cmp = key < literalKey ? -1 : (key > literalKey ? 1 : 0);
+	else
+		cmp = strcmp(value, literal);
+
+	switch (op)
+	{
+		case SQLFILTER_EQ:
+			return cmp == 0;
+		case SQLFILTER_NE:
+			return cmp != 0;
+		case SQLFILTER_LT:
+			return cmp < 0;
+		case SQLFILTER_LE:
+			return cmp <= 0;
+		case SQLFILTER_GT:
+			return cmp > 0;
+		case SQLFILTER_GE:
+			return cmp >= 0;
+	}
+	return false;
+}
+
+
+bool sqlResultFilter::ContainsText(const char *value) const
+{
+	const char *needle = literal;
+
+	if (!literalLen)
+		return true;
+
+	for ( ; *value ; value++)
+	{
+		if (FoldCase(*value) != needle[0])
+			continue;
+
+		size_t i = 1;
+		while (i < literalLen && value[i] && FoldCase(value[i]) == needle[i])
+			i++;
+		if (i == literalLen)
+			return true;
+	}
+	return false;
+}
@@ -0,0 +1,652 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// sqlResultSort.cpp - Client side sorting of query results
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/thread.h>
+
+#include <math.h>
+
+#include "db/pgSet.h"
+#include "ctl/sqlResultSort.h"
+
+// Ranges this short are sorted by insertion
+#define SQLRESULT_SORT_RUN  16
+
+
+static bool ParseDigits(const char *&p, long &value)
+{
+	if (*p < '0' || *p > '9')
+		return false;
+
+	value = 0;
+	while (*p >= '0' && *p <= '9')
+		value = value * 10 + (*p++ - '0');
+	return true;
+}
+
+
+// Numbers as sent by the server: [-]digits[.digits][e[+-]digits], NaN and
+// [-]Infinity. Up to 18 significant digits are used.
+static bool ParseNumber(const char *p, double &value)
+{
+	bool negative = false;
+	if (*p == '-' || *p == '+')
+		negative = (*p++ == '-');
+
+	if (!strcmp(p, "Infinity") || !strcmp(p, "NaN"))
+	{
+		// NaN is greater than all other numbers in PostgreSQL
+		value = negative ? -HUGE_VAL : HUGE_VAL;
+		return true;
+	}
+
+	wxUint64 mantissa = 0;
+	int significant = 0, scale = 0;
+	bool digits = false;
+
+	while (*p >= '0' && *p <= '9')
+	{
+		if (significant < 18)
+		{
+			mantissa = mantissa * 10 + (*p - '0');
+			if (mantissa)
+				significant++;
+		}
+		else
+			scale++;
+		digits = true;
+		p++;
+	}
+	if (*p == '.')
+	{
+		p++;
+		while (*p >= '0' && *p <= '9')
+		{
+			if (significant < 18)
+			{
+				mantissa = mantissa * 10 + (*p - '0');
+				if (mantissa)
+					significant++;
+				scale--;
+			}
+			digits = true;
+			p++;
+		}
+	}
+	if (!digits)
+		return false;
+
+	if (*p == 'e' || *p == 'E')
+	{
+		p++;
+		bool negativeExp = false;
+		if (*p == '-' || *p == '+')
+			negativeExp = (*p++ == '-');
+
+		long exponent;
+		if (!ParseDigits(p, exponent))
+			return false;
+		scale += negativeExp ? -exponent : exponent;
+	}
+	if (*p)
+		return false;
+
+	// Equal values written differently (1.5, 1.50) get the same key
+	while (mantissa && mantissa % 10 == 0)
+	{
+		mantissa /= 10;
+		scale++;
+	}
+
+	value = (double)(wxInt64)mantissa;
+	if (scale > 0)
+		value *= pow(10.0, scale);
+	else if (scale < 0)
+		value /= pow(10.0, -scale);
+	if (negative)
+		value = -value;
+	return true;
+}
+
+
+// [+-]HH:MM[:SS[.fraction]]; in intervals, the hours may exceed a day
+static bool ParseTime(const char *&p, double &seconds)
+{
+	double sign = 1;
+	if (*p == '-' || *p == '+')
+		sign = (*p++ == '-') ? -1 : 1;
+
+	long hours, minutes, secs = 0;
+	if (!ParseDigits(p, hours) || *p != ':')
+		return false;
+	p++;
+	if (!ParseDigits(p, minutes))
+		return false;
+
+	double fraction = 0;
+	if (*p == ':')
+	{
+		p++;
+		if (!ParseDigits(p, secs))
+			return false;
+		if (*p == '.')
+		{
+			double digit = 0.1;
+			for (p++ ; *p >= '0' && *p <= '9' ; p++)
+			{
+				fraction += (*p - '0') * digit;
+				digit /= 10;
+			}
+		}
+	}
+
+	seconds = sign * (hours * 3600.0 + minutes * 60.0 + secs + fraction);
+	return true;
+}
+
+
+// Time zone offset [+-]HH[:MM[:SS]], which turns the time into UTC
+static bool ParseZone(const char *&p, double &seconds)
+{
+	if (*p != '+' && *p != '-')
+		return true;
+
+	double sign = (*p++ == '-') ? -1 : 1;
+	long hours, minutes = 0, secs = 0;
+
+	if (!ParseDigits(p, hours))
+		return false;
+	if (*p == ':')
+	{
+		p++;
+		if (!ParseDigits(p, minutes))
+			return false;
+		if (*p == ':')
+		{
+			p++;
+			if (!ParseDigits(p, secs))
+				return false;
+		}
+	}
+
+	seconds -= sign * (hours * 3600.0 + minutes * 60.0 + secs);
+	return true;
+}
+
+
+// Days since 1970-01-01 of a (proleptic Gregorian) date
+static double DaysFromCivil(long year, long month, long day)
+{
+	if (month <= 2)
+		year--;
+	long era = (year >= 0 ? year : year - 399) / 400;
+	long yoe = year - era * 400;
+	long doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+	long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+	return era * 146097.0 + doe - 719468;
+}
+
+
+// Intervals in the postgres IntervalStyle, e.g. "1 year 2 mons -3 days
+// 04:05:06". Months count 30 days, as when the server compares intervals.
+static bool ParseInterval(const char *p, const char *end, double &value)
+{
+	double months = 0, days = 0, seconds = 0;
+	bool any = false;
+
+	while (p < end)
+	{
+		if (*p == ' ')
+		{
+			p++;
+			continue;
+		}
+
+		const char *time = p;
+		double timeSeconds;
+		if (ParseTime(time, timeSeconds))
+		{
+			seconds += timeSeconds;
+			p = time;
+			any = true;
+			continue;
+		}
+
+		double sign = 1;
+		if (*p == '-' || *p == '+')
+			sign = (*p++ == '-') ? -1 : 1;
+
+		long count;
+		if (!ParseDigits(p, count) || *p != ' ')
+			return false;
+		p++;
+
+		if (!strncmp(p, "year", 4))
+			months += sign * count * 12;
+		else if (!strncmp(p, "mon", 3))
+			months += sign * count;
+		else if (!strncmp(p, "day", 3))
+			days += sign * count;
+		else
+			return false;
+
+		while (p < end && *p >= 'a' && *p <= 'z')
+			p++;
+		any = true;
+	}
+
+	if (!any)
+		return false;
+
+	value = (months * 30 + days) * 86400 + seconds;
+	return true;
+}
+
+
+// Dates, timestamps (with time zone), times of day and intervals, as the
+// server sends them in the ISO DateStyle. The key is a number of seconds.
+static bool ParseDateTime(const char *value, double &key)
+{
+	if (!strcmp(value, "infinity"))
+	{
+		key = HUGE_VAL;
+		return true;
+	}
+	if (!strcmp(value, "-infinity"))
+	{
+		key = -HUGE_VAL;
+		return true;
+	}
+
+	const char *end = value + strlen(value);
+	bool bc = false;
+	if (end - value > 3 && !strcmp(end - 3, " BC"))
+	{
+		bc = true;
+		end -= 3;
+	}
+
+	const char *p = value;
+	long year, month, day;
+	if (ParseDigits(p, year) && p - value >= 4 && *p == '-')
+	{
+		p++;
+		if (!ParseDigits(p, month) || *p != '-')
+			return false;
+		p++;
+		if (!ParseDigits(p, day))
+			return false;
+
+		if (bc)
+			year = 1 - year;
+		key = DaysFromCivil(year, month, day) * 86400;
+
+		if (*p == ' ' || *p == 'T')
+		{
+			p++;
+			double seconds;
+			if (!ParseTime(p, seconds) || !ParseZone(p, seconds))
+				return false;
+			key += seconds;
+		}
+		return p == end;
+	}
+
+	p = value;
+	double seconds;
+	if (ParseTime(p, seconds) && ParseZone(p, seconds) && p == end)
+	{
+		key = seconds;
+		return true;
+	}
+
+	return ParseInterval(value, end, key);
+}
+
+
+// The first eight bytes of a text, so that most comparisons don't need to
+// look at the text itself
+static wxUint64 TextPrefix(const char *text)
+{
+	wxUint64 prefix = 0;
+	int i;
+	for (i = 0 ; i < 8 ; i++)
+	{
+		prefix <<= 8;
+		if (*text)
+			prefix |= (unsigned char)*text++;
+	}
+	return prefix;
+}
+
+
+// The sort keys of all rows of a column
+class sqlResultSortKeys
+{
+public:
+	sqlResultSortKeys(pgSet *_set, int _col, int _typClass, bool ascending)
+	{
+		set = _set;
+		col = _col;
+		typClass = _typClass;
+		direction = ascending ? 1 : -1;
+
+		long rows = set->NumRows();
+		nulls = new char[rows];
+		numbers = NULL;
+		prefixes = NULL;
+		texts = NULL;
+
+		switch (typClass)
+		{
+			case PGTYPCLASS_NUMERIC:
+			case PGTYPCLASS_BOOL:
+			case PGTYPCLASS_DATE:
+				numbers = new double[rows];
+				break;
+			default:
+				UseText();
+				break;
+		}
+	}
+
+	~sqlResultSortKeys()
+	{
+		delete[] nulls;
+		delete[] numbers;
+		delete[] prefixes;
+		delete[] texts;
+	}
+
+	// Compare the values as text, after some couldn't be parsed
+	void UseText()
+	{
+		long rows = set->NumRows();
+
+		delete[] numbers;
+		numbers = NULL;
+		typClass = PGTYPCLASS_STRING;
+		prefixes = new wxUint64[rows];
+		texts = new const char *[rows];
+	}
+
+	// Parse the values of a range of rows. Fails, if a value doesn't have
+	// the format of its type class.
+	bool Build(long from, long to)
+	{
+		long row;
+		for (row = from ; row < to ; row++)
+		{
+			nulls[row] = set->IsNullAt(row, col);
+			if (nulls[row])
+				continue;
+
+			const char *value = set->GetValueAt(row, col);
+			if (numbers)
+			{
+				if (!sqlResultSort::ParseKey(typClass, value, numbers[row]))
+					return false;
+			}
+			else
+			{
+				prefixes[row] = TextPrefix(value);
+				texts[row] = value;
+			}
+		}
+		return true;
+	}
+
+	// Never 0 for different rows; equal values are ordered by row number
+	int Compare(long a, long b) const
+	{
+		if (nulls[a] != nulls[b])
+			return nulls[a] ? direction : -direction;
+
+		if (!nulls[a])
+		{
+			if (numbers)
+			{
+				if (numbers[a] < numbers[b])
+					return -direction;
+				if (numbers[a] > numbers[b])
+					return direction;
+			}
+			else
+			{
+				if (prefixes[a] != prefixes[b])
+					return prefixes[a] < prefixes[b] ? -direction : direction;
+
+				int cmp = strcmp(texts[a], texts[b]);
+				if (cmp)
+					return cmp < 0 ? -direction : direction;
+			}
+		}
+
+		return a < b ? -1 : (a > b ? 1 : 0);
+	}
+
+private:
+	pgSet *set;
+	int col, typClass, direction;
+
+	char *nulls;
+	double *numbers;
+	wxUint64 *prefixes;
+	const char **texts;
+};
+
+
+static void Merge(const sqlResultSortKeys &keys, const long *a, long countA, const long *b, long countB, long *out)
+{
+	const long *endA = a + countA, *endB = b + countB;
+
+	while (a < endA && b < endB)
+	{
+		if (keys.Compare(*b, *a) < 0)
+			*out++ = *b++;
+		else
+			*out++ = *a++;
+	}
+	while (a < endA)
+		*out++ = *a++;
+	while (b < endB)
+		*out++ = *b++;
+}
+
+
+// Merge sort of a range of the permutation, using the same range of temp
+static void SortRange(const sqlResultSortKeys &keys, long *rows, long *temp, long count)
+{
+	if (count <= SQLRESULT_SORT_RUN)
+	{
+		long i, j;
+		for (i = 1 ; i < count ; i++)
+		{
+			long row = rows[i];
+			for (j = i ; j > 0 && keys.Compare(row, rows[j - 1]) < 0 ; j--)
+				rows[j] = rows[j - 1];
+			rows[j] = row;
+		}
+		return;
+	}
+
+	long half = count / 2;
+	SortRange(keys, rows, temp, half);
+	SortRange(keys, rows + half, temp + half, count - half);
+
+	// Already in order, which is common for data sorted by the server
+	if (keys.Compare(rows[half - 1], rows[half]) < 0)
+		return;
+
+	Merge(keys, rows, half, rows + half, count - half, temp);
+	memcpy(rows, temp, count * sizeof(long));
+}
+
+
+static bool SortPart(sqlResultSortKeys &keys, long *rows, long *temp, long from, long to)
+{
+	if (!keys.Build(from, to))
+		return false;
+
+	SortRange(keys, rows + from, temp + from, to - from);
+	return true;
+}
+
+
+// Parses the keys of a part of the rows, and sorts these
+class sqlResultSortThread : public wxThread
+{
+public:
+	sqlResultSortThread(sqlResultSortKeys *_keys, long *_rows, long *_temp, long _from, long _to)
+		: wxThread(wxTHREAD_JOINABLE)
+	{
+		keys = _keys;
+		rows = _rows;
+		temp = _temp;
+		from = _from;
+		to = _to;
+		succeeded = false;
+	}
+
+	void *Entry()
+	{
+		succeeded = SortPart(*keys, rows, temp, from, to);
+		return NULL;
+	}
+
+	bool Succeeded()
+	{
+		return succeeded;
+	}
+
+private:
+	sqlResultSortKeys *keys;
+	long *rows, *temp;
+	long from, to;
+	bool succeeded;
+};
+
+
+// Sort the parts between the bounds, each in a thread of its own
+static bool SortParts(sqlResultSortKeys &keys, long *rows, long *temp, const wxArrayLong &bounds)
+{
+	wxArrayPtrVoid threads;
+	bool ok = true;
+	size_t part;
+
+	for (part = 0 ; part + 1 < bounds.GetCount() ; part++)
+	{
+		long from = bounds.Item(part), to = bounds.Item(part + 1);
+		sqlResultSortThread *thread = NULL;
+
+		if (bounds.GetCount() > 2)
+		{
+			thread = new sqlResultSortThread(&keys, rows, temp, from, to);
+			if (thread->Create() != wxTHREAD_NO_ERROR || thread->Run() != wxTHREAD_NO_ERROR)
+			{
+				delete thread;
+				thread = NULL;
+			}
+		}
+
+		if (thread)
+			threads.Add(thread);
+		else if (!SortPart(keys, rows, temp, from, to))
+			ok = false;
+	}
+
+	for (part = 0 ; part < threads.GetCount() ; part++)
+	{
+		sqlResultSortThread *thread = (sqlResultSortThread *)threads.Item(part);
+		thread->Wait();
+		if (!thread->Succeeded())
+			ok = false;
+		delete thread;
+	}
+
+	return ok;
+}
+
+
+bool sqlResultSort::ParseKey(int typClass, const char *value, double &key)
+{
+	switch (typClass)
+	{
+		case PGTYPCLASS_NUMERIC:
+			return ParseNumber(value, key);
+		case PGTYPCLASS_BOOL:
+			key = (*value == 't');
+			return true;
+		case PGTYPCLASS_DATE:
+			return ParseDateTime(value, key);
+		default:
+			return false;
+	}
+}
+
+
+long *sqlResultSort::Sort(pgSet *set, int col, int typClass, bool ascending)
+{
+	long row, nRows = set->NumRows();
+	long *rows = new long[nRows];
+	long *temp = new long[nRows];
+
+	int parts = 1;
+	if (nRows >= SQLRESULT_PARALLEL_SORT_ROWS)
+		parts = wxMax(1, wxMin(wxThread::GetCPUCount(), SQLRESULT_SORT_MAX_THREADS));
+
+	wxArrayLong bounds;
+	int part;
+	for (part = 0 ; part <= parts ; part++)
+		bounds.Add((long)((wxLongLong)nRows * part / parts).GetValue());
+
+	sqlResultSortKeys keys(set, col, typClass, ascending);
+
+	for (row = 0 ; row < nRows ; row++)
+		rows[row] = row;
+
+	if (!SortParts(keys, rows, temp, bounds))
+	{
+		// Some value doesn't look like its type, e.g. with another DateStyle
+		keys.UseText();
+		for (row = 0 ; row < nRows ; row++)
+			rows[row] = row;
+		SortParts(keys, rows, temp, bounds);
+	}
+
+	// Merge the sorted parts pairwise, until there's just one
+	while (bounds.GetCount() > 2)
+	{
+		wxArrayLong merged;
+		size_t i;
+
+		merged.Add(0);
+		for (i = 0 ; i + 2 < bounds.GetCount() ; i += 2)
+		{
+			long from = bounds.Item(i), middle = bounds.Item(i + 1), to = bounds.Item(i + 2);
+
+			Merge(keys, rows + from, middle - from, rows + middle, to - middle, temp + from);
+			memcpy(rows + from, temp + from, (to - from) * sizeof(long));
+			merged.Add(to);
+		}
+		if (i + 1 < bounds.GetCount())
+			merged.Add(bounds.Item(i + 1));
+
+		bounds = merged;
+	}
+
+	delete[] temp;
+	return rows;
+}
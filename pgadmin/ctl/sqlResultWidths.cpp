@@ -0,0 +1,251 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// sqlResultWidths.cpp - Estimating the widths of query result columns
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/thread.h>
+#include <wx/hashmap.h>
+
+#include "db/pgSet.h"
+#include "ctl/sqlResultWidths.h"
+#include "utils/sysSettings.h"
+
+
+WX_DECLARE_STRING_HASH_MAP(sqlResultGlyphWidths, sqlResultGlyphWidthsMap);
+
+// Measured fonts, by their description
+static sqlResultGlyphWidthsMap glyphWidthsCache;
+
+
+sqlResultGlyphWidths::sqlResultGlyphWidths()
+{
+	memset(advances, 0, sizeof(advances));
+	otherAdvance = 0;
+}
+
+
+const sqlResultGlyphWidths &sqlResultGlyphWidths::Get(wxWindow *wnd, const wxFont &font)
+{
+	wxString key = font.GetNativeFontInfoDesc();
+
+	sqlResultGlyphWidthsMap::iterator it = glyphWidthsCache.find(key);
+	if (it != glyphWidthsCache.end())
+		return it->second;
+
+	sqlResultGlyphWidths &glyphs = glyphWidthsCache[key];
+
+	wxClientDC dc(wnd);
+	dc.SetFont(font);
+
+	wxCoord w, h;
+	unsigned int c;
+	for (c = ' ' ; c < 127 ; c++)
+	{
+		dc.GetTextExtent(wxString((wxChar)c), &w, &h);
+		glyphs.advances[c] = w;
+	}
+	// Control characters are shown like spaces, if at all
+	for (c = 0 ; c < ' ' ; c++)
+		glyphs.advances[c] = glyphs.advances[(unsigned int)' '];
+	glyphs.advances[127] = glyphs.advances[(unsigned int)' '];
+	glyphs.otherAdvance = glyphs.advances[(unsigned int)'M'];
+
+	return glyphs;
+}
+
+
+int sqlResultGlyphWidths::TextWidth(const wxString &text) const
+{
+	int width = 0;
+	size_t i;
+	for (i = 0 ; i < text.Length() ; i++)
+		width += Advance((unsigned int)text.GetChar(i));
+	return width;
+}
+
+
+sqlResultWidths::sqlResultWidths(pgSet *_set, const sqlResultGlyphWidths &_glyphs, const wxArrayLong &_typClasses)
+	: glyphs(_glyphs), typClasses(_typClasses)
+{
+	set = _set;
+	utf8 = (&set->GetConversion() == &wxConvUTF8);
+
+	indicateNull = settings->GetIndicateNull();
+	maxColSize = (size_t)settings->GetMaxColSize();
+	nullWidth = glyphs.TextWidth(wxT("<NULL>"));
+	separatorWidth = glyphs.TextWidth(settings->GetThousandsSeparator());
+	ellipsisWidth = glyphs.TextWidth(wxT(" (...)"));
+}
+
+
+int sqlResultWidths::CellWidth(long row, int col) const
+{
+	if (set->IsNullAt(row, col))
+		return indicateNull ? nullWidth : 0;
+
+	bool numeric = col < (int)typClasses.GetCount() && typClasses.Item(col) == PGTYPCLASS_NUMERIC;
+	return TextWidth(set->GetValueAt(row, col), numeric);
+}
+
+
+int sqlResultWidths::ColumnWidth(int col, long from, long to) const
+{
+	int width = 0;
+	long row;
+	for (row = from ; row < to ; row++)
+	{
+		int w = CellWidth(row, col);
+		if (w > width)
+			width = w;
+	}
+	return width;
+}
+
+
+// Numbers get thousands separators and are never cut short, other values
+// are cut after maxColSize characters. Of several lines, the widest one
+// counts.
+int sqlResultWidths::TextWidth(const char *value, bool numeric) const
+{
+	bool separators = numeric && separatorWidth > 0;
+	int width = 0, lineWidth = 0, digits = 0;
+	bool integral = true;
+	size_t chars = 0;
+
+	const unsigned char *p;
+	for (p = (const unsigned char *)value ; *p ; p++)
+	{
+		// Continuation bytes of UTF-8 characters
+		if (utf8 && (*p & 0xC0) == 0x80)
+			continue;
+
+		if (!separators && chars == maxColSize)
+		{
+			lineWidth += ellipsisWidth;
+			break;
+		}
+		chars++;
+
+		if (*p == '\n')
+		{
+			if (lineWidth > width)
+				width = lineWidth;
+			lineWidth = 0;
+			continue;
+		}
+
+		if (separators)
+		{
+			if (*p >= '0' && *p <= '9')
+			{
+				if (integral)
+					digits++;
+			}
+			else if (*p == '.')
+				integral = false;
+		}
+
+		lineWidth += glyphs.Advance(*p);
+	}
+
+	if (digits > 3)
+		lineWidth += (digits - 1) / 3 * separatorWidth;
+
+	return lineWidth > width ? lineWidth : width;
+}
+
+
+sqlResultWidthThread::sqlResultWidthThread(const sqlResultWidths &widths, int nCols, long from, long to,
+        wxEvtHandler *_caller, long _eventId, int _seq)
+	: wxThread(wxTHREAD_JOINABLE), estimate(widths)
+{
+	firstRow = from;
+	lastRow = to;
+	caller = _caller;
+	eventId = _eventId;
+	seq = _seq;
+	cancelled = false;
+
+	columnWidths.Add(0, nCols);
+}
+
+
+void sqlResultWidthThread::Cancel()
+{
+	wxCriticalSectionLocker lock(widthsLock);
+	cancelled = true;
+}
+
+
+bool sqlResultWidthThread::CheckCancel()
+{
+	wxCriticalSectionLocker lock(widthsLock);
+	return cancelled;
+}
+
+
+void sqlResultWidthThread::GetWidths(wxArrayInt &widths)
+{
+	wxCriticalSectionLocker lock(widthsLock);
+	widths = columnWidths;
+}
+
+
+void sqlResultWidthThread::Notify(bool done)
+{
+	wxCommandEvent ev(wxEVT_COMMAND_MENU_SELECTED, eventId);
+	ev.SetInt(seq);
+	ev.SetExtraLong(done ? 1 : 0);
+	caller->AddPendingEvent(ev);
+}
+
+
+void *sqlResultWidthThread::Entry()
+{
+	long row;
+	int col, nCols = columnWidths.GetCount();
+	wxArrayInt widths;
+
+	for (row = firstRow ; row < lastRow ; row += SQLRESULT_WIDTH_BATCH_ROWS)
+	{
+		long to = wxMin(row + SQLRESULT_WIDTH_BATCH_ROWS, lastRow);
+
+		GetWidths(widths);
+		bool widened = false;
+		for (col = 0 ; col < nCols ; col++)
+		{
+			int w = estimate.ColumnWidth(col, row, to);
+			if (w > widths.Item(col))
+			{
+				widths[col] = w;
+				widened = true;
+			}
+
+			if (CheckCancel())
+				return NULL;
+		}
+
+		if (widened)
+		{
+			{
+				wxCriticalSectionLocker lock(widthsLock);
+				columnWidths = widths;
+			}
+			if (to < lastRow)
+				Notify(false);
+		}
+	}
+
+	Notify(true);
+	return NULL;
+}
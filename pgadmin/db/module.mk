@@ -11,7 +11,15 @@
 
 pgadmin3_SOURCES += \
 	db/keywords.c \
+	db/pgBenchmark.cpp \
+	db/pgCatalogCache.cpp \
 	db/pgConn.cpp \
+	db/pgConnPool.cpp \
+	db/pgExportThread.cpp \
+	db/pgExportWriter.cpp \
+	db/pgFileExecThread.cpp \
+	db/pgLoadTest.cpp \
+	db/pgQueryStats.cpp \
 	db/pgSet.cpp \
 	db/pgQueryThread.cpp
 
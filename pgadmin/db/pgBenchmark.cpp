@@ -0,0 +1,234 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgBenchmark.cpp - Repeated runs of queries, timed
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/thread.h>
+
+#include <math.h>
+
+// App headers
+#include "db/pgConn.h"
+#include "db/pgBenchmark.h"
+#include "ctl/explainPlan.h"
+
+#include <wx/arrimpl.cpp>
+WX_DEFINE_OBJARRAY(pgBenchmarkResultArray);
+
+
+static int CompareTimings(double *a, double *b)
+{
+	return *a < *b ? -1 : *a > *b ? 1 : 0;
+}
+
+
+// Nearest rank of the sorted timings
+static double Percentile(const wxArrayDouble &sorted, double fraction)
+{
+	size_t count = sorted.GetCount();
+	if (!count)
+		return 0;
+
+	size_t rank = (size_t)ceil(fraction * count);
+	if (rank < 1)
+		rank = 1;
+	if (rank > count)
+		rank = count;
+
+	return sorted.Item(rank - 1);
+}
+
+
+pgBenchmarkSummary::pgBenchmarkSummary(const wxArrayDouble &timings)
+{
+	wxArrayDouble sorted;
+	size_t i;
+	for (i = 0 ; i < timings.GetCount() ; i++)
+	{
+		if (timings.Item(i) >= 0)
+			sorted.Add(timings.Item(i));
+	}
+	sorted.Sort(CompareTimings);
+
+	count = sorted.GetCount();
+	min = count ? sorted.Item(0) : 0;
+	max = count ? sorted.Item(count - 1) : 0;
+	median = Percentile(sorted, 0.5);
+	p95 = Percentile(sorted, 0.95);
+
+	double sum = 0;
+	for (i = 0 ; i < count ; i++)
+		sum += sorted.Item(i);
+	mean = count ? sum / count : 0;
+}
+
+
+pgBenchmarkThread::pgBenchmarkThread(pgConn *_conn, const wxArrayString &_queries, long _runs, long _warmups,
+                                     bool _serverTimings, wxEvtHandler *_caller, long _eventId, int _seq)
+	: wxThread(wxTHREAD_JOINABLE)
+{
+	conn = _conn;
+	queries = _queries;
+	runs = _runs;
+	warmups = _warmups;
+	serverTimings = _serverTimings;
+	caller = _caller;
+	eventId = _eventId;
+	seq = _seq;
+	runsDone = 0;
+	cancelled = false;
+
+	size_t i;
+	for (i = 0 ; i < queries.GetCount() ; i++)
+	{
+		pgBenchmarkResult result;
+		result.query = queries.Item(i);
+		results.Add(result);
+	}
+}
+
+
+void pgBenchmarkThread::Cancel()
+{
+	{
+		wxCriticalSectionLocker lock(resultsLock);
+		cancelled = true;
+	}
+	conn->CancelExecution();
+}
+
+
+bool pgBenchmarkThread::CheckCancel()
+{
+	wxCriticalSectionLocker lock(resultsLock);
+	return cancelled;
+}
+
+
+long pgBenchmarkThread::GetRunsDone()
+{
+	wxCriticalSectionLocker lock(resultsLock);
+	return runsDone;
+}
+
+
+void pgBenchmarkThread::GetResults(pgBenchmarkResultArray &_results)
+{
+	wxCriticalSectionLocker lock(resultsLock);
+
+	// Deep copies; the strings are shared otherwise
+	_results.Empty();
+	size_t i;
+	for (i = 0 ; i < results.GetCount() ; i++)
+	{
+		pgBenchmarkResult result = results.Item(i);
+		result.query = wxString(results.Item(i).query.c_str());
+		result.lastError = wxString(results.Item(i).lastError.c_str());
+		_results.Add(result);
+	}
+}
+
+
+void pgBenchmarkThread::Notify(bool done)
+{
+	wxCommandEvent ev(wxEVT_COMMAND_MENU_SELECTED, eventId);
+	ev.SetInt(seq);
+	ev.SetExtraLong(done ? 1 : 0);
+	caller->AddPendingEvent(ev);
+}
+
+
+// Planning and execution time of the query as EXPLAIN ANALYZE reports them,
+// without the overhead of timing every node. EXPLAIN ANALYZE runs the query
+// once more, so that is rolled back to not repeat what it changes.
+bool pgBenchmarkThread::ServerTimings(const wxString &query, double &planning, double &execution)
+{
+	bool inTransaction = conn->GetTxStatus() != PGCONN_TXSTATUS_IDLE;
+	if (!conn->ExecuteVoid(inTransaction ? wxT("SAVEPOINT pgadmin_benchmark") : wxT("BEGIN"), false))
+		return false;
+
+	wxString json = conn->ExecuteScalar(wxT("EXPLAIN (ANALYZE, TIMING off, FORMAT JSON) ") + query, false);
+
+	conn->ExecuteVoid(inTransaction ? wxT("ROLLBACK TO SAVEPOINT pgadmin_benchmark") : wxT("ROLLBACK"), false);
+	if (inTransaction)
+		conn->ExecuteVoid(wxT("RELEASE SAVEPOINT pgadmin_benchmark"), false);
+
+	ExplainPlan plan;
+	if (!plan.Parse(json) || !plan.GetPlanCount())
+		return false;
+
+	planning = plan.GetPlanningTime(0);
+	execution = plan.GetExecutionTime(0);
+	return true;
+}
+
+
+void *pgBenchmarkThread::Entry()
+{
+	wxLongLong lastNotify = wxGetLocalTimeMillis();
+	long run;
+	size_t q;
+
+	// The connection is ours until the runs are done
+	conn->LockExecution();
+
+	for (run = 0 ; run < runs + warmups && !CheckCancel() ; run++)
+	{
+		for (q = 0 ; q < queries.GetCount() && !CheckCancel() ; q++)
+		{
+			// Only the round trip is timed, not the statistics and logging
+			double latency = 0;
+			bool ok = conn->ExecuteVoid(queries.Item(q), false, &latency);
+
+			double planning = -1, execution = -1;
+			bool timed = ok && run >= warmups;
+			if (timed && serverTimings && !CheckCancel())
+				ServerTimings(queries.Item(q), planning, execution);
+
+			wxCriticalSectionLocker lock(resultsLock);
+			pgBenchmarkResult &result = results.Item(q);
+
+			runsDone++;
+			if (!ok)
+			{
+				// A cancelled run is no error of the query
+				if (!cancelled)
+				{
+					result.errors++;
+					result.lastError = conn->GetLastError();
+				}
+			}
+			else if (timed)
+			{
+				result.latencies.Add(latency);
+				// Kept in step with the latencies, known or not
+				if (serverTimings)
+				{
+					result.planningTimes.Add(planning);
+					result.executionTimes.Add(execution);
+				}
+			}
+		}
+
+		if (wxGetLocalTimeMillis() - lastNotify >= PGBENCHMARK_PROGRESS_INTERVAL)
+		{
+			lastNotify = wxGetLocalTimeMillis();
+			Notify(false);
+		}
+	}
+
+	conn->UnlockExecution();
+
+	Notify(true);
+	return NULL;
+}
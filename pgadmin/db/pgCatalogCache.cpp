@@ -0,0 +1,670 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgCatalogCache.cpp - Names of a database's objects, for tab completion
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+// App headers
+#include "db/pgConn.h"
+#include "db/pgSet.h"
+#include "db/pgConnPool.h"
+#include "db/pgCatalogCache.h"
+
+// Size of the blocks the names are stored in
+#define PGCATALOGNAMES_BLOCK_SIZE   65536
+
+// Relkinds which have columns to complete
+#define PGCATALOG_COLUMN_KINDS      "rvmfpS"
+
+WX_DECLARE_STRING_HASH_MAP(pgCatalogCache *, pgCatalogCacheHash);
+static pgCatalogCacheHash caches;
+
+static wxWindowID CATALOG_LOADED_ID = ::wxNewId();
+
+
+static int CompareNames(const void *a, const void *b)
+{
+	return strcmp(((const pgCatalogName *)a)->name, ((const pgCatalogName *)b)->name);
+}
+
+
+static int CompareQualified(const void *a, const void *b)
+{
+	const pgCatalogName *x = *(const pgCatalogName **)a;
+	const pgCatalogName *y = *(const pgCatalogName **)b;
+
+	int result = strcmp(x->schema, y->schema);
+	if (!result)
+		result = strcmp(x->qualName, y->qualName);
+	return result;
+}
+
+
+pgCatalogNames::pgCatalogNames()
+{
+	names = NULL;
+	count = allocated = 0;
+	qualified = NULL;
+	schemas = NULL;
+	schemaCount = 0;
+	blockUsed = PGCATALOGNAMES_BLOCK_SIZE;
+}
+
+
+pgCatalogNames::~pgCatalogNames()
+{
+	free(names);
+	free(qualified);
+	free(schemas);
+
+	size_t i;
+	for (i = 0 ; i < blocks.GetCount() ; i++)
+		delete[] (char *)blocks.Item(i);
+}
+
+
+const char *pgCatalogNames::Store(const char *str)
+{
+	size_t len = strlen(str) + 1;
+
+	if (len > PGCATALOGNAMES_BLOCK_SIZE / 4)
+	{
+		// Long names get a block of their own, so as not to waste the rest
+		// of the current one
+		char *block = new char[len];
+		blocks.Insert(block, 0);
+		memcpy(block, str, len);
+		return block;
+	}
+
+	if (blockUsed + len > PGCATALOGNAMES_BLOCK_SIZE)
+	{
+		blocks.Add(new char[PGCATALOGNAMES_BLOCK_SIZE]);
+		blockUsed = 0;
+	}
+
+	char *dest = (char *)blocks.Last() + blockUsed;
+	memcpy(dest, str, len);
+	blockUsed += len;
+	return dest;
+}
+
+
+void pgCatalogNames::Add(const char *name, const char *qualName, const char *schema, OID oid, char kind, bool visible)
+{
+	if (count == allocated)
+	{
+		allocated = allocated ? allocated * 2 : 1024;
+		names = (pgCatalogName *)realloc(names, allocated * sizeof(pgCatalogName));
+	}
+
+	pgCatalogName &item = names[count++];
+	item.name = Store(name);
+	item.qualName = strcmp(qualName, name) ? Store(qualName) : item.name;
+	item.schema = Store(schema);
+	item.oid = oid;
+	item.kind = kind;
+	item.visible = visible;
+}
+
+
+void pgCatalogNames::Finish()
+{
+	if (!count)
+		return;
+
+	qsort(names, count, sizeof(pgCatalogName), CompareNames);
+
+	qualified = (const pgCatalogName **)malloc(count * sizeof(pgCatalogName *));
+	size_t i;
+	for (i = 0 ; i < count ; i++)
+		qualified[i] = names + i;
+	qsort(qualified, count, sizeof(pgCatalogName *), CompareQualified);
+
+	// The schemas, in the order of their names
+	schemas = (const pgCatalogName **)malloc(count * sizeof(pgCatalogName *));
+	for (i = 0 ; i < count ; i++)
+	{
+		if (names[i].kind == PGCATALOG_SCHEMA)
+			schemas[schemaCount++] = names + i;
+	}
+}
+
+
+size_t pgCatalogNames::FindPrefix(const char *prefix, size_t &end) const
+{
+	size_t len = strlen(prefix);
+
+	// The first name not before the prefix...
+	size_t low = 0, high = count;
+	while (low < high)
+	{
+		size_t mid = (low + high) / 2;
+		if (strcmp(names[mid].name, prefix) < 0)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	size_t start = low;
+
+	// ... and the first after all names starting with it
+	high = count;
+	while (low < high)
+	{
+		size_t mid = (low + high) / 2;
+		if (strncmp(names[mid].name, prefix, len) <= 0)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	end = low;
+
+	return start;
+}
+
+
+size_t pgCatalogNames::FindQualifiedPrefix(const char *schema, const char *prefix, size_t &end) const
+{
+	size_t len = strlen(prefix);
+
+	size_t low = 0, high = count;
+	while (low < high)
+	{
+		size_t mid = (low + high) / 2;
+		int result = strcmp(qualified[mid]->schema, schema);
+		if (result < 0 || (!result && strcmp(qualified[mid]->qualName, prefix) < 0))
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	size_t start = low;
+
+	high = count;
+	while (low < high)
+	{
+		size_t mid = (low + high) / 2;
+		int result = strcmp(qualified[mid]->schema, schema);
+		if (result < 0 || (!result && strncmp(qualified[mid]->qualName, prefix, len) <= 0))
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	end = low;
+
+	return start;
+}
+
+
+const pgCatalogName *pgCatalogNames::FindRelation(const char *name) const
+{
+	size_t i, end;
+	for (i = FindPrefix(name, end) ; i < end ; i++)
+	{
+		const pgCatalogName &item = names[i];
+		if (item.visible && !strcmp(item.name, name) && strchr(PGCATALOG_COLUMN_KINDS, item.kind))
+			return &item;
+	}
+	return NULL;
+}
+
+
+// Loads the names on a connection of its own; if given the names loaded
+// before, only the names of some schemas are loaded again
+class pgCatalogLoader : public wxThread
+{
+public:
+	pgCatalogLoader(pgConn *_conn, const wxString &_searchPath, const pgCatalogNames *_previous,
+	                const wxArrayString &_schemas, wxEvtHandler *_caller)
+		: wxThread(wxTHREAD_JOINABLE)
+	{
+		conn = _conn;
+		searchPath = _searchPath;
+		previous = _previous;
+		schemas = _schemas;
+		caller = _caller;
+		result = NULL;
+	}
+
+	void *Entry();
+
+	// Returns NULL if the names couldn't be loaded
+	pgCatalogNames *GetResult()
+	{
+		return result;
+	}
+
+private:
+	pgConn *conn;
+	wxString searchPath;
+	const pgCatalogNames *previous;
+	wxArrayString schemas;
+	wxEvtHandler *caller;
+	pgCatalogNames *result;
+};
+
+
+void *pgCatalogLoader::Entry()
+{
+	// Visibility is as the query tool's search path has it
+	if (!searchPath.IsEmpty())
+		conn->ExecuteVoid(wxT("SET search_path TO ") + searchPath, false);
+
+	wxString schemaFilter;
+	if (previous && schemas.GetCount())
+	{
+		size_t i;
+		for (i = 0 ; i < schemas.GetCount() ; i++)
+		{
+			if (i)
+				schemaFilter += wxT(", ");
+			schemaFilter += conn->qtDbString(schemas.Item(i));
+		}
+		schemaFilter = wxT(" AND n.nspname IN (") + schemaFilter + wxT(")");
+	}
+
+	wxString aggregate = conn->BackendMinimumVersion(11, 0) ? wxT("p.prokind = 'a'") : wxT("p.proisagg");
+
+	wxString sql =
+	    wxT("SELECT c.oid, pg_catalog.quote_ident(c.relname) AS name, pg_catalog.quote_ident(c.relname) AS qualname,\n")
+	    wxT("       pg_catalog.quote_ident(n.nspname) AS nspname, c.relkind::text AS kind,\n")
+	    wxT("       pg_catalog.pg_table_is_visible(c.oid) AS visible\n")
+	    wxT("  FROM pg_catalog.pg_class c JOIN pg_catalog.pg_namespace n ON n.oid = c.relnamespace\n")
+	    wxT(" WHERE c.relkind IN ('r', 'i', 'S', 'v', 'm', 'f', 'p')") + schemaFilter + wxT("\n")
+	    wxT("UNION ALL\n")
+	    wxT("SELECT min(p.oid), pg_catalog.quote_ident(p.proname), pg_catalog.quote_ident(p.proname),\n")
+	    wxT("       pg_catalog.quote_ident(n.nspname), CASE WHEN ") + aggregate + wxT(" THEN 'A' ELSE 'F' END,\n")
+	    wxT("       pg_catalog.bool_or(pg_catalog.pg_function_is_visible(p.oid))\n")
+	    wxT("  FROM pg_catalog.pg_proc p JOIN pg_catalog.pg_namespace n ON n.oid = p.pronamespace\n")
+	    wxT(" WHERE true") + schemaFilter + wxT("\n")
+	    wxT(" GROUP BY 2, 4, 5\n")
+	    wxT("UNION ALL\n")
+	    wxT("SELECT t.oid, pg_catalog.format_type(t.oid, NULL), pg_catalog.quote_ident(t.typname),\n")
+	    wxT("       pg_catalog.quote_ident(n.nspname), CASE WHEN t.typtype = 'd' THEN 'D' ELSE 'T' END,\n")
+	    wxT("       pg_catalog.pg_type_is_visible(t.oid)\n")
+	    wxT("  FROM pg_catalog.pg_type t JOIN pg_catalog.pg_namespace n ON n.oid = t.typnamespace\n")
+	    wxT(" WHERE (t.typrelid = 0 OR (SELECT c.relkind = 'c' FROM pg_catalog.pg_class c WHERE c.oid = t.typrelid))\n")
+	    wxT("   AND t.typname !~ '^_'") + schemaFilter + wxT("\n")
+	    wxT("UNION ALL\n")
+	    wxT("SELECT n.oid, pg_catalog.quote_ident(n.nspname), pg_catalog.quote_ident(n.nspname),\n")
+	    wxT("       pg_catalog.quote_ident(n.nspname), 'n', true\n")
+	    wxT("  FROM pg_catalog.pg_namespace n\n")
+	    wxT(" WHERE true") + schemaFilter;
+
+	pgSet *set = conn->ExecuteSet(sql, false);
+	if (!set || conn->GetLastResultStatus() != PGRES_TUPLES_OK)
+	{
+		if (set)
+			delete set;
+	}
+	else
+	{
+		result = new pgCatalogNames();
+
+		// Keep the names of the schemas which weren't loaded again
+		if (previous && schemas.GetCount())
+		{
+			wxArrayString quoted;
+			size_t i;
+			for (i = 0 ; i < schemas.GetCount() ; i++)
+				quoted.Add(qtIdent(schemas.Item(i)));
+
+			for (i = 0 ; i < previous->GetCount() ; i++)
+			{
+				const pgCatalogName &item = previous->Item(i);
+				if (quoted.Index(wxString(item.schema, wxConvUTF8)) == wxNOT_FOUND)
+					result->Add(item.name, item.qualName, item.schema, item.oid, item.kind, item.visible);
+			}
+		}
+
+		while (!set->Eof())
+		{
+			wxString kind = set->GetVal(4);
+			result->Add(set->GetVal(1).mb_str(wxConvUTF8), set->GetVal(2).mb_str(wxConvUTF8),
+			            set->GetVal(3).mb_str(wxConvUTF8), set->GetOid(0),
+			            kind.IsEmpty() ? ' ' : (char)kind.GetChar(0), set->GetBool(5));
+			set->MoveNext();
+		}
+		delete set;
+
+		result->Finish();
+	}
+
+	wxCommandEvent ev(wxEVT_COMMAND_MENU_SELECTED, CATALOG_LOADED_ID);
+	caller->AddPendingEvent(ev);
+
+	return NULL;
+}
+
+
+BEGIN_EVENT_TABLE(pgCatalogCache, wxEvtHandler)
+	EVT_MENU(CATALOG_LOADED_ID, pgCatalogCache::OnLoaded)
+END_EVENT_TABLE()
+
+
+pgCatalogCache::pgCatalogCache(const wxString &_key, const wxString &_databaseKey, const wxString &_searchPath)
+{
+	key = _key;
+	databaseKey = _databaseKey;
+	searchPath = _searchPath;
+	references = 0;
+
+	names = NULL;
+	stale = false;
+	loadFailed = false;
+
+	loader = NULL;
+	loaderConn = NULL;
+}
+
+
+pgCatalogCache::~pgCatalogCache()
+{
+	StopLoading();
+	if (names)
+		delete names;
+}
+
+
+wxString pgCatalogCache::GetDatabaseKey(pgConn *conn)
+{
+	return wxString::Format(wxT("%s:%d/%s"), conn->GetHost().c_str(), conn->GetPort(), conn->GetDbname().c_str());
+}
+
+
+pgCatalogCache *pgCatalogCache::Attach(pgConn *conn)
+{
+	if (!conn || conn->GetStatus() != PGCONN_OK)
+		return NULL;
+
+	wxString searchPath = conn->ExecuteScalar(wxT("SHOW search_path"), false);
+	wxString key = pgConnPool::MakeServerKey(conn) + wxT("/") + conn->GetDbname() + wxT("/") + searchPath;
+
+	pgCatalogCache *cache;
+	pgCatalogCacheHash::iterator it = caches.find(key);
+	if (it != caches.end())
+		cache = it->second;
+	else
+	{
+		cache = new pgCatalogCache(key, GetDatabaseKey(conn), searchPath);
+		caches[key] = cache;
+	}
+
+	cache->references++;
+	cache->IsReady(conn);
+
+	return cache;
+}
+
+
+void pgCatalogCache::Detach()
+{
+	if (--references > 0)
+		return;
+
+	lastUsed = wxDateTime::Now();
+
+	// Keep the most recently used of the caches no longer in use
+	while (true)
+	{
+		int idle = 0;
+		pgCatalogCache *oldest = NULL;
+
+		pgCatalogCacheHash::iterator it;
+		for (it = caches.begin() ; it != caches.end() ; ++it)
+		{
+			pgCatalogCache *cache = it->second;
+			if (cache->references > 0)
+				continue;
+
+			idle++;
+			if (!oldest || cache->lastUsed < oldest->lastUsed)
+				oldest = cache;
+		}
+
+		if (idle <= PGCATALOGCACHE_MAX_IDLE)
+			break;
+
+		caches.erase(oldest->key);
+		delete oldest;
+	}
+}
+
+
+void pgCatalogCache::Invalidate(pgConn *conn, const wxString &schema)
+{
+	if (!conn)
+		return;
+
+	wxString database = GetDatabaseKey(conn);
+
+	pgCatalogCacheHash::iterator it;
+	for (it = caches.begin() ; it != caches.end() ; ++it)
+	{
+		pgCatalogCache *cache = it->second;
+		if (cache->databaseKey != database)
+			continue;
+
+		cache->loadFailed = false;
+
+		if (schema.IsEmpty() || !cache->names)
+		{
+			cache->stale = true;
+			cache->staleSchemas.Clear();
+		}
+		else if (!cache->stale || cache->staleSchemas.GetCount())
+		{
+			// Unless everything is out of date already
+			cache->stale = true;
+			if (cache->staleSchemas.Index(schema) == wxNOT_FOUND)
+				cache->staleSchemas.Add(schema);
+		}
+	}
+}
+
+
+void pgCatalogCache::Cleanup()
+{
+	pgCatalogCacheHash::iterator it;
+	for (it = caches.begin() ; it != caches.end() ; ++it)
+		delete it->second;
+	caches.clear();
+}
+
+
+bool pgCatalogCache::IsReady(pgConn *conn)
+{
+	if (!loader && (stale || (!names && !loadFailed)))
+		Load(conn);
+
+	return names != NULL;
+}
+
+
+void pgCatalogCache::Load(pgConn *conn)
+{
+	if (!conn || conn->GetStatus() != PGCONN_OK)
+		return;
+
+	loaderConn = pgConnPool::Get()->Acquire(pgConnPool::MakeServerKey(conn), conn->GetDbname(), wxT("pgAdmin - Catalog cache"));
+	if (!loaderConn)
+		loaderConn = conn->Duplicate(wxT("pgAdmin - Catalog cache"));
+
+	if (loaderConn->GetStatus() != PGCONN_OK)
+	{
+		wxLogInfo(wxT("Could not connect to load the catalog cache of %s"), databaseKey.c_str());
+		delete loaderConn;
+		loaderConn = NULL;
+		stale = false;
+		loadFailed = true;
+		return;
+	}
+
+	wxArrayString schemas;
+	if (names)
+		schemas = staleSchemas;
+	stale = false;
+	staleSchemas.Clear();
+
+	loader = new pgCatalogLoader(loaderConn, searchPath, names, schemas, this);
+	if (loader->Create() != wxTHREAD_NO_ERROR || loader->Run() != wxTHREAD_NO_ERROR)
+	{
+		delete loader;
+		loader = NULL;
+		delete loaderConn;
+		loaderConn = NULL;
+		loadFailed = true;
+	}
+}
+
+
+void pgCatalogCache::StopLoading()
+{
+	if (!loader)
+		return;
+
+	loaderConn->CancelExecution();
+	loader->Wait();
+	delete loader;
+	loader = NULL;
+
+	delete loaderConn;
+	loaderConn = NULL;
+}
+
+
+void pgCatalogCache::OnLoaded(wxCommandEvent &ev)
+{
+	if (!loader)
+		return;
+
+	loader->Wait();
+	pgCatalogNames *result = loader->GetResult();
+	delete loader;
+	loader = NULL;
+
+	pgConnPool::Get()->Release(loaderConn);
+	loaderConn = NULL;
+
+	if (result)
+	{
+		wxLogInfo(wxT("Catalog cache of %s loaded: %d names"), databaseKey.c_str(), (int)result->GetCount());
+
+		if (names)
+			delete names;
+		names = result;
+
+		// The columns are asked for again as they are needed
+		columns.clear();
+	}
+	else
+		loadFailed = true;
+}
+
+
+void pgCatalogCache::Complete(const char *text, const char *kinds, bool systemNames, wxArrayString &result) const
+{
+	if (!names)
+		return;
+
+	size_t len = strlen(text), i, end;
+
+	// Visible names
+	for (i = names->FindPrefix(text, end) ; i < end ; i++)
+	{
+		const pgCatalogName &item = names->Item(i);
+		if (item.visible && strchr(kinds, item.kind) && (systemNames || strcmp(item.schema, "pg_catalog")))
+			result.Add(wxString(item.name, wxConvUTF8));
+	}
+
+	// The schemas the text may be the start of, or start with
+	wxArrayString matching;
+	const char *only = NULL;
+	int compatible = 0;
+
+	for (i = 0 ; i < names->GetSchemaCount() ; i++)
+	{
+		const pgCatalogName &item = names->SchemaItem(i);
+
+		size_t schemaLen = strlen(item.name);
+		size_t common = len < schemaLen ? len : schemaLen;
+		if (strncmp(item.name, text, common) || (len > schemaLen && text[schemaLen] != '.'))
+			continue;
+
+		compatible++;
+		only = item.name;
+		if (len <= schemaLen + 1)
+			matching.Add(wxString(item.name, wxConvUTF8) + wxT("."));
+	}
+
+	if (compatible > 1)
+		WX_APPEND_ARRAY(result, matching);
+	else if (compatible == 1)
+	{
+		// Names qualified with the only schema there can be
+		size_t schemaLen = strlen(only);
+		const char *rest = len > schemaLen + 1 ? text + schemaLen + 1 : "";
+		wxString prefix = wxString(only, wxConvUTF8) + wxT(".");
+
+		for (i = names->FindQualifiedPrefix(only, rest, end) ; i < end ; i++)
+		{
+			const pgCatalogName &item = names->QualifiedItem(i);
+			if (strchr(kinds, item.kind))
+				result.Add(prefix + wxString(item.qualName, wxConvUTF8));
+		}
+	}
+}
+
+
+void pgCatalogCache::CompleteSchemas(const char *text, wxArrayString &result) const
+{
+	if (!names)
+		return;
+
+	size_t len = strlen(text), i;
+	for (i = 0 ; i < names->GetSchemaCount() ; i++)
+	{
+		const pgCatalogName &item = names->SchemaItem(i);
+		if (!strncmp(item.name, text, len))
+			result.Add(wxString(item.name, wxConvUTF8));
+	}
+}
+
+
+OID pgCatalogCache::FindRelation(const char *name) const
+{
+	if (!names)
+		return 0;
+
+	const pgCatalogName *item = names->FindRelation(name);
+	return item ? item->oid : 0;
+}
+
+
+bool pgCatalogCache::GetColumns(OID relation, wxArrayString &result) const
+{
+	pgCatalogColumnHash::const_iterator it = columns.find(relation);
+	if (it == columns.end())
+		return false;
+
+	result = it->second;
+	return true;
+}
+
+
+void pgCatalogCache::SetColumns(OID relation, const wxArrayString &relationColumns)
+{
+	columns[relation] = relationColumns;
+}
@@ -28,6 +28,8 @@ typedef u_long in_addr_t;
 #include <arpa/inet.h>
 #include <netdb.h>
 #include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/time.h>
 
 #ifndef INADDR_NONE
 #define INADDR_NONE (-1)
@@ -41,6 +43,8 @@ typedef u_long in_addr_t;
 #include "db/pgConn.h"
 #include "utils/misc.h"
 #include "db/pgSet.h"
+#include "db/pgQueryStats.h"
+#include "utils/pgDefs.h"
 
 double pgConn::libpqVersion = 8.0;
 
@@ -52,7 +56,7 @@ static void pgNoticeProcessor(void *arg, const char *message)
 pgConn::pgConn(const wxString &server, const wxString &service, const wxString &hostaddr, const wxString &database, const wxString &username, const wxString &password,
                int port, const wxString &rolename, int sslmode, OID oid, const wxString &applicationname,
                const wxString &sslcert, const wxString &sslkey, const wxString &sslrootcert, const wxString &sslcrl,
-               const bool sslcompression) : m_cancelConn(NULL)
+               const bool sslcompression, const bool async) : m_cancelConn(NULL), executionLock(wxMUTEX_RECURSIVE)
 {
 	wxString msg;
 
@@ -76,6 +80,12 @@ pgConn::pgConn(const wxString &server, const wxString &service, const wxString &
 	memset(features, 0, sizeof(features));
 	majorVersion = 0;
 
+	stmtCacheEnabled = false;
+	binaryResults = false;
+	stmtCacheHits = 0;
+	stmtCacheMisses = 0;
+	stmtCounter = 0;
+
 	conv = &wxConvLibc;
 	needColQuoting = false;
 	utfConnectString = false;
@@ -84,6 +94,9 @@ pgConn::pgConn(const wxString &server, const wxString &service, const wxString &
 	conn = 0;
 	noticeArg = 0;
 	connStatus = PGCONN_BAD;
+	connecting = false;
+	connectWrite = false;
+	connectLibc = false;
 
 	// Create the connection string
 	if (!server.IsEmpty())
@@ -220,7 +233,12 @@ pgConn::pgConn(const wxString &server, const wxString &service, const wxString &
 	cleanConnStr.Replace(qtConnString(password), wxT("'XXXXXX'"));
 	wxLogInfo(wxT("Opening connection with connection string: %s"), cleanConnStr.c_str());
 
-	DoConnect();
+	// The asynchronous connect is started by the first PollConnect(), as
+	// PQconnectStart() may block on looking up the host name
+	if (async)
+		connecting = true;
+	else
+		DoConnect();
 }
 
 
@@ -253,6 +271,136 @@ bool pgConn::DoConnect()
 }
 
 
+bool pgConn::StartConnect(bool useLibcConnStr)
+{
+	if (useLibcConnStr)
+		conn = PQconnectStart(connstr.mb_str(wxConvLibc));
+	else
+		conn = PQconnectStart(connstr.mb_str(wxConvUTF8));
+
+	connectLibc = useLibcConnStr;
+
+	// Writing is what PQconnectPoll() waits for first
+	connecting = (conn && PQstatus(conn) != CONNECTION_BAD);
+	connectWrite = true;
+
+	return connecting;
+}
+
+
+// Wait (up to timeout milliseconds) for the socket of a connection in
+// progress to become ready for the next PollConnect()
+bool pgConn::WaitForConnect(long timeout)
+{
+	if (!connecting)
+		return true;
+
+	int sock = PQsocket(conn);
+	if (sock < 0)
+		return true;
+
+	fd_set fds;
+	FD_ZERO(&fds);
+	FD_SET(sock, &fds);
+
+	struct timeval tv;
+	tv.tv_sec = timeout / 1000;
+	tv.tv_usec = (timeout % 1000) * 1000;
+
+	int rc;
+	if (connectWrite)
+		rc = select(sock + 1, NULL, &fds, NULL, &tv);
+	else
+		rc = select(sock + 1, &fds, NULL, NULL, &tv);
+
+	// Let PQconnectPoll() find out about errors
+	return rc != 0;
+}
+
+
+PGresult *pgConn::WaitForResult(pgCancelCheck cancelCheck, void *arg, bool &failed)
+{
+	failed = false;
+
+	while (PQisBusy(conn))
+	{
+		// CancelExecution() sends the request once per query only
+		if (cancelCheck && cancelCheck(arg))
+			CancelExecution();
+
+		if (!WaitForInput(PGCONN_CANCEL_CHECK_INTERVAL) || !PQconsumeInput(conn))
+		{
+			failed = true;
+			return NULL;
+		}
+	}
+	return PQgetResult(conn);
+}
+
+
+bool pgConn::WaitForInput(long timeout)
+{
+	int sock = PQsocket(conn);
+	if (sock < 0)
+		return false;
+
+	fd_set fds;
+	FD_ZERO(&fds);
+	FD_SET(sock, &fds);
+
+	struct timeval tv;
+	tv.tv_sec = timeout / 1000;
+	tv.tv_usec = (timeout % 1000) * 1000;
+
+	return select(sock + 1, &fds, NULL, NULL, &tv) >= 0;
+}
+
+
+int pgConn::PollConnect()
+{
+	if (!connecting)
+		return GetStatus();
+
+	if (!conn)
+	{
+		StartConnect(false);
+		return GetStatus();
+	}
+
+	switch (PQconnectPoll(conn))
+	{
+		case PGRES_POLLING_READING:
+			connectWrite = false;
+			return PGCONN_CONNECTING;
+
+		case PGRES_POLLING_WRITING:
+			connectWrite = true;
+			return PGCONN_CONNECTING;
+
+		case PGRES_POLLING_OK:
+			connecting = false;
+			utfConnectString = !connectLibc;
+			Initialize();
+			break;
+
+		default:
+			connecting = false;
+
+			// Try again with the connection string in the local encoding,
+			// as DoConnect() does
+			if (!connectLibc && strcmp(connstr.mb_str(wxConvUTF8), connstr.mb_str(wxConvLibc)))
+			{
+				PQfinish(conn);
+				if (StartConnect(true))
+					return PGCONN_CONNECTING;
+			}
+			break;
+	}
+
+	return GetStatus();
+}
+
+
 bool pgConn::Initialize()
 {
 	// Set client encoding to Unicode/Ascii, Datestyle to ISO, and ask for notices.
@@ -334,6 +482,10 @@ void pgConn::Close()
 	}
 	conn = 0;
 	connStatus = PGCONN_BAD;
+	connecting = false;
+
+	InvalidateTypeCache();
+	InvalidateStatementCache();
 }
 
 
@@ -736,7 +888,7 @@ int pgConn::GetTxStatus()
 // Execute SQL
 //////////////////////////////////////////////////////////////////////////
 
-bool pgConn::ExecuteVoid(const wxString &sql, bool reportError)
+bool pgConn::ExecuteVoid(const wxString &sql, bool reportError, double *elapsed)
 {
 	if (GetStatus() != PGCONN_OK)
 		return false;
@@ -746,9 +898,21 @@ bool pgConn::ExecuteVoid(const wxString &sql, bool reportError)
 
 	wxLogSql(wxT("Void query (%s:%d): %s"), this->GetHost().c_str(), this->GetPort(), sql.c_str());
 
+	wxCharBuffer query = sql.mb_str(*conv);
 	SetConnCancel();
-	qryRes = PQexec(conn, sql.mb_str(*conv));
+	wxStopWatch stopwatch;
+	qryRes = PQexec(conn, query);
+	long time = stopwatch.Time();
+	if (elapsed)
+	{
+#if wxCHECK_VERSION(2, 9, 3)
+		*elapsed = stopwatch.TimeInMicro().ToDouble() / 1000.0;
+#else
+		*elapsed = time;
+#endif
+	}
 	ResetConnCancel();
+	pgQueryStats::Get()->Record(sql, wxT("ExecuteVoid"), time, qryRes);
 
 	lastResultStatus = PQresultStatus(qryRes);
 	SetLastResultError(qryRes);
@@ -762,6 +926,8 @@ bool pgConn::ExecuteVoid(const wxString &sql, bool reportError)
 		return false;
 	}
 
+	CheckCacheInvalidation(qryRes);
+
 	// Cleanup & exit
 	PQclear(qryRes);
 	return  true;
@@ -779,9 +945,13 @@ wxString pgConn::ExecuteScalar(const wxString &sql, bool reportError)
 		PGresult *qryRes;
 		wxLogSql(wxT("Scalar query (%s:%d): %s"), this->GetHost().c_str(), this->GetPort(), sql.c_str());
 
+		wxStopWatch stopwatch;
 		SetConnCancel();
-		qryRes = PQexec(conn, sql.mb_str(*conv));
+		qryRes = ExecuteCached(sql, false);
+		if (!qryRes)
+			qryRes = PQexec(conn, sql.mb_str(*conv));
 		ResetConnCancel();
+		pgQueryStats::Get()->Record(sql, wxT("ExecuteScalar"), stopwatch.Time(), qryRes);
 
 		lastResultStatus = PQresultStatus(qryRes);
 		SetLastResultError(qryRes);
@@ -822,15 +992,21 @@ pgSet *pgConn::ExecuteSet(const wxString &sql, bool reportError)
 		PGresult *qryRes;
 		wxLogSql(wxT("Set query (%s:%d): %s"), this->GetHost().c_str(), this->GetPort(), sql.c_str());
 
+		wxStopWatch stopwatch;
 		SetConnCancel();
-		qryRes = PQexec(conn, sql.mb_str(*conv));
+		qryRes = ExecuteCached(sql, true);
+		if (!qryRes)
+			qryRes = PQexec(conn, sql.mb_str(*conv));
 		ResetConnCancel();
+		pgQueryStats::Get()->Record(sql, wxT("ExecuteSet"), stopwatch.Time(), qryRes);
 
 		lastResultStatus = PQresultStatus(qryRes);
 		SetLastResultError(qryRes);
 
 		if (lastResultStatus == PGRES_TUPLES_OK || lastResultStatus == PGRES_COMMAND_OK)
 		{
+			CheckCacheInvalidation(qryRes);
+
 			pgSet *set = new pgSet(qryRes, this, *conv, needColQuoting);
 			if (!set)
 			{
@@ -1008,6 +1184,9 @@ int pgConn::GetStatus() const
 	if (!this)
 		return PGCONN_BAD;
 
+	if (connecting)
+		return PGCONN_CONNECTING;
+
 	if (conn)
 		((pgConn *)this)->connStatus = PQstatus(conn);
 
@@ -1021,11 +1200,60 @@ void pgConn::Reset()
 
 	// Reset any vars that need to be in a defined state before connecting
 	needColQuoting = false;
+	InvalidateTypeCache();
+	InvalidateStatementCache();
 
 	Initialize();
 }
 
 
+bool pgConn::ResetSession()
+{
+	if (GetStatus() != PGCONN_OK || PQisBusy(conn) || GetTxStatus() == PGCONN_TXSTATUS_ACTIVE)
+		return false;
+
+	// The notice handler usually points to the window which is going away
+	RegisterNoticeProcessor(0, 0);
+	PQsetnonblocking(conn, 0);
+
+	PGnotify *notify;
+	while ((notify = PQnotifies(conn)) != NULL)
+		PQfreemem(notify);
+
+	if (GetTxStatus() != PGCONN_TXSTATUS_IDLE && !ExecuteVoid(wxT("ROLLBACK TRANSACTION"), false))
+		return false;
+
+	wxString sql;
+	if (BackendMinimumVersion(8, 3))
+		sql = wxT("DISCARD ALL");
+	else
+		sql = wxT("SET SESSION AUTHORIZATION DEFAULT;\nRESET ALL");
+
+	if (!ExecuteVoid(sql, false))
+		return false;
+
+	EnableStatementCache(false);
+	EnableBinaryResults(false);
+	InvalidateTypeCache();
+
+	// Restore our own session settings and the default role
+	needColQuoting = false;
+	return Initialize();
+}
+
+
+void pgConn::SetApplicationName(const wxString &applicationname)
+{
+	if (applicationname.IsEmpty() || applicationname == save_applicationname)
+		return;
+
+	if (BackendMinimumVersion(9, 0))
+		ExecuteVoid(wxT("SET application_name=") + qtDbString(applicationname), false);
+
+	save_applicationname = applicationname;
+}
+
+
 void pgConn::SetConnCancel(void)
 {
 	wxMutexLocker  lock(m_cancelConnMutex);
@@ -1240,7 +1468,530 @@ bool pgConn::TableHasColumn(wxString schemaname, wxString tblname, const wxStrin
 	return false;
 }
 
-void pgError::SetError(PGresult *_res, wxMBConv *_conv)
+//////////////////////////////////////////////////////////////////////////
+// Type metadata cache
+//////////////////////////////////////////////////////////////////////////
+
+static wxString TypeCacheKey(OID typoid, long typmod)
+{
+	return wxString::Format(wxT("%lu:%ld"), (unsigned long)typoid, typmod);
+}
+
+// Resolve all column types of the given result set which are not yet
+// cached, using a single catalog query for the whole batch. Returns false
+// if that is not possible right now, because another thread owns the
+// connection, or it is still busy with another query (e.g. still
+// streaming the rows of this result).
+bool pgConn::LoadTypeInfo(const pgSet *set)
+{
+	if (!set || !set->NumCols())
+		return true;
+
+	if (!conn)
+		return false;
+
+	wxArrayString keys;
+	wxString values;
+
+	{
+		wxCriticalSectionLocker lock(typeCacheLock);
+
+		for (int col = 0; col < set->NumCols(); col++)
+		{
+			OID typoid = set->ColTypeOid(col);
+			long typmod = set->ColTypeMod(col);
+			wxString key = TypeCacheKey(typoid, typmod);
+
+			if (typeCache.find(key) != typeCache.end() || keys.Index(key) != wxNOT_FOUND)
+				continue;
+
+			keys.Add(key);
+			if (!values.IsEmpty())
+				values += wxT(", ");
+			values += wxT("(") + NumToStr(typoid) + wxT("::oid, ") + NumToStr(typmod) + wxT(")");
+		}
+	}
+
+	if (keys.IsEmpty())
+		return true;
+
+	if (!TryLockExecution())
+		return false;
+	if (PQtransactionStatus(conn) == PQTRANS_ACTIVE)
+	{
+		UnlockExecution();
+		return false;
+	}
+
+	pgSet *types = ExecuteSet(
+	                   wxT("SELECT t.oid AS typoid, m.typmod,\n")
+	                   wxT("       CASE WHEN t.typbasetype=0 THEN t.oid ELSE t.typbasetype END AS basetype,\n")
+	                   wxT("       format_type(t.oid, NULL) AS typname, format_type(t.oid, m.typmod) AS fulltypname\n")
+	                   wxT("  FROM pg_type t\n")
+	                   wxT("  JOIN (VALUES ") + values + wxT(") AS m(typoid, typmod) ON t.oid=m.typoid"), false);
+	bool found = types && GetLastResultStatus() == PGRES_TUPLES_OK;
+	UnlockExecution();
+
+	// Don't cache anything if the lookup failed, so it gets retried later
+	if (!found)
+	{
+		if (types)
+			delete types;
+		return true;
+	}
+
+	wxCriticalSectionLocker lock(typeCacheLock);
+
+	// Types which disappeared from the catalog are cached as unknown, to
+	// avoid looking them up again for every result set
+	for (size_t i = 0; i < keys.GetCount(); i++)
+	{
+		pgTypeInfo unknown;
+		unknown.baseType = StrToOid(keys[i].BeforeFirst(':'));
+		typeCache[keys[i]] = unknown;
+	}
+
+	while (!types->Eof())
+	{
+		pgTypeInfo info;
+		info.baseType = types->GetOid(wxT("basetype"));
+		info.typeName = types->GetVal(wxT("typname"));
+		info.fullTypeName = types->GetVal(wxT("fulltypname"));
+
+		typeCache[TypeCacheKey(types->GetOid(wxT("typoid")), types->GetLong(wxT("typmod")))] = info;
+		types->MoveNext();
+	}
+	delete types;
+
+	return true;
+}
+
+
+bool pgConn::LookupTypeInfo(OID typoid, long typmod, pgTypeInfo &info)
+{
+	wxCriticalSectionLocker lock(typeCacheLock);
+
+	pgTypeInfoHash::iterator it = typeCache.find(TypeCacheKey(typoid, typmod));
+	if (it == typeCache.end())
+		return false;
+
+	info = it->second;
+	return true;
+}
+
+
+void pgConn::InvalidateTypeCache()
+{
+	wxCriticalSectionLocker lock(typeCacheLock);
+
+	typeCache.clear();
+}
+
+
+// Drop the cached type information after any command which may create,
+// rename or otherwise change how types are resolved and displayed
+// (format_type() output depends on the search_path, too), and forget the
+// prepared statements, once they have been deallocated by the user.
+void pgConn::CheckCacheInvalidation(PGresult *res)
+{
+	static const char *const invalidatingCommands[] =
+	{
+		"CREATE TYPE", "ALTER TYPE", "DROP TYPE",
+		"CREATE DOMAIN", "ALTER DOMAIN", "DROP DOMAIN",
+		"CREATE EXTENSION", "ALTER EXTENSION", "DROP EXTENSION",
+		"ALTER TABLE", "ALTER VIEW", "ALTER SCHEMA", "DROP SCHEMA",
+		"SET", "RESET", NULL
+	};
+
+	if (!res || PQresultStatus(res) != PGRES_COMMAND_OK)
+		return;
+
+	const char *cmdStatus = PQcmdStatus(res);
+	if (!cmdStatus || !*cmdStatus)
+		return;
+
+	if (!strcmp(cmdStatus, "DISCARD ALL") || !strcmp(cmdStatus, "DEALLOCATE ALL"))
+	{
+		InvalidateStatementCache();
+		InvalidateTypeCache();
+		return;
+	}
+
+	for (int i = 0; invalidatingCommands[i]; i++)
+	{
+		size_t len = strlen(invalidatingCommands[i]);
+		if (!strncmp(cmdStatus, invalidatingCommands[i], len) &&
+		        (cmdStatus[len] == '\0' || cmdStatus[len] == ' '))
+		{
+			InvalidateTypeCache();
+			return;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Prepared statement cache
+//////////////////////////////////////////////////////////////////////////
+
+// Maximum number of statements prepared on a single connection
+#define PGCONN_STATEMENT_CACHE_SIZE 256
+
+static bool IsIdentChar(wxChar c)
+{
+	return wxIsalnum(c) || c == wxT('_');
+}
+
+// Keywords a string constant may follow as a value of its own; after any
+// other word it is a typed literal (such as "interval '1 day'")
+static const wxChar *valueKeywords[] =
+{
+	wxT("SELECT"), wxT("WHERE"), wxT("AND"), wxT("OR"), wxT("NOT"), wxT("LIKE"), wxT("ILIKE"),
+	wxT("WHEN"), wxT("THEN"), wxT("ELSE"), wxT("HAVING"), wxT("BETWEEN"),
+	0
+};
+
+// Whether the string constant at pos is a value of its own, rather than
+// part of a typed literal or of E'', B'', X'' and U&'' constants
+static bool IsValueLiteral(const wxString &sql, size_t pos)
+{
+	size_t end = pos;
+	while (end > 0 && wxIsspace(sql[end - 1]))
+		end--;
+
+	if (end == 0)
+		return true;
+	if (sql[end - 1] == wxT('&'))
+		return false;
+	if (!IsIdentChar(sql[end - 1]))
+		return true;
+	if (end < pos)
+	{
+		size_t start = end;
+		while (start > 0 && IsIdentChar(sql[start - 1]))
+			start--;
+
+		wxString word = sql.Mid(start, end - start).Upper();
+		for (int i = 0; valueKeywords[i]; i++)
+		{
+			if (word == valueKeywords[i])
+				return true;
+		}
+	}
+	return false;
+}
+
+// Split the literals out of a query, so queries differing only in those
+// share one prepared statement: string constants, and integers compared to
+// something or cast (e.g. "rel.relnamespace = 2200" or "2200::oid"), become
+// parameters. Only a single SELECT (or WITH) statement is handled; returns
+// false for anything else, and for string constants holding a backslash,
+// whose end depends on standard_conforming_strings.
+static bool NormalizeStatement(const wxString &sql, wxString &normalized, wxArrayString &params)
+{
+	wxString trimmed = sql.Strip(wxString::both);
+	wxString start = trimmed.Left(6).Upper();
+
+	if (!start.StartsWith(wxT("SELECT")) && !start.StartsWith(wxT("WITH")))
+		return false;
+
+	// Dollar quotes or parameters: leave such queries alone
+	if (trimmed.Find(wxT('$')) != wxNOT_FOUND)
+		return false;
+
+	size_t len = trimmed.Length(), pos = 0;
+	wxChar lastToken = 0;
+
+	normalized.Empty();
+	params.Empty();
+
+	while (pos < len)
+	{
+		wxChar c = trimmed[pos];
+
+		if (c == wxT('-') && pos + 1 < len && trimmed[pos + 1] == wxT('-'))
+		{
+			size_t end = trimmed.find(wxT('\n'), pos);
+			if (end == wxString::npos)
+				end = len;
+			normalized += trimmed.Mid(pos, end - pos);
+			pos = end;
+			continue;
+		}
+		if (c == wxT('/') && pos + 1 < len && trimmed[pos + 1] == wxT('*'))
+		{
+			size_t end = trimmed.find(wxT("*/"), pos + 2);
+			if (end == wxString::npos)
+				return false;
+			normalized += trimmed.Mid(pos, end + 2 - pos);
+			pos = end + 2;
+			continue;
+		}
+		if (c == wxT('"'))
+		{
+			size_t end = trimmed.find(wxT('"'), pos + 1);
+			if (end == wxString::npos)
+				return false;
+			normalized += trimmed.Mid(pos, end + 1 - pos);
+			pos = end + 1;
+			lastToken = c;
+			continue;
+		}
+		if (c == wxT('\''))
+		{
+			// Find the end of the literal, skipping doubled quotes
+			wxString value;
+			size_t end = pos + 1;
+
+			while (true)
+			{
+				if (end >= len || trimmed[end] == wxT('\\'))
+					return false;
+				if (trimmed[end] == wxT('\''))
+				{
+					if (end + 1 < len && trimmed[end + 1] == wxT('\''))
+					{
+						value += wxT('\'');
+						end += 2;
+						continue;
+					}
+					break;
+				}
+				value += trimmed[end++];
+			}
+
+			// Typed literals and prefixed constants are kept as they are
+			if (!IsValueLiteral(trimmed, pos))
+				normalized += trimmed.Mid(pos, end + 1 - pos);
+			else
+			{
+				params.Add(value);
+				normalized += wxString::Format(wxT("$%d"), (int)params.GetCount());
+			}
+			pos = end + 1;
+			lastToken = wxT('\'');
+			continue;
+		}
+		if (wxIsdigit(c) && (pos == 0 || (!IsIdentChar(trimmed[pos - 1]) && trimmed[pos - 1] != wxT('.'))))
+		{
+			size_t end = pos;
+			while (end < len && wxIsdigit(trimmed[end]))
+				end++;
+
+			// Only plain integers in a comparison, or cast to another type;
+			// others (e.g. "ORDER BY 1" or "varchar(64)") may not be replaced
+			// by a parameter.
+			size_t next = end;
+			while (next < len && wxIsspace(trimmed[next]))
+				next++;
+
+			bool isInteger = end >= len || (!IsIdentChar(trimmed[end]) && trimmed[end] != wxT('.'));
+			bool isCast = next + 1 < len && trimmed[next] == wxT(':') && trimmed[next + 1] == wxT(':');
+			bool isCompared = lastToken == wxT('=') || lastToken == wxT('<') || lastToken == wxT('>');
+
+			if (isInteger && (isCast || isCompared))
+			{
+				params.Add(trimmed.Mid(pos, end - pos));
+				normalized += wxString::Format(wxT("$%d"), (int)params.GetCount());
+			}
+			else
+				normalized += trimmed.Mid(pos, end - pos);
+
+			pos = end;
+			lastToken = wxT('0');
+			continue;
+		}
+		if (c == wxT(';'))
+		{
+			// More than a single statement?
+			if (!trimmed.Mid(pos + 1).Strip(wxString::both).IsEmpty())
+				return false;
+			break;
+		}
+
+		normalized += c;
+		if (!wxIsspace(c))
+			lastToken = c;
+		pos++;
+	}
+
+	return true;
+}
+
+
+void pgConn::EnableStatementCache(bool enable)
+{
+	stmtCacheEnabled = enable;
+
+	if (!enable)
+		InvalidateStatementCache();
+}
+
+
+// Forget all prepared statements; to be called when they are gone on the
+// server, too (or else they are left behind until the session ends).
+void pgConn::InvalidateStatementCache()
+{
+	wxCriticalSectionLocker lock(stmtCacheLock);
+
+	stmtCache.clear();
+}
+
+
+// Check the result columns of a freshly prepared statement, to decide if
+// its results can be fetched in binary format.
+static void DescribeCachedStatement(PGconn *conn, pgCachedStatement &stmt)
+{
+	stmt.binary = false;
+	stmt.hasTimestamp = false;
+
+	PGresult *desc = PQdescribePrepared(conn, stmt.name.mb_str(wxConvUTF8));
+
+	if (PQresultStatus(desc) == PGRES_COMMAND_OK && PQnfields(desc) > 0)
+	{
+		// Timestamps are sent as integers since PostgreSQL 8.4 only
+		const char *intDatetimes = PQparameterStatus(conn, "integer_datetimes");
+		bool timestampOk = intDatetimes && !strcmp(intDatetimes, "on");
+		// Before PostgreSQL 12, the text of floats is rounded to
+		// extra_float_digits, rather than the shortest exact one
+		bool floatOk = PQserverVersion(conn) >= 120000;
+
+		stmt.binary = true;
+		for (int col = 0; col < PQnfields(desc) && stmt.binary; col++)
+		{
+			OID typoid = PQftype(desc, col);
+
+			if (typoid == PGOID_TYPE_TIMESTAMP)
+			{
+				stmt.hasTimestamp = true;
+				stmt.binary = timestampOk;
+			}
+			else if (typoid == PGOID_TYPE_FLOAT4 || typoid == PGOID_TYPE_FLOAT8)
+				stmt.binary = floatOk;
+			else
+				stmt.binary = pgSet::CanFetchBinary(typoid);
+		}
+	}
+	PQclear(desc);
+}
+
+
+// Run a query through the prepared statement cache: the first time it is
+// seen, it gets prepared on the server, afterwards the prepared statement is
+// executed with the literals of the query as parameters. Returns NULL, if the
+// query has to be run as it is instead.
+PGresult *pgConn::ExecuteCached(const wxString &sql, bool allowBinary)
+{
+	// A failing PREPARE would abort the current transaction
+	if (!stmtCacheEnabled || !conn || PQtransactionStatus(conn) != PQTRANS_IDLE)
+		return NULL;
+
+	wxString normalized;
+	wxArrayString params;
+
+	if (!NormalizeStatement(sql, normalized, params))
+		return NULL;
+
+	pgCachedStatement stmt;
+	wxString &name = stmt.name;
+	bool known;
+
+	stmt.binary = false;
+	stmt.hasTimestamp = false;
+
+	{
+		wxCriticalSectionLocker lock(stmtCacheLock);
+
+		pgStatementCacheHash::iterator it = stmtCache.find(normalized);
+		known = it != stmtCache.end();
+		if (known)
+			stmt = it->second;
+
+		if (known && !name.IsEmpty())
+			stmtCacheHits++;
+		else
+			stmtCacheMisses++;
+
+		if (!known && stmtCache.size() >= PGCONN_STATEMENT_CACHE_SIZE)
+			return NULL;
+	}
+
+	// Statements which could not be prepared are not tried again
+	if (known && name.IsEmpty())
+		return NULL;
+
+	if (!known)
+	{
+		name = wxString::Format(wxT("pgadmin_stmt_%ld"), ++stmtCounter);
+
+		PGresult *res = PQprepare(conn, name.mb_str(wxConvUTF8), normalized.mb_str(*conv), 0, NULL);
+		bool prepared = PQresultStatus(res) == PGRES_COMMAND_OK;
+		PQclear(res);
+
+		if (prepared)
+			wxLogSql(wxT("Prepared statement %s (%s:%d): %s"), name.c_str(), GetHost().c_str(), GetPort(), normalized.c_str());
+		else
+			wxLogSql(wxT("Statement could not be prepared (%s:%d): %s"), GetHost().c_str(), GetPort(), normalized.c_str());
+
+		if (!prepared)
+			name.Empty();
+		else if (binaryResults)
+			DescribeCachedStatement(conn, stmt);
+
+		wxCriticalSectionLocker lock(stmtCacheLock);
+		stmtCache[normalized] = stmt;
+
+		if (!prepared)
+			return NULL;
+	}
+
+	// The text of binary timestamps is built for the ISO DateStyle only
+	int resultFormat = 0;
+	if (allowBinary && binaryResults && stmt.binary)
+	{
+		const char *dateStyle = PQparameterStatus(conn, "DateStyle");
+		if (!stmt.hasTimestamp || (dateStyle && !strncmp(dateStyle, "ISO", 3)))
+			resultFormat = 1;
+	}
+
+	int nParams = params.GetCount();
+	wxCharBuffer *buffers = new wxCharBuffer[nParams ? nParams : 1];
+	const char **values = (const char **)malloc((nParams ? nParams : 1) * sizeof(const char *));
+
+	for (int idx = 0; idx < nParams; idx++)
+	{
+		buffers[idx] = params[idx].mb_str(*conv);
+		values[idx] = buffers[idx];
+	}
+
+	PGresult *qryRes = PQexecPrepared(conn, name.mb_str(wxConvUTF8), nParams, values, NULL, NULL, resultFormat);
+
+	free(values);
+	delete [] buffers;
+
+	// The statement has been deallocated behind our back, or its result
+	// columns have changed: forget about it, and run the query as it is
+	const char *sqlState = PQresultErrorField(qryRes, PG_DIAG_SQLSTATE);
+	if (sqlState && (!strcmp(sqlState, "26000") || !strcmp(sqlState, "0A000")))
+	{
+		PQclear(qryRes);
+
+		if (!strcmp(sqlState, "0A000"))
+		{
+			PGresult *res = PQexec(conn, (wxT("DEALLOCATE ") + name).mb_str(wxConvUTF8));
+			PQclear(res);
+		}
+
+		wxCriticalSectionLocker lock(stmtCacheLock);
+		stmtCache.erase(normalized);
+
+		return NULL;
+	}
+
+	return qryRes;
+}
+
+
+void pgError::SetError(PGresult *_res, wxMBConv *_conv, long _posOffset)
 {
 	if (!_conv)
 	{
@@ -1260,6 +2011,10 @@ void pgError::SetError(PGresult *_res, wxMBConv *_conv)
 		source_file = wxString(PQresultErrorField(_res, PG_DIAG_SOURCE_FILE), *_conv);
 		source_line = wxString(PQresultErrorField(_res, PG_DIAG_SOURCE_LINE), *_conv);
 		source_function = wxString(PQresultErrorField(_res, PG_DIAG_SOURCE_FUNCTION), *_conv);
+
+		long pos;
+		if (_posOffset && statement_pos.ToLong(&pos))
+			statement_pos = NumToStr(pos + _posOffset);
 	}
 	else
 	{
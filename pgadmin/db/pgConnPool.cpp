@@ -0,0 +1,214 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgConnPool.cpp - Pool of idle connections shared by the tool windows
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+
+// App headers
+#include "utils/misc.h"
+#include "utils/sysLogger.h"
+#include "db/pgConn.h"
+#include "db/pgConnPool.h"
+
+// How often (in milliseconds) idle connections are checked for expiry
+#define PGCONNPOOL_EXPIRY_INTERVAL  30000
+
+pgConnPool *pgConnPool::instance = NULL;
+
+
+pgConnPool::pgConnPool()
+{
+}
+
+
+pgConnPool::~pgConnPool()
+{
+	Stop();
+	Clear();
+}
+
+
+pgConnPool *pgConnPool::Get()
+{
+	if (!instance)
+		instance = new pgConnPool();
+	return instance;
+}
+
+
+void pgConnPool::Cleanup()
+{
+	if (instance)
+	{
+		delete instance;
+		instance = NULL;
+	}
+}
+
+
+wxString pgConnPool::MakeServerKey(const wxString &server, const wxString &service, const wxString &hostaddr,
+                                   int port, const wxString &username, const wxString &rolename, int sslmode)
+{
+	return username + wxT("@") + server + wxT(":") + NumToStr((long)port)
+	       + wxT(" service=") + service + wxT(" hostaddr=") + hostaddr
+	       + wxT(" sslmode=") + NumToStr((long)sslmode) + wxT(" role=") + rolename;
+}
+
+
+wxString pgConnPool::MakeServerKey(pgConn *conn)
+{
+	return MakeServerKey(conn->save_server, conn->save_service, conn->save_hostaddr, conn->save_port,
+	                     conn->save_username, conn->save_rolename, conn->save_sslmode);
+}
+
+
+pgConn *pgConnPool::Acquire(const wxString &serverKey, const wxString &database, const wxString &applicationname)
+{
+	stats[serverKey].acquired++;
+
+	if (!settings->GetConnPoolEnabled())
+		return NULL;
+
+	ExpireIdle();
+
+	// Most recently released first; its server process is the warmest
+	size_t i = idle.GetCount();
+	while (i-- > 0)
+	{
+		pgConnPoolEntry *entry = idle.Item(i);
+		if (entry->serverKey != serverKey || entry->database != database)
+			continue;
+
+		idle.RemoveAt(i);
+
+		if (!entry->conn->IsAlive())
+		{
+			wxLogInfo(wxT("Discarding broken pooled connection to %s"), entry->conn->GetName().c_str());
+			Discard(entry);
+			continue;
+		}
+
+		pgConn *conn = entry->conn;
+		delete entry;
+
+		conn->SetApplicationName(applicationname);
+		stats[serverKey].reused++;
+
+		wxLogInfo(wxT("Reusing pooled connection to %s"), conn->GetName().c_str());
+		return conn;
+	}
+
+	return NULL;
+}
+
+
+void pgConnPool::Release(pgConn *conn)
+{
+	if (!conn)
+		return;
+
+	pgConnPoolEntry *entry = new pgConnPoolEntry;
+	entry->conn = conn;
+	entry->serverKey = MakeServerKey(conn);
+	entry->database = conn->GetDbname();
+	entry->idleSince = wxDateTime::Now();
+
+	if (!settings->GetConnPoolEnabled() || GetIdleCount(entry->serverKey) >= settings->GetConnPoolMaxIdle())
+	{
+		Discard(entry);
+		return;
+	}
+
+	if (!conn->ResetSession())
+	{
+		wxLogInfo(wxT("Could not reset the session of %s, closing it"), conn->GetName().c_str());
+		Discard(entry);
+		return;
+	}
+
+	idle.Add(entry);
+	stats[entry->serverKey].released++;
+
+	if (!IsRunning())
+		Start(PGCONNPOOL_EXPIRY_INTERVAL);
+}
+
+
+void pgConnPool::Clear(const wxString &serverKey)
+{
+	size_t i = idle.GetCount();
+	while (i-- > 0)
+	{
+		pgConnPoolEntry *entry = idle.Item(i);
+		if (serverKey.IsEmpty() || entry->serverKey == serverKey)
+		{
+			idle.RemoveAt(i);
+			Discard(entry);
+		}
+	}
+}
+
+
+pgConnPoolStats pgConnPool::GetStats(const wxString &serverKey)
+{
+	return stats[serverKey];
+}
+
+
+int pgConnPool::GetIdleCount(const wxString &serverKey)
+{
+	int count = 0;
+	size_t i;
+	for (i = 0 ; i < idle.GetCount() ; i++)
+	{
+		if (idle.Item(i)->serverKey == serverKey)
+			count++;
+	}
+	return count;
+}
+
+
+void pgConnPool::Notify()
+{
+	ExpireIdle();
+
+	if (idle.IsEmpty())
+		Stop();
+}
+
+
+void pgConnPool::Discard(pgConnPoolEntry *entry)
+{
+	stats[entry->serverKey].discarded++;
+
+	delete entry->conn;
+	delete entry;
+}
+
+
+void pgConnPool::ExpireIdle()
+{
+	wxDateTime expiry = wxDateTime::Now() - wxTimeSpan::Seconds(settings->GetConnPoolIdleTimeout());
+
+	size_t i = idle.GetCount();
+	while (i-- > 0)
+	{
+		pgConnPoolEntry *entry = idle.Item(i);
+		if (entry->idleSince < expiry)
+		{
+			wxLogInfo(wxT("Closing idle pooled connection to %s"), entry->conn->GetName().c_str());
+			idle.RemoveAt(i);
+			Discard(entry);
+		}
+	}
+}
@@ -0,0 +1,560 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgExportThread.cpp - Write the result of a query to a file
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/regex.h>
+
+// PostgreSQL headers
+#include <libpq-fe.h>
+
+// App headers
+#include "db/pgSet.h"
+#include "db/pgConn.h"
+#include "db/pgExportThread.h"
+#include "db/pgQueryStats.h"
+#include "utils/misc.h"
+
+
+// Strip the trailing semicolon from a single SELECT (VALUES, TABLE, WITH)
+// statement, so that it can be used as a subquery. Returns an empty string
+// for anything else, including several statements.
+static wxString GetSingleQuery(const wxString &query)
+{
+	wxString sql = query;
+	sql.Trim(true);
+	sql.Trim(false);
+	while (sql.EndsWith(wxT(";")))
+	{
+		sql.RemoveLast();
+		sql.Trim(true);
+	}
+
+	wxString keyword = sql.BeforeFirst(' ').BeforeFirst('\n').BeforeFirst('\r').BeforeFirst('\t').BeforeFirst('(').Lower();
+	if (keyword != wxT("select") && keyword != wxT("values") && keyword != wxT("table") && keyword != wxT("with"))
+		return wxEmptyString;
+
+	// Look for a semicolon outside of literals, quoted identifiers and
+	// comments
+	size_t pos = 0, len = sql.Length();
+	while (pos < len)
+	{
+		wxChar c = sql.GetChar(pos);
+		wxChar prev = pos ? (wxChar)sql.GetChar(pos - 1) : (wxChar)' ';
+
+		if (c == ';')
+			return wxEmptyString;
+		else if (c == '\'' || c == '"')
+		{
+			pos++;
+			while (pos < len && sql.GetChar(pos) != c)
+				pos++;
+		}
+		else if (c == '-' && pos + 1 < len && sql.GetChar(pos + 1) == '-')
+		{
+			while (pos < len && sql.GetChar(pos) != '\n')
+				pos++;
+		}
+		else if (c == '/' && pos + 1 < len && sql.GetChar(pos + 1) == '*')
+		{
+			pos += 2;
+			while (pos + 1 < len && !(sql.GetChar(pos) == '*' && sql.GetChar(pos + 1) == '/'))
+				pos++;
+			pos++;
+		}
+		else if (c == '$' && !wxIsalnum(prev) && prev != '_')
+		{
+			// Dollar quoted string: $tag$ ... $tag$
+			size_t end = pos + 1;
+			while (end < len)
+			{
+				wxChar t = sql.GetChar(end);
+				if (!wxIsalnum(t) && t != '_')
+					break;
+				end++;
+			}
+			if (end < len && sql.GetChar(end) == '$')
+			{
+				wxString tag = sql.Mid(pos, end - pos + 1);
+				size_t close = sql.find(tag, end + 1);
+				if (close == wxString::npos)
+					return wxEmptyString;
+				pos = close + tag.Length() - 1;
+			}
+		}
+		pos++;
+	}
+
+	return sql;
+}
+
+
+pgExportThread::pgExportThread(pgConn *_conn, const wxString &_query, const pgExportOptions &_options,
+                               wxEvtHandler *_caller, long _eventId)
+	: wxThread(wxTHREAD_JOINABLE)
+{
+	conn = _conn;
+	query = _query;
+	options = _options;
+	caller = _caller;
+	eventId = _eventId;
+	set = NULL;
+	rowOrder = NULL;
+
+	writer = new pgExportWriter(options, *conn->GetConv());
+
+	rows = 0;
+	bytes = 0;
+	estimatedRows = -1;
+
+	cancelled = false;
+	succeeded = usedCopy = false;
+	skipped = 0;
+}
+
+
+// The column names and types are taken here, as finding the types may need
+// queries on the connection of the set
+pgExportThread::pgExportThread(pgSet *_set, const pgExportOptions &_options, const long *_rowOrder, long rowCount)
+	: wxThread(wxTHREAD_JOINABLE)
+{
+	conn = NULL;
+	options = _options;
+	caller = NULL;
+	eventId = 0;
+	set = _set;
+	rowOrder = _rowOrder;
+
+	int col;
+	for (col = 0 ; col < set->NumCols() ; col++)
+	{
+		setNames.Add(set->ColName(col));
+		setClasses.Add(set->ColTypClass(col));
+	}
+
+	writer = new pgExportWriter(options, set->GetConversion());
+
+	rows = 0;
+	bytes = 0;
+	estimatedRows = (rowOrder && rowCount >= 0) ? rowCount : set->NumRows();
+
+	cancelled = false;
+	succeeded = usedCopy = false;
+	skipped = 0;
+}
+
+
+pgExportThread::~pgExportThread()
+{
+	delete writer;
+}
+
+
+void pgExportThread::Cancel()
+{
+	wxCriticalSectionLocker lock(progressLock);
+	cancelled = true;
+}
+
+
+void pgExportThread::GetProgress(long &_rows, wxLongLong &_bytes)
+{
+	wxCriticalSectionLocker lock(progressLock);
+	_rows = rows;
+	_bytes = bytes;
+}
+
+
+void *pgExportThread::Entry()
+{
+	wxStopWatch stopwatch;
+
+	if (!writer->Open())
+		succeeded = false;
+	else if (set)
+		succeeded = ExportSet();
+	else
+	{
+		// The connection is ours until the query is done
+		conn->LockExecution();
+		succeeded = ExportQuery();
+		conn->UnlockExecution();
+	}
+
+	if (!writer->Close())
+		succeeded = false;
+	if (!succeeded && error.IsEmpty())
+		error = writer->GetError();
+	if (cancelled)
+		succeeded = false;
+	skipped = writer->GetSkipped();
+
+	if (!set)
+	{
+		pgQueryStats::Get()->Record(query, wxT("pgExportThread"), stopwatch.Time(), rows, bytes);
+
+		wxCommandEvent ev(wxEVT_COMMAND_MENU_SELECTED, eventId);
+		caller->AddPendingEvent(ev);
+	}
+
+	return NULL;
+}
+
+
+bool pgExportThread::ExportQuery()
+{
+	wxString single = GetSingleQuery(query);
+	PGresult *desc = NULL;
+
+	if (!single.IsEmpty() && conn->BackendMinimumVersion(9, 0))
+	{
+		// Describing the query tells whether it can be run by COPY,
+		// and gives the column names and types
+		PGresult *res = PQprepare(conn->conn, "", single.mb_str(*conn->GetConv()), 0, NULL);
+		if (PQresultStatus(res) == PGRES_COMMAND_OK)
+			desc = PQdescribePrepared(conn->conn, "");
+		else if (PQresultStatus(res) == PGRES_FATAL_ERROR)
+		{
+			// The query itself is broken (and the transaction aborted)
+			error = wxString(PQresultErrorMessage(res), *conn->GetConv());
+		}
+		PQclear(res);
+
+		if (desc && PQresultStatus(desc) != PGRES_COMMAND_OK)
+		{
+			PQclear(desc);
+			desc = NULL;
+		}
+		if (desc)
+			EstimateRows();
+	}
+
+	bool ok;
+	if (!error.IsEmpty())
+		ok = false;
+	else if (desc && CanUseCopy(desc))
+		ok = ExportCopy(desc);
+	else
+		ok = ExportRows();
+
+	if (desc)
+		PQclear(desc);
+
+	return ok;
+}
+
+
+// The planner's estimate of the number of rows gives the progress display
+// something to compare with
+void pgExportThread::EstimateRows()
+{
+	wxString sql = wxT("EXPLAIN ") + GetSingleQuery(query);
+	PGresult *res = PQexec(conn->conn, sql.mb_str(*conn->GetConv()));
+
+	if (PQresultStatus(res) == PGRES_TUPLES_OK && PQntuples(res) > 0)
+	{
+		wxRegEx reRows(wxT("rows=([0-9]+)"));
+		wxString plan = wxString(PQgetvalue(res, 0, 0), *conn->GetConv());
+		if (reRows.Matches(plan))
+			reRows.GetMatch(plan, 1).ToLong(&estimatedRows);
+	}
+	PQclear(res);
+}
+
+
+// COPY writes CSV, which covers all exports but those without quoting (as
+// COPY would still quote values containing the separator). It needs single
+// byte separators and, to quote strings only, unique column names.
+bool pgExportThread::CanUseCopy(PGresult *desc)
+{
+	int col, nCols = PQnfields(desc);
+
+	if (!nCols || options.quoting == 0)
+		return false;
+	if (options.colSeparator.Length() != 1 || (unsigned)options.colSeparator.GetChar(0) > 127)
+		return false;
+	if (options.quoteChar.Length() != 1 || (unsigned)options.quoteChar.GetChar(0) > 127)
+		return false;
+
+	if (options.quoting == 1)
+	{
+		wxArrayString names;
+		for (col = 0 ; col < nCols ; col++)
+		{
+			wxString name = wxString(PQfname(desc, col), *conn->GetConv());
+			if (names.Index(name) != wxNOT_FOUND)
+				return false;
+			names.Add(name);
+		}
+	}
+
+	return true;
+}
+
+
+bool pgExportThread::ExportCopy(PGresult *desc)
+{
+	int col, nCols = PQnfields(desc);
+
+	wxString sql = wxT("COPY (") + GetSingleQuery(query) + wxT(") TO STDOUT WITH (FORMAT csv");
+	sql += wxT(", DELIMITER ") + conn->qtDbString(options.colSeparator);
+	sql += wxT(", QUOTE ") + conn->qtDbString(options.quoteChar);
+
+	if (options.quoting == 2)
+		sql += wxT(", FORCE_QUOTE *");
+	else
+	{
+		wxString quoted;
+		for (col = 0 ; col < nCols ; col++)
+		{
+			switch (pgSet::TypClassFromOid(PQftype(desc, col)))
+			{
+				case PGTYPCLASS_NUMERIC:
+				case PGTYPCLASS_BOOL:
+					break;
+				default:
+					if (!quoted.IsEmpty())
+						quoted += wxT(", ");
+					quoted += qtIdent(wxString(PQfname(desc, col), *conn->GetConv()));
+					break;
+			}
+		}
+		if (!quoted.IsEmpty())
+			sql += wxT(", FORCE_QUOTE (") + quoted + wxT(")");
+	}
+	sql += wxT(")");
+
+	wxLogSql(wxT("Export query (%s:%d): %s"), conn->GetHost().c_str(), conn->GetPort(), sql.c_str());
+
+	if (options.colNames && !WriteHeader(desc))
+		return false;
+
+	conn->SetConnCancel();
+	if (!PQsendQuery(conn->conn, sql.mb_str(*conn->GetConv())))
+	{
+		error = conn->GetLastError();
+		conn->ResetConnCancel();
+		return false;
+	}
+	usedCopy = true;
+
+	bool ok = true;
+
+	PGresult *res = NextResult();
+	if (res && PQresultStatus(res) == PGRES_COPY_OUT)
+	{
+		PQclear(res);
+
+		while (true)
+		{
+			char *data;
+			int len = PQgetCopyData(conn->conn, &data, 1);
+
+			if (len > 0)
+			{
+				// Every call returns one complete row, terminated by \n
+				if (ok)
+				{
+					ok = writer->WriteRow(data, len - 1);
+					if (ok)
+						RowWritten();
+					else
+						error = writer->GetError();
+				}
+				PQfreemem(data);
+
+				// Stop receiving, if the file can't be written
+				if (!ok)
+					CheckCancel();
+			}
+			else if (len == 0)
+			{
+				CheckCancel();
+				if (!conn->WaitForInput(PGCONN_CANCEL_CHECK_INTERVAL) || !PQconsumeInput(conn->conn))
+					break;
+			}
+			else
+				break;
+		}
+
+		res = NextResult();
+	}
+
+	while (res)
+	{
+		if (PQresultStatus(res) != PGRES_COMMAND_OK && error.IsEmpty())
+			error = wxString(PQresultErrorMessage(res), *conn->GetConv());
+		PQclear(res);
+		res = NextResult();
+	}
+	conn->ResetConnCancel();
+
+	return ok && error.IsEmpty();
+}
+
+
+bool pgExportThread::ExportRows()
+{
+	wxLogSql(wxT("Export query (%s:%d): %s"), conn->GetHost().c_str(), conn->GetPort(), query.c_str());
+
+	conn->SetConnCancel();
+	if (!PQsendQuery(conn->conn, query.mb_str(*conn->GetConv())) || !PQsetSingleRowMode(conn->conn))
+	{
+		error = conn->GetLastError();
+		conn->ResetConnCancel();
+		return false;
+	}
+
+	wxArrayInt colClasses;
+	bool inSet = false, written = false, ok = true;
+	int col, nCols = 0;
+
+	PGresult *res;
+	while ((res = NextResult()) != NULL)
+	{
+		ExecStatusType status = PQresultStatus(res);
+
+		if ((status == PGRES_SINGLE_TUPLE || status == PGRES_TUPLES_OK) && !inSet && ok)
+		{
+			// A later result set replaces the one written so far
+			if (written)
+			{
+				ok = writer->Open();
+
+				wxCriticalSectionLocker lock(progressLock);
+				rows = 0;
+				bytes = 0;
+			}
+
+			nCols = PQnfields(res);
+			colClasses.Empty();
+			for (col = 0 ; col < nCols ; col++)
+				colClasses.Add(pgSet::TypClassFromOid(PQftype(res, col)));
+			writer->SetColumns(colClasses);
+
+			if (ok && options.colNames)
+				ok = WriteHeader(res);
+
+			inSet = true;
+			written = true;
+		}
+
+		if (status == PGRES_SINGLE_TUPLE && ok)
+		{
+			for (col = 0 ; col < nCols ; col++)
+				writer->AddValue(col, PQgetvalue(res, 0, col), PQgetlength(res, 0, col));
+
+			ok = writer->EndRow();
+			if (ok)
+				RowWritten();
+		}
+		else if (status == PGRES_TUPLES_OK)
+			inSet = false;
+		else if (status != PGRES_COMMAND_OK && status != PGRES_EMPTY_QUERY && error.IsEmpty())
+			error = wxString(PQresultErrorMessage(res), *conn->GetConv());
+
+		PQclear(res);
+
+		// The remaining results must still be read, but are of no use
+		if (!ok)
+		{
+			if (error.IsEmpty())
+				error = writer->GetError();
+			CheckCancel();
+		}
+	}
+	conn->ResetConnCancel();
+
+	return ok && error.IsEmpty();
+}
+
+
+// Write a result set, which is read without moving its cursor as the grid
+// showing it still uses it
+bool pgExportThread::ExportSet()
+{
+	writer->SetColumns(setClasses);
+	if (options.colNames && !writer->WriteHeader(setNames))
+		return false;
+
+	long row;
+	int col, nCols = setClasses.GetCount();
+	for (row = 0 ; row < estimatedRows ; row++)
+	{
+		for (col = 0 ; col < nCols ; col++)
+		{
+			const char *value = set->GetValueAt(rowOrder ? rowOrder[row] : row, col);
+			writer->AddValue(col, value, strlen(value));
+		}
+
+		if (!writer->EndRow() || !RowWritten())
+			return false;
+	}
+	return true;
+}
+
+
+// Wait for the next result, looking for a cancel request meanwhile
+PGresult *pgExportThread::NextResult()
+{
+	bool failed;
+	PGresult *res = conn->WaitForResult(CancelCheck, this, failed);
+
+	if (failed && error.IsEmpty())
+		error = conn->GetLastError();
+	return res;
+}
+
+
+// Send a cancel request to the server, if the user (or a failed write)
+// asked for it
+bool pgExportThread::CheckCancel()
+{
+	bool cancel = CancelCheck(this);
+
+	if (cancel)
+		conn->CancelExecution();
+	return cancel;
+}
+
+
+// Whether to cancel the query; pgConn::WaitForResult() sends the request
+bool pgExportThread::CancelCheck(void *arg)
+{
+	pgExportThread *thread = (pgExportThread *)arg;
+	wxCriticalSectionLocker lock(thread->progressLock);
+
+	return thread->cancelled || !thread->error.IsEmpty();
+}
+
+
+bool pgExportThread::WriteHeader(PGresult *res)
+{
+	wxArrayString names;
+	int col, nCols = PQnfields(res);
+
+	for (col = 0 ; col < nCols ; col++)
+		names.Add(wxString(PQfname(res, col), *conn->GetConv()));
+
+	return writer->WriteHeader(names);
+}
+
+
+// Count a row, and tell whether to go on
+bool pgExportThread::RowWritten()
+{
+	wxCriticalSectionLocker lock(progressLock);
+	rows++;
+	bytes = writer->GetBytes();
+	return !cancelled;
+}
@@ -0,0 +1,303 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgExportWriter.cpp - Buffered writer of export files
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/wfstream.h>
+#include <wx/zstream.h>
+
+// App headers
+#include "db/pgSet.h"
+#include "db/pgExportWriter.h"
+
+
+pgExportWriter::pgExportWriter(const pgExportOptions &_options, wxMBConv &_conv)
+	: options(_options), conv(_conv),
+	  fileConv(_options.unicode ? (wxMBConv &)wxConvUTF8 : (wxMBConv &)wxConvLibc)
+{
+	// Values already in the charset of the file are copied as they are
+	convert = (&conv != &fileConv);
+
+	colSeparator = options.colSeparator.mb_str(conv);
+	colSeparatorLen = colSeparator ? strlen(colSeparator) : 0;
+	quoteChar = options.quoteChar.mb_str(conv);
+	quoteCharLen = quoteChar ? strlen(quoteChar) : 0;
+	rowSeparator = options.rowSeparator.mb_str(conv);
+	rowSeparatorLen = rowSeparator ? strlen(rowSeparator) : 0;
+
+	bufferSize = PGEXPORT_BUFFER_SIZE + PGEXPORT_BUFFER_SIZE / 4;
+	buffer = (char *)malloc(bufferSize);
+	buffered = 0;
+
+	file = NULL;
+	zip = NULL;
+
+	bytes = 0;
+	skipped = 0;
+}
+
+
+pgExportWriter::~pgExportWriter()
+{
+	Close();
+	free(buffer);
+}
+
+
+// Reopening the file drops what was written to it so far
+bool pgExportWriter::Open()
+{
+	buffered = 0;
+	rowEnds.Empty();
+
+	Close();
+
+	file = new wxFileOutputStream(options.filename);
+	if (!file->IsOk())
+	{
+		delete file;
+		file = NULL;
+		error = wxString::Format(_("Failed to open file %s."), options.filename.c_str());
+		return false;
+	}
+
+	if (options.compress)
+	{
+		if (!wxZlibOutputStream::CanHandleGZip())
+		{
+			Close();
+			error = _("The zlib library pgAdmin is using cannot write gzip files.");
+			return false;
+		}
+		zip = new wxZlibOutputStream(*file, wxZ_DEFAULT_COMPRESSION, wxZLIB_GZIP);
+	}
+
+	bytes = 0;
+	return true;
+}
+
+
+bool pgExportWriter::Close()
+{
+	if (!file)
+		return true;
+
+	bool ok = Flush();
+
+	// Closing the compressor writes the gzip trailer
+	if (zip)
+	{
+		if (!zip->Close() && ok)
+		{
+			error = wxString::Format(_("Could not write the file %s: Errcode=%d."), options.filename.c_str(), wxSysErrorCode());
+			ok = false;
+		}
+		delete zip;
+		zip = NULL;
+	}
+
+	if (!file->Close() && ok)
+	{
+		error = wxString::Format(_("Could not write the file %s: Errcode=%d."), options.filename.c_str(), wxSysErrorCode());
+		ok = false;
+	}
+	delete file;
+	file = NULL;
+
+	return ok;
+}
+
+
+void pgExportWriter::SetColumns(const wxArrayInt &typClasses)
+{
+	quoteCols.Empty();
+
+	size_t col;
+	for (col = 0 ; col < typClasses.GetCount() ; col++)
+	{
+		bool quote = options.quoting == 2;
+		if (options.quoting == 1)
+		{
+			switch (typClasses.Item(col))
+			{
+				case PGTYPCLASS_NUMERIC:
+				case PGTYPCLASS_BOOL:
+					break;
+				default:
+					quote = true;
+					break;
+			}
+		}
+		quoteCols.Add(quote ? 1 : 0);
+	}
+}
+
+
+bool pgExportWriter::WriteHeader(const wxArrayString &names)
+{
+	size_t col;
+	for (col = 0 ; col < names.GetCount() ; col++)
+	{
+		wxCharBuffer name = names.Item(col).mb_str(conv);
+		if (name)
+			AddField(col, name, strlen(name), options.quoting != 0);
+		else
+			AddField(col, "", 0, options.quoting != 0);
+	}
+	return EndRow();
+}
+
+
+void pgExportWriter::AddField(int col, const char *value, size_t len, bool quote)
+{
+	if (col)
+		Append(colSeparator, colSeparatorLen);
+
+	if (!quote || !quoteCharLen)
+	{
+		Append(value, len);
+		return;
+	}
+
+	// Double the quote characters within the value
+	const char *end = value + len;
+	Append(quoteChar, quoteCharLen);
+	while (value < end)
+	{
+		const char *quotePos = FindQuote(value, end);
+		if (!quotePos)
+		{
+			Append(value, end - value);
+			break;
+		}
+		Append(value, quotePos + quoteCharLen - value);
+		Append(quoteChar, quoteCharLen);
+		value = quotePos + quoteCharLen;
+	}
+	Append(quoteChar, quoteCharLen);
+}
+
+
+const char *pgExportWriter::FindQuote(const char *data, const char *end) const
+{
+	if (quoteCharLen == 1)
+		return (const char *)memchr(data, quoteChar[0], end - data);
+
+	while (data + quoteCharLen <= end)
+	{
+		data = (const char *)memchr(data, quoteChar[0], end - data - quoteCharLen + 1);
+		if (!data)
+			return NULL;
+		if (!memcmp(data, quoteChar, quoteCharLen))
+			return data;
+		data++;
+	}
+	return NULL;
+}
+
+
+// A single row may exceed the buffer; it is flushed at the end of rows only,
+// so that rows (and multibyte characters) are always converted in one piece
+void pgExportWriter::Grow(size_t len)
+{
+	while (buffered + len > bufferSize)
+		bufferSize *= 2;
+	buffer = (char *)realloc(buffer, bufferSize);
+}
+
+
+bool pgExportWriter::EndRow()
+{
+	Append(rowSeparator, rowSeparatorLen);
+	if (convert)
+		rowEnds.Add(buffered);
+
+	if (buffered >= PGEXPORT_BUFFER_SIZE)
+		return Flush();
+	return true;
+}
+
+
+bool pgExportWriter::WriteRow(const char *data, size_t len)
+{
+	Append(data, len);
+	return EndRow();
+}
+
+
+bool pgExportWriter::Flush()
+{
+	if (!buffered)
+		return true;
+
+	bool ok;
+	if (!convert)
+		ok = WriteFile(buffer, buffered);
+	else
+	{
+		// Convert the whole buffer at once, and only look at the rows
+		// one by one if that fails
+		wxString text(buffer, conv, buffered);
+		wxCharBuffer converted;
+		if (!text.IsEmpty())
+			converted = text.mb_str(fileConv);
+
+		if (converted)
+			ok = WriteFile(converted, strlen(converted));
+		else
+			ok = FlushRows();
+	}
+
+	buffered = 0;
+	rowEnds.Empty();
+	return ok;
+}
+
+
+bool pgExportWriter::FlushRows()
+{
+	size_t row, start = 0;
+	for (row = 0 ; row < rowEnds.GetCount() ; row++)
+	{
+		size_t end = rowEnds.Item(row);
+
+		wxString line(buffer + start, conv, end - start);
+		wxCharBuffer converted;
+		if (!line.IsEmpty())
+			converted = line.mb_str(fileConv);
+
+		if (!converted)
+			skipped++;
+		else if (!WriteFile(converted, strlen(converted)))
+			return false;
+
+		start = end;
+	}
+	return true;
+}
+
+
+bool pgExportWriter::WriteFile(const char *data, size_t len)
+{
+	wxOutputStream *out = zip ? (wxOutputStream *)zip : (wxOutputStream *)file;
+
+	if (!out || out->Write(data, len).LastWrite() != len)
+	{
+		if (error.IsEmpty())
+			error = wxString::Format(_("Could not write the file %s: Errcode=%d."), options.filename.c_str(), wxSysErrorCode());
+		return false;
+	}
+
+	bytes += len;
+	return true;
+}
@@ -0,0 +1,491 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgFileExecThread.cpp - Run the statements of a SQL file as it is read
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+
+#include <string.h>
+
+// PostgreSQL headers
+#include <libpq-fe.h>
+
+// App headers
+#include "db/pgConn.h"
+#include "db/pgFileExecThread.h"
+#include "db/pgQueryStats.h"
+
+
+static bool IsSpace(char c)
+{
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+
+// Whether a line of COPY data, with its line end if any, is the \. which
+// ends the data
+static bool IsEndOfCopyData(const char *line, size_t len)
+{
+	if (len && line[len - 1] == '\n')
+		len--;
+	if (len && line[len - 1] == '\r')
+		len--;
+	return len == 2 && line[0] == '\\' && line[1] == '.';
+}
+
+
+// How much of a piece of UTF-8 text can be converted on its own, without
+// the bytes of a character cut off at its end
+static size_t CompleteUtf8Length(const char *data, size_t len)
+{
+	size_t end = len;
+	while (end && ((unsigned char)data[end - 1] & 0xC0) == 0x80)
+		end--;
+	if (end && (unsigned char)data[end - 1] >= 0xC0)
+		end--;
+	return end ? end : len;
+}
+
+
+pgFileExecThread::pgFileExecThread(pgConn *_conn, const wxString &_fileName, bool utf8, wxFileOffset startOffset, long startLine,
+                                   wxEvtHandler *_caller, long _eventId)
+	: wxThread(wxTHREAD_JOINABLE)
+{
+	conn = _conn;
+	fileName = _fileName;
+	if (utf8)
+		fileConv = &wxConvUTF8;
+	else
+		fileConv = &wxConvLibc;
+	caller = _caller;
+	eventId = _eventId;
+
+	length = 0;
+	buffer = new char[PGFILEEXEC_BUFFER_SIZE];
+	bufferLength = bufferPos = 0;
+	eof = false;
+
+	offset = statementOffset = startOffset;
+	line = statementLine = startLine;
+	statements = 0;
+
+	cancelled = false;
+	succeeded = false;
+	resumeOffset = 0;
+	resumeLine = 1;
+}
+
+
+pgFileExecThread::~pgFileExecThread()
+{
+	delete[] buffer;
+}
+
+
+void pgFileExecThread::Cancel()
+{
+	wxCriticalSectionLocker lock(progressLock);
+	cancelled = true;
+}
+
+
+void pgFileExecThread::GetProgress(wxFileOffset &_offset, long &_statements)
+{
+	wxCriticalSectionLocker lock(progressLock);
+	_offset = offset;
+	_statements = statements;
+}
+
+
+wxString pgFileExecThread::GetMessagesAndClear()
+{
+	wxCriticalSectionLocker lock(progressLock);
+	wxString msg = messages;
+	messages = wxEmptyString;
+	return msg;
+}
+
+
+void *pgFileExecThread::Entry()
+{
+	wxStopWatch stopwatch;
+	wxFileOffset startOffset = offset;
+
+	wxLogSql(wxT("Execute file (%s:%d): %s"), conn->GetHost().c_str(), conn->GetPort(), fileName.c_str());
+
+	if (!file.Open(fileName))
+		Fail(wxString::Format(_("Could not open file %s."), fileName.c_str()));
+	else
+	{
+		length = file.Length();
+		if (offset > 0 && file.Seek(offset) != offset)
+			Fail(wxString::Format(_("Could not seek to offset %s of file %s."),
+			                      wxLongLong(offset).ToString().c_str(), fileName.c_str()));
+	}
+
+	// The connection is ours until the file is done
+	conn->LockExecution();
+	conn->RegisterNoticeProcessor(NoticeProcessor, this);
+
+	bool ok = error.IsEmpty();
+	while (ok)
+	{
+		if (bufferPos == bufferLength && !Fill())
+			break;
+
+		// The white space between statements belongs to none of them, so
+		// that a statement starts where its first line does
+		if (!statement.GetDataLen())
+		{
+			size_t skip = 0;
+			while (bufferPos + skip < bufferLength && IsSpace(buffer[bufferPos + skip]))
+				skip++;
+
+			if (skip)
+			{
+				Consumed(skip);
+				statementOffset = offset;
+				statementLine = line;
+				continue;
+			}
+		}
+
+		bool end;
+		size_t used = lexer.Scan(buffer + bufferPos, bufferLength - bufferPos, end);
+		statement.AppendData(buffer + bufferPos, used);
+		Consumed(used);
+
+		if (end)
+			ok = RunStatement();
+	}
+
+	// The last statement may lack its semicolon
+	if (ok && error.IsEmpty() && statement.GetDataLen())
+		ok = RunStatement();
+
+	conn->RegisterNoticeProcessor(0, 0);
+	conn->UnlockExecution();
+	file.Close();
+
+	succeeded = ok && error.IsEmpty() && !cancelled;
+	if (!succeeded)
+	{
+		// The statement which didn't complete is run again on resuming
+		resumeOffset = statementOffset;
+		resumeLine = statementLine;
+	}
+
+	pgQueryStats::Get()->Record(wxT("\\i ") + fileName, wxT("pgFileExecThread"), stopwatch.Time(), statements, offset - startOffset);
+
+	wxCommandEvent ev(wxEVT_COMMAND_MENU_SELECTED, eventId);
+	caller->AddPendingEvent(ev);
+
+	return NULL;
+}
+
+
+// Read more of the file, keeping what's left unconsumed of the buffer
+bool pgFileExecThread::Fill()
+{
+	if (eof)
+		return false;
+
+	size_t left = bufferLength - bufferPos;
+	if (left && bufferPos)
+		memmove(buffer, buffer + bufferPos, left);
+	bufferPos = 0;
+	bufferLength = left;
+
+	ssize_t count = file.Read(buffer + left, PGFILEEXEC_BUFFER_SIZE - left);
+	if (count == wxInvalidOffset)
+	{
+		Fail(wxString::Format(_("Could not read file %s."), fileName.c_str()));
+		return false;
+	}
+	if (!count)
+	{
+		eof = true;
+		return false;
+	}
+	bufferLength += count;
+
+	// A byte order mark says the file is UTF-8, whatever the settings say
+	if (offset == 0 && bufferLength >= 3 && !memcmp(buffer, "\xEF\xBB\xBF", 3))
+	{
+		fileConv = &wxConvUTF8;
+		bufferPos = 3;
+		{
+			wxCriticalSectionLocker lock(progressLock);
+			offset = 3;
+		}
+		statementOffset = 3;
+	}
+
+	return true;
+}
+
+
+void pgFileExecThread::Consumed(size_t count)
+{
+	const char *data = buffer + bufferPos, *end = data + count;
+	while ((data = (const char *)memchr(data, '\n', end - data)) != NULL)
+	{
+		line++;
+		data++;
+	}
+	bufferPos += count;
+
+	wxCriticalSectionLocker lock(progressLock);
+	offset += count;
+}
+
+
+void pgFileExecThread::Fail(const wxString &msg)
+{
+	wxCriticalSectionLocker lock(progressLock);
+	if (!error.IsEmpty())
+		return;
+
+	error = msg;
+	failedStatement = wxString((const char *)statement.GetData(), *fileConv, statement.GetDataLen()).Strip(wxString::both);
+	if (failedStatement.Length() > PGFILEEXEC_STATEMENT_LENGTH)
+		failedStatement = failedStatement.Left(PGFILEEXEC_STATEMENT_LENGTH) + wxT("...");
+}
+
+
+bool pgFileExecThread::RunStatement()
+{
+	{
+		wxCriticalSectionLocker lock(progressLock);
+		if (cancelled)
+			return false;
+	}
+
+	bool ok = true;
+	wxString sql((const char *)statement.GetData(), *fileConv, statement.GetDataLen());
+
+	if (sql.IsEmpty() && statement.GetDataLen())
+	{
+		Fail(_("The statement could not be converted from the encoding of the file; check the Unicode file setting in the options."));
+		return false;
+	}
+
+	if (lexer.IsMetaCommand())
+	{
+		// Most psql commands of dumps just set psql up, but running what
+		// follows \connect on the wrong database would do harm
+		wxString command = sql.Strip(wxString::both);
+		wxString name = command.BeforeFirst(' ').BeforeFirst('\t');
+
+		if (name == wxT("\\c") || name == wxT("\\connect"))
+		{
+			Fail(wxString::Format(_("The file switches databases with \"%s\", which is a psql command.\nConnect to that database, and execute the file again to resume after the command."),
+			                      command.c_str()));
+			// Resume after it
+			statementOffset = offset;
+			statementLine = line;
+			return false;
+		}
+
+		wxCriticalSectionLocker lock(progressLock);
+		messages += wxString::Format(_("Skipped psql command: %s"), command.c_str()) + wxT("\n");
+	}
+	else if (lexer.HasContent())
+	{
+		conn->SetConnCancel();
+		if (!PQsendQuery(conn->conn, sql.mb_str(*conn->GetConv())))
+		{
+			Fail(conn->GetLastError());
+			conn->ResetConnCancel();
+			return false;
+		}
+
+		wxString msg;
+		PGresult *res;
+		while ((res = NextResult()) != NULL)
+		{
+			switch (PQresultStatus(res))
+			{
+				case PGRES_COPY_IN:
+					if (!CopyIn() && msg.IsEmpty())
+						msg = conn->GetLastError();
+					break;
+
+				case PGRES_COPY_OUT:
+				{
+					// Nowhere to write it to
+					char *data;
+					while (PQgetCopyData(conn->conn, &data, 0) > 0)
+						PQfreemem(data);
+					break;
+				}
+
+				case PGRES_BAD_RESPONSE:
+				case PGRES_NONFATAL_ERROR:
+				case PGRES_FATAL_ERROR:
+					if (msg.IsEmpty())
+						msg = wxString(PQresultErrorMessage(res), *conn->GetConv());
+					break;
+
+				default:
+					break;
+			}
+			PQclear(res);
+		}
+		conn->ResetConnCancel();
+
+		if (!msg.IsEmpty())
+			Fail(msg);
+		ok = error.IsEmpty();
+
+		if (ok)
+		{
+			wxCriticalSectionLocker lock(progressLock);
+			statements++;
+		}
+	}
+
+	statement.SetDataLen(0);
+	statementOffset = offset;
+	statementLine = line;
+
+	return ok;
+}
+
+
+// Send the data following a COPY ... FROM stdin; it starts on the line after
+// the statement, as in psql, and ends at a line of \. or at the end of the
+// file
+bool pgFileExecThread::CopyIn()
+{
+	bool skipLine = true, midLine = false, done = false, ok = true;
+
+	while (!done && ok)
+	{
+		if (bufferPos == bufferLength && !Fill())
+			break;
+
+		const char *data = buffer + bufferPos;
+		size_t avail = bufferLength - bufferPos, used = 0, skipped = 0, send = 0;
+		bool more = false;
+
+		while (used < avail)
+		{
+			const char *start = data + used;
+			const char *nl = (const char *)memchr(start, '\n', avail - used);
+			size_t lineLength = nl ? nl - start + 1 : avail - used;
+
+			if (skipLine)
+			{
+				// The rest of the line of the statement is no data
+				used += lineLength;
+				skipped = send = used;
+				skipLine = (nl == NULL);
+				continue;
+			}
+
+			if (!nl && !eof)
+			{
+				// An incomplete line waits for the next read, unless it
+				// fills the whole buffer; then the complete characters of
+				// it are sent (it's too long to be the end marker)
+				if (used || bufferPos || bufferLength < PGFILEEXEC_BUFFER_SIZE)
+				{
+					more = true;
+					break;
+				}
+				if (fileConv == &wxConvUTF8)
+					lineLength = CompleteUtf8Length(start, lineLength);
+			}
+			else if (!midLine && IsEndOfCopyData(start, lineLength))
+			{
+				used += lineLength;
+				done = true;
+				break;
+			}
+
+			used += lineLength;
+			send = used;
+			midLine = (nl == NULL);
+		}
+
+		if (send > skipped)
+		{
+			wxString text(data + skipped, *fileConv, send - skipped);
+			wxCharBuffer converted = text.mb_str(*conn->GetConv());
+			const char *out = converted;
+
+			if (text.IsEmpty() || !out)
+			{
+				Fail(_("The COPY data could not be converted from the encoding of the file."));
+				ok = false;
+			}
+			else if (PQputCopyData(conn->conn, out, strlen(out)) != 1)
+				ok = false;
+		}
+		Consumed(used);
+
+		if (CheckCancel())
+			ok = false;
+
+		if (ok && more && !Fill() && !eof)
+			ok = false;
+	}
+
+	if (PQputCopyEnd(conn->conn, ok ? NULL : "aborted") != 1)
+		ok = false;
+
+	return ok;
+}
+
+
+// Wait for the next result, looking for a cancel request meanwhile
+PGresult *pgFileExecThread::NextResult()
+{
+	bool failed;
+	PGresult *res = conn->WaitForResult(CancelCheck, this, failed);
+
+	if (failed)
+		Fail(conn->GetLastError());
+	return res;
+}
+
+
+// Send a cancel request to the server, if the user asked for it
+bool pgFileExecThread::CheckCancel()
+{
+	bool cancel = CancelCheck(this);
+
+	if (cancel)
+		conn->CancelExecution();
+	return cancel;
+}
+
+
+// Whether to cancel the query; pgConn::WaitForResult() sends the request
+bool pgFileExecThread::CancelCheck(void *arg)
+{
+	pgFileExecThread *thread = (pgFileExecThread *)arg;
+	wxCriticalSectionLocker lock(thread->progressLock);
+
+	return thread->cancelled;
+}
+
+
+void pgFileExecThread::NoticeProcessor(void *arg, const char *message)
+{
+	pgFileExecThread *thread = (pgFileExecThread *)arg;
+	wxString str(message, *thread->conn->GetConv());
+
+	wxCriticalSectionLocker lock(thread->progressLock);
+	thread->messages += str;
+}
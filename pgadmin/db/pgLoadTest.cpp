@@ -0,0 +1,291 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgLoadTest.cpp - Concurrent clients running a script in a loop
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+
+// PostgreSQL headers
+#include <libpq-fe.h>
+
+// App headers
+#include "db/pgConn.h"
+#include "db/pgQueryThread.h"
+#include "db/pgQueryResultEvent.h"
+#include "db/pgLoadTest.h"
+#include "utils/sqlLexer.h"
+
+wxWindowID LOADTEST_RESULT_ID = ::wxNewId();
+
+BEGIN_EVENT_TABLE(pgLoadTest, wxEvtHandler)
+	EVT_PGQUERYRESULT(LOADTEST_RESULT_ID, pgLoadTest::OnResult)
+END_EVENT_TABLE()
+
+
+pgLoadTestClient::pgLoadTestClient(int _number)
+{
+	number = _number;
+	conn = NULL;
+	thread = NULL;
+	statement = 0;
+	iterationTime = 0;
+	rollingBack = false;
+	transactions = 0;
+	errors = 0;
+	finished = false;
+}
+
+
+pgLoadTest::pgLoadTest(pgConn *_conn, const wxString &script, int _clients, long _seconds, long _iterations,
+                       wxEvtHandler *_caller, long _eventId)
+{
+	conn = _conn;
+	statements = sqlLexer::Split(script);
+	clientCount = _clients;
+	seconds = _seconds;
+	iterations = _iterations;
+	caller = _caller;
+	eventId = _eventId;
+
+	running = false;
+	elapsed = 0;
+	transactions = 0;
+	errors = 0;
+	totalLatency = 0;
+
+	int bucket;
+	for (bucket = 0 ; bucket < PGQUERYSTATS_BUCKETS ; bucket++)
+		histogram[bucket] = 0;
+}
+
+
+pgLoadTest::~pgLoadTest()
+{
+	Stop();
+	WX_CLEAR_ARRAY(clients);
+}
+
+
+bool pgLoadTest::Start()
+{
+	if (statements.IsEmpty())
+	{
+		lastError = _("There are no statements to run.");
+		return false;
+	}
+
+	int i;
+	for (i = 0 ; i < clientCount ; i++)
+	{
+		pgLoadTestClient *client = new pgLoadTestClient(i + 1);
+		clients.Add(client);
+
+		client->conn = conn->Duplicate(wxString::Format(wxT("pgAdmin load test %d"), i + 1));
+		if (!client->conn || client->conn->GetStatus() != PGCONN_OK)
+		{
+			lastError = wxString::Format(_("Could not open the connection of client %d."), i + 1);
+			if (client->conn)
+				lastError += wxT("\n") + client->conn->GetLastError();
+			Stop();
+			return false;
+		}
+
+		client->thread = new pgQueryThread(client->conn, this);
+		client->thread->SetEventOnCancellation(false);
+
+		if (client->thread->Create() != wxTHREAD_NO_ERROR || client->thread->Run() != wxTHREAD_NO_ERROR)
+		{
+			lastError = wxString::Format(_("Could not start the thread of client %d."), i + 1);
+			Stop();
+			return false;
+		}
+	}
+
+	running = true;
+	stopwatch.Start();
+
+	for (i = 0 ; i < clientCount ; i++)
+		RunNext(clients.Item(i));
+
+	return true;
+}
+
+
+void pgLoadTest::Stop()
+{
+	if (running)
+		elapsed = stopwatch.Time();
+	running = false;
+
+	// Cancel all first, for the clients to stop side by side
+	size_t i;
+	for (i = 0 ; i < clients.GetCount() ; i++)
+	{
+		pgLoadTestClient *client = clients.Item(i);
+		if (client->thread && client->thread->IsRunning())
+			client->thread->CancelExecution();
+	}
+
+	for (i = 0 ; i < clients.GetCount() ; i++)
+	{
+		pgLoadTestClient *client = clients.Item(i);
+		if (client->thread)
+		{
+			if (client->thread->IsRunning())
+				client->thread->Wait();
+			delete client->thread;
+			client->thread = NULL;
+		}
+		if (client->conn)
+		{
+			client->conn->Close();
+			delete client->conn;
+			client->conn = NULL;
+		}
+		client->finished = true;
+	}
+}
+
+
+double pgLoadTest::GetElapsed() const
+{
+	return (running ? stopwatch.Time() : elapsed) / 1000.0;
+}
+
+
+double pgLoadTest::GetTps() const
+{
+	double secs = GetElapsed();
+	return secs > 0 ? transactions / secs : 0;
+}
+
+
+double pgLoadTest::GetAverageLatency() const
+{
+	return transactions ? totalLatency / transactions : 0;
+}
+
+
+double pgLoadTest::GetFairness() const
+{
+	double sum = 0, squares = 0;
+
+	size_t i;
+	for (i = 0 ; i < clients.GetCount() ; i++)
+	{
+		double done = clients.Item(i)->transactions;
+		sum += done;
+		squares += done * done;
+	}
+
+	if (squares <= 0)
+		return 1;
+
+	return sum * sum / (clients.GetCount() * squares);
+}
+
+
+bool pgLoadTest::TimeIsUp() const
+{
+	return seconds > 0 && stopwatch.Time() >= seconds * 1000;
+}
+
+
+void pgLoadTest::RunNext(pgLoadTestClient *client)
+{
+	// The events of the queries executed before have all been handled
+	client->thread->DeleteExecutedQueries();
+	client->thread->AddQuery(client->rollingBack ? wxString(wxT("ROLLBACK")) : statements.Item(client->statement),
+	                         NULL, LOADTEST_RESULT_ID, client);
+}
+
+
+// Ends the test once all of the clients are done
+void pgLoadTest::Finish()
+{
+	size_t i;
+	for (i = 0 ; i < clients.GetCount() ; i++)
+	{
+		if (!clients.Item(i)->finished)
+			return;
+	}
+
+	Stop();
+
+	wxCommandEvent ev(wxEVT_COMMAND_MENU_SELECTED, eventId);
+	ev.SetExtraLong(1);
+	caller->AddPendingEvent(ev);
+}
+
+
+void pgLoadTest::OnResult(pgQueryResultEvent &ev)
+{
+	pgLoadTestClient *client = (pgLoadTestClient *)ev.GetClientData();
+
+	// Left over from a client stopped meanwhile
+	if (!running || !client || !client->thread || ev.GetThreadID() != client->thread->GetId())
+		return;
+
+	pgBatchQuery *qry = ev.GetQuery();
+	int rc = qry->ReturnCode();
+
+	if (client->rollingBack)
+	{
+		// Neither a transaction nor another error of the script
+		if (rc != PGRES_COMMAND_OK)
+			lastError = qry->GetErrorMessage();
+		client->rollingBack = false;
+	}
+	else if (rc == PGRES_TUPLES_OK || rc == PGRES_COMMAND_OK || rc == PGRES_EMPTY_QUERY)
+	{
+		client->iterationTime += qry->Elapsed();
+		client->statement++;
+
+		if (client->statement >= statements.GetCount())
+		{
+			client->transactions++;
+			transactions++;
+			totalLatency += client->iterationTime;
+			histogram[pgQueryStats::GetBucket((long)client->iterationTime)]++;
+
+			client->statement = 0;
+			client->iterationTime = 0;
+		}
+	}
+	else
+	{
+		// The rest of the iteration is skipped, as pgbench does
+		client->errors++;
+		errors++;
+		lastError = qry->GetErrorMessage();
+		if (lastError.IsEmpty())
+			lastError = client->conn->GetLastError();
+
+		client->statement = 0;
+		client->iterationTime = 0;
+
+		// A script with BEGIN would otherwise fail on "current transaction
+		// is aborted" from now on; pgbench rolls back as well
+		PGTransactionStatusType status = PQtransactionStatus(client->conn->connection());
+		client->rollingBack = (status == PQTRANS_INERROR || status == PQTRANS_INTRANS);
+	}
+	qry->Release();
+
+	if (!client->statement && ((iterations > 0 && client->transactions + client->errors >= iterations) || TimeIsUp()))
+	{
+		client->finished = true;
+		Finish();
+		return;
+	}
+
+	RunNext(client);
+}
@@ -0,0 +1,477 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgQueryStats.cpp - Client side statistics of the queries sent
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/file.h>
+
+// App headers
+#include "utils/misc.h"
+#include "db/pgQueryStats.h"
+
+#include <wx/arrimpl.cpp>
+WX_DEFINE_OBJARRAY(pgQueryStatsArray);
+
+// Upper bounds (in milliseconds) of the latency buckets; the last bucket
+// takes everything slower
+static const long bucketLimits[PGQUERYSTATS_BUCKETS - 1] =
+{
+	1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 5000
+};
+
+pgQueryStats *pgQueryStats::instance = NULL;
+wxString pgQueryStats::currentCaller;
+
+
+pgQueryStats::pgQueryStats()
+{
+	enabled = settings->GetQueryStatsEnabled();
+}
+
+
+void pgQueryStats::Init()
+{
+	if (!instance)
+		instance = new pgQueryStats();
+}
+
+
+pgQueryStats *pgQueryStats::Get()
+{
+	wxASSERT_MSG(instance, wxT("pgQueryStats::Init() has not been called"));
+	return instance;
+}
+
+
+void pgQueryStats::Cleanup()
+{
+	if (instance)
+	{
+		delete instance;
+		instance = NULL;
+	}
+}
+
+
+// Replace the literals (strings, numbers) of a query with '?', and runs of
+// white space and comments with a single blank, so that all executions of a
+// query generated with different values share one entry. Lists of literals
+// are folded into a single '?'.
+wxString pgQueryStats::Fingerprint(const wxString &sql)
+{
+	wxString result;
+	size_t len = sql.Length();
+	size_t pos = 0;
+	bool blank = false;
+
+	result.Alloc(len < PGQUERYSTATS_FINGERPRINT_LEN ? len : PGQUERYSTATS_FINGERPRINT_LEN);
+
+	while (pos < len && result.Length() < PGQUERYSTATS_FINGERPRINT_LEN)
+	{
+		wxChar c = sql.GetChar(pos);
+		wxChar next = pos + 1 < len ? sql.GetChar(pos + 1) : (wxChar)0;
+		wxChar prev = result.IsEmpty() ? (wxChar)' ' : (wxChar)result.Last();
+		bool literal = false;
+
+		if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+		{
+			blank = true;
+			pos++;
+			continue;
+		}
+		else if (c == '-' && next == '-')
+		{
+			while (pos < len && sql.GetChar(pos) != '\n')
+				pos++;
+			blank = true;
+			continue;
+		}
+		else if (c == '/' && next == '*')
+		{
+			pos += 2;
+			while (pos + 1 < len && !(sql.GetChar(pos) == '*' && sql.GetChar(pos + 1) == '/'))
+				pos++;
+			pos += 2;
+			blank = true;
+			continue;
+		}
+		else if (c == '\'' || ((c == 'E' || c == 'e') && next == '\'' && !wxIsalnum(prev)))
+		{
+			bool escapes = (c != '\'');
+			if (escapes)
+				pos++;
+			pos++;
+			while (pos < len)
+			{
+				wxChar ch = sql.GetChar(pos++);
+				if (escapes && ch == '\\')
+					pos++;
+				else if (ch == '\'')
+				{
+					if (pos < len && sql.GetChar(pos) == '\'')
+						pos++;
+					else
+						break;
+				}
+			}
+			literal = true;
+		}
+		else if (c == '$' && !wxIsalnum(prev))
+		{
+			// A dollar quoted string, or else a parameter symbol
+			size_t end = pos + 1;
+			while (end < len && (wxIsalnum(sql.GetChar(end)) || sql.GetChar(end) == '_'))
+				end++;
+
+			if (end < len && sql.GetChar(end) == '$')
+			{
+				wxString tag = sql.Mid(pos, end - pos + 1);
+				int close = sql.Mid(end + 1).Find(tag);
+				pos = close < 0 ? len : end + 1 + close + tag.Length();
+				literal = true;
+			}
+			else
+			{
+				if (blank && !result.IsEmpty())
+					result += wxT(" ");
+				result += sql.Mid(pos, end - pos);
+				pos = end;
+				blank = false;
+				continue;
+			}
+		}
+		else if (wxIsdigit(c) && !wxIsalnum(prev) && prev != '_')
+		{
+			while (pos < len && (wxIsdigit(sql.GetChar(pos)) || sql.GetChar(pos) == '.'))
+				pos++;
+			literal = true;
+		}
+		else if (c == '"')
+		{
+			// Quoted identifiers are kept
+			size_t end = pos + 1;
+			while (end < len && sql.GetChar(end) != '"')
+				end++;
+			if (blank && !result.IsEmpty())
+				result += wxT(" ");
+			result += sql.Mid(pos, end - pos + 1);
+			pos = end + 1;
+			blank = false;
+			continue;
+		}
+
+		if (literal)
+		{
+			// Fold "?, ?" into "?"
+			wxString trimmed = result;
+			trimmed.Trim();
+			if (trimmed.EndsWith(wxT("?,")))
+			{
+				result = trimmed.Left(trimmed.Length() - 1);
+				blank = false;
+				continue;
+			}
+			c = '?';
+		}
+		else
+			pos++;
+
+		if (blank && !result.IsEmpty())
+			result += wxT(" ");
+		result += c;
+		blank = false;
+	}
+
+	return result;
+}
+
+
+// Size of the values in a result, roughly the amount of data received
+wxLongLong pgQueryStats::ResultBytes(const PGresult *res)
+{
+	wxLongLong bytes = 0;
+
+	if (!res)
+		return bytes;
+
+	int rows = PQntuples(res), cols = PQnfields(res);
+	for (int row = 0 ; row < rows ; row++)
+	{
+		for (int col = 0 ; col < cols ; col++)
+			bytes += PQgetlength(res, row, col);
+	}
+
+	return bytes;
+}
+
+
+// Latency bucket of a query which took elapsed milliseconds
+int pgQueryStats::GetBucket(long elapsed)
+{
+	int bucket = 0;
+	while (bucket < PGQUERYSTATS_BUCKETS - 1 && elapsed >= bucketLimits[bucket])
+		bucket++;
+
+	return bucket;
+}
+
+
+wxString pgQueryStats::GetBucketLabel(int bucket)
+{
+	if (bucket < PGQUERYSTATS_BUCKETS - 1)
+	{
+		if (bucketLimits[bucket] >= 1000)
+			return wxString::Format(_("< %ld s"), bucketLimits[bucket] / 1000);
+		return wxString::Format(_("< %ld ms"), bucketLimits[bucket]);
+	}
+	return wxString::Format(_(">= %ld s"), bucketLimits[PGQUERYSTATS_BUCKETS - 2] / 1000);
+}
+
+
+void pgQueryStats::Record(const wxString &sql, const wxString &entryPoint, long elapsed, const PGresult *res)
+{
+	if (!enabled)
+		return;
+
+	Record(sql, entryPoint, elapsed, res ? PQntuples(res) : 0, ResultBytes(res));
+}
+
+
+void pgQueryStats::Record(const wxString &sql, const wxString &entryPoint, long elapsed, long rows, wxLongLong bytes)
+{
+	if (!enabled)
+		return;
+
+	bool uiThread = wxThread::IsMain();
+
+	wxString caller = entryPoint;
+	if (uiThread && !currentCaller.IsEmpty())
+		caller = currentCaller + wxT(" / ") + entryPoint;
+
+	wxString fingerprint = Fingerprint(sql);
+
+	int bucket = GetBucket(elapsed);
+
+	wxCriticalSectionLocker cs(lock);
+
+	wxString key = caller + wxT("\n") + fingerprint;
+	pgQueryStatsHash::iterator it = entries.find(key);
+	if (it == entries.end())
+	{
+		pgQueryStatsEntry entry;
+		entry.fingerprint = wxString(fingerprint.c_str());
+		entry.caller = wxString(caller.c_str());
+		entry.calls = 0;
+		entry.uiCalls = 0;
+		entry.rows = 0;
+		entry.bytes = 0;
+		entry.totalTime = 0;
+		entry.maxTime = 0;
+		memset(entry.histogram, 0, sizeof(entry.histogram));
+
+		it = entries.insert(pgQueryStatsHash::value_type(wxString(key.c_str()), entry)).first;
+	}
+
+	pgQueryStatsEntry &entry = it->second;
+	entry.calls++;
+	if (uiThread)
+		entry.uiCalls++;
+	entry.rows += rows;
+	entry.bytes += bytes;
+	entry.totalTime += elapsed;
+	if (elapsed > entry.maxTime)
+		entry.maxTime = elapsed;
+	entry.histogram[bucket]++;
+}
+
+
+// Copy the collected statistics, most expensive first
+static int CompareTotalTime(pgQueryStatsEntry **a, pgQueryStatsEntry **b)
+{
+	if ((*a)->totalTime == (*b)->totalTime)
+		return 0;
+	return (*a)->totalTime > (*b)->totalTime ? -1 : 1;
+}
+
+
+void pgQueryStats::GetEntries(pgQueryStatsArray &result)
+{
+	result.Empty();
+
+	{
+		wxCriticalSectionLocker cs(lock);
+
+		pgQueryStatsHash::iterator it;
+		for (it = entries.begin() ; it != entries.end() ; ++it)
+		{
+			// Deep copies, the strings are shared with other threads
+			pgQueryStatsEntry entry = it->second;
+			entry.fingerprint = wxString(it->second.fingerprint.c_str());
+			entry.caller = wxString(it->second.caller.c_str());
+			result.Add(entry);
+		}
+	}
+
+	result.Sort(CompareTotalTime);
+}
+
+
+void pgQueryStats::Clear()
+{
+	wxCriticalSectionLocker cs(lock);
+	entries.clear();
+}
+
+
+static wxString CsvValue(const wxString &str)
+{
+	wxString result = str;
+	result.Replace(wxT("\""), wxT("\"\""));
+	return wxT("\"") + result + wxT("\"");
+}
+
+
+bool pgQueryStats::ExportCSV(const wxString &filename)
+{
+	pgQueryStatsArray stats;
+	GetEntries(stats);
+
+	wxFile file;
+	if (!file.Create(filename, true))
+		return false;
+
+	wxString line = wxT("caller,query,calls,ui_calls,rows,bytes,total_ms,avg_ms,max_ms");
+	int bucket;
+	for (bucket = 0 ; bucket < PGQUERYSTATS_BUCKETS ; bucket++)
+		line += wxT(",") + CsvValue(GetBucketLabel(bucket));
+	line += wxT("\n");
+
+	bool ok = file.Write(line, wxConvUTF8);
+
+	size_t i;
+	for (i = 0 ; ok && i < stats.GetCount() ; i++)
+	{
+		pgQueryStatsEntry &entry = stats.Item(i);
+
+		line = CsvValue(entry.caller) + wxT(",") + CsvValue(entry.fingerprint)
+		       + wxString::Format(wxT(",%ld,%ld,%ld,"), entry.calls, entry.uiCalls, entry.rows)
+		       + entry.bytes.ToString() + wxT(",") + entry.totalTime.ToString()
+		       + wxString::Format(wxT(",%ld,%ld"), (entry.totalTime / entry.calls).ToLong(), entry.maxTime);
+
+		for (bucket = 0 ; bucket < PGQUERYSTATS_BUCKETS ; bucket++)
+			line += wxString::Format(wxT(",%ld"), entry.histogram[bucket]);
+		line += wxT("\n");
+
+		ok = file.Write(line, wxConvUTF8);
+	}
+
+	return ok && file.Close();
+}
+
+
+static wxString JsonString(const wxString &str)
+{
+	wxString result = wxT("\"");
+	size_t i;
+
+	for (i = 0 ; i < str.Length() ; i++)
+	{
+		wxChar c = str.GetChar(i);
+		switch (c)
+		{
+			case '"':
+				result += wxT("\\\"");
+				break;
+			case '\\':
+				result += wxT("\\\\");
+				break;
+			case '\n':
+				result += wxT("\\n");
+				break;
+			case '\r':
+				result += wxT("\\r");
+				break;
+			case '\t':
+				result += wxT("\\t");
+				break;
+			default:
+				if (c < 0x20)
+					result += wxString::Format(wxT("\\u%04x"), (int)c);
+				else
+					result += c;
+				break;
+		}
+	}
+
+	return result + wxT("\"");
+}
+
+
+bool pgQueryStats::ExportJSON(const wxString &filename)
+{
+	pgQueryStatsArray stats;
+	GetEntries(stats);
+
+	wxFile file;
+	if (!file.Create(filename, true))
+		return false;
+
+	wxString str = wxT("{\n  \"bucket_limits_ms\": [");
+	int bucket;
+	for (bucket = 0 ; bucket < PGQUERYSTATS_BUCKETS - 1 ; bucket++)
+		str += wxString::Format(bucket ? wxT(", %ld") : wxT("%ld"), bucketLimits[bucket]);
+	str += wxT("],\n  \"queries\": [");
+
+	bool ok = file.Write(str, wxConvUTF8);
+
+	size_t i;
+	for (i = 0 ; ok && i < stats.GetCount() ; i++)
+	{
+		pgQueryStatsEntry &entry = stats.Item(i);
+
+		str = i ? wxT(",\n    {") : wxT("\n    {");
+		str += wxT("\"caller\": ") + JsonString(entry.caller)
+		       + wxT(", \"query\": ") + JsonString(entry.fingerprint)
+		       + wxString::Format(wxT(", \"calls\": %ld, \"ui_calls\": %ld, \"rows\": %ld"), entry.calls, entry.uiCalls, entry.rows)
+		       + wxT(", \"bytes\": ") + entry.bytes.ToString()
+		       + wxT(", \"total_ms\": ") + entry.totalTime.ToString()
+		       + wxString::Format(wxT(", \"max_ms\": %ld, \"histogram\": ["), entry.maxTime);
+
+		for (bucket = 0 ; bucket < PGQUERYSTATS_BUCKETS ; bucket++)
+			str += wxString::Format(bucket ? wxT(", %ld") : wxT("%ld"), entry.histogram[bucket]);
+		str += wxT("]}");
+
+		ok = file.Write(str, wxConvUTF8);
+	}
+
+	return ok && file.Write(wxT("\n  ]\n}\n"), wxConvUTF8) && file.Close();
+}
+
+
+pgQueryStatsCaller::pgQueryStatsCaller(const wxString &caller)
+{
+	// Callers are only tracked for the UI thread
+	active = wxThread::IsMain();
+	if (active)
+	{
+		previous = pgQueryStats::currentCaller;
+		pgQueryStats::currentCaller = caller;
+	}
+}
+
+
+pgQueryStatsCaller::~pgQueryStatsCaller()
+{
+	if (active)
+		pgQueryStats::currentCaller = previous;
+}
@@ -17,15 +17,43 @@
 // PostgreSQL headers
 #include <libpq-fe.h>
 
+// Network headers
+#ifdef __WXMSW__
+#include <winsock.h>
+#else
+#include <sys/select.h>
+#include <sys/time.h>
+#endif
+
 // App headers
 #include "db/pgSet.h"
 #include "db/pgConn.h"
 #include "db/pgQueryThread.h"
 #include "db/pgQueryResultEvent.h"
+#include "db/pgQueryStats.h"
 #include "utils/pgDefs.h"
+#include "utils/sqlLexer.h"
 #include "utils/sysLogger.h"
 
+#include <wx/arrimpl.cpp>
+WX_DEFINE_OBJARRAY(pgStatementTimingArray);
+
 const wxEventType PGQueryResultEvent = wxNewEventType();
+const wxEventType PGQueryRowsEvent = wxNewEventType();
+
+// Longest time (in milliseconds) the thread blocks on the server socket
+// before checking again whether the execution has been cancelled
+#define PGQUERYTHREAD_CANCEL_CHECK_INTERVAL 100
+
+// Minimum time (in milliseconds) between two partial batches of streamed
+// rows, which are handed over before waiting for more data
+#define PGQUERYTHREAD_STREAM_INTERVAL 100
+
+// Approximate memory used by libpq for each field of a row, besides the data
+#define PGQUERYTHREAD_STREAM_FIELD_OVERHEAD 16
+
+// Maximum number of queued queries sent in a single pipeline
+#define PGQUERYTHREAD_PIPELINE_MAX 32
 
 // default notice processor for the pgQueryThread
 // we do assume that the argument passed will be always the
@@ -47,8 +75,13 @@ pgQueryThread::pgQueryThread(pgConn *_conn, wxEvtHandler *_caller,
                              PQnoticeProcessor _processor, void *_noticeHandler) :
 	wxThread(wxTHREAD_JOINABLE), m_currIndex(-1), m_conn(_conn),
 	m_cancelled(false), m_multiQueries(true), m_useCallable(false),
+	m_pipelining(false),
+	m_queueCondition(m_queueLock),
 	m_caller(_caller), m_processor(pgNoticeProcessor), m_noticeHandler(NULL),
-	m_eventOnCancellation(true)
+	m_eventOnCancellation(true),
+	m_streamBatchRows(0), m_streamMemoryLimit(0), m_streamBatch(NULL),
+	m_streamSetSeq(-1), m_statement(0), m_genericPlans(0), m_customPlans(0),
+	m_posOffset(0), m_statsRows(0)
 {
 	// check if we can really use the enterprisedb callable statement and
 	// required
@@ -97,8 +130,13 @@ pgQueryThread::pgQueryThread(pgConn *_conn, const wxString &_qry,
                              int _resultToRetrieve, wxWindow *_caller, long _eventId, void *_data)
 	: wxThread(wxTHREAD_JOINABLE), m_currIndex(-1), m_conn(_conn),
 	  m_cancelled(false), m_multiQueries(false), m_useCallable(false),
+	  m_pipelining(false),
+	  m_queueCondition(m_queueLock),
 	  m_caller(NULL), m_processor(pgNoticeProcessor), m_noticeHandler(NULL),
-	  m_eventOnCancellation(true)
+	  m_eventOnCancellation(true),
+	  m_streamBatchRows(0), m_streamMemoryLimit(0), m_streamBatch(NULL),
+	  m_streamSetSeq(-1), m_statement(0), m_genericPlans(0), m_customPlans(0),
+	  m_posOffset(0), m_statsRows(0)
 {
 	if (m_conn && m_conn->conn)
 	{
@@ -122,22 +160,106 @@ void pgQueryThread::SetEventOnCancellation(bool eventOnCancelled)
 	m_eventOnCancellation = eventOnCancelled;
 }
 
+void pgQueryThread::EnablePipelining(bool enable)
+{
+#ifdef LIBPQ_HAS_PIPELINING
+	m_pipelining = enable && m_multiQueries && !m_useCallable &&
+	               m_conn && m_conn->conn && m_conn->BackendMinimumVersion(14, 0);
+#else
+	m_pipelining = false;
+#endif
+}
+
+void pgQueryThread::SetStreaming(long batchRows, wxLongLong memoryLimit)
+{
+	m_streamBatchRows = batchRows;
+	m_streamMemoryLimit = memoryLimit;
+}
+
+void pgQueryThread::SetStatements(const wxArrayString &statements, const wxArrayInt &offsets)
+{
+	wxMutexLocker lock(m_queueLock);
+
+	pgBatchQuery *query = m_queries.Last();
+	query->m_statements = statements;
+	query->m_offsets = offsets;
+}
+
 void pgQueryThread::AddQuery(const wxString &_qry, pgParamsArray *_params,
                              long _eventId, void *_data, bool _useCallable, int _resultToRetrieve)
 {
-	m_queries.Add(
-	    new pgBatchQuery(_qry, _params, _eventId, _data,
-	                     // use callable statement only if supported
-	                     m_useCallable && _useCallable, _resultToRetrieve));
+	{
+		wxMutexLocker lock(m_queueLock);
+
+		m_queries.Add(
+		    new pgBatchQuery(_qry, _params, _eventId, _data,
+		                     // use callable statement only if supported
+		                     m_useCallable && _useCallable, _resultToRetrieve));
+
+		// wake up the thread, if it is waiting for the next query
+		m_queueCondition.Signal();
+	}
 
 	wxLogInfo(wxT("queueing (%ld): %s"), GetId(), _qry.c_str());
 }
 
+#ifdef __WXDEBUG__
+void pgQueryThread::SetTestResult(const wxString &_qry, pgSet *_set)
+{
+	wxASSERT(!IsRunning());
+
+	pgBatchQuery *query = new pgBatchQuery(_qry);
+	query->m_resultSet = _set;
+	query->m_returnCode = PGRES_TUPLES_OK;
+
+	m_queries.Add(query);
+	m_currIndex = m_queries.GetCount() - 1;
+}
+#endif
+
+
+void pgQueryThread::CancelExecution()
+{
+	wxMutexLocker lock(m_queueLock);
+
+	m_cancelled = true;
+	m_queueCondition.Signal();
+}
+
+
+// Block until the server has sent more data on the connection (or, if asked
+// for, until more data can be sent to it), or until the interval to check
+// for the cancellation has passed.
+bool pgQueryThread::WaitForServer(bool write)
+{
+	int sock = PQsocket(m_conn->conn);
+
+	if (sock < 0)
+		return false;
+
+	fd_set input_mask, output_mask;
+	struct timeval timeout;
+
+	FD_ZERO(&input_mask);
+	FD_SET(sock, &input_mask);
+	FD_ZERO(&output_mask);
+	if (write)
+		FD_SET(sock, &output_mask);
+
+	timeout.tv_sec = PGQUERYTHREAD_CANCEL_CHECK_INTERVAL / 1000;
+	timeout.tv_usec = (PGQUERYTHREAD_CANCEL_CHECK_INTERVAL % 1000) * 1000;
+
+	return (select(sock + 1, &input_mask, &output_mask, NULL, &timeout) > 0);
+}
+
 
 pgQueryThread::~pgQueryThread()
 {
 	m_conn->RegisterNoticeProcessor(0, 0);
 	WX_CLEAR_ARRAY(m_queries);
+
+	if (m_streamBatch)
+		PQclear(m_streamBatch);
 }
 
 
@@ -184,16 +306,24 @@ int pgQueryThread::Execute()
 
 	wxString       &query            = m_queries[m_currIndex]->m_query;
 	int            &resultToRetrieve = m_queries[m_currIndex]->m_resToRetrieve;
-	long           &rowsInserted     = m_queries[m_currIndex]->m_rowsInserted;
 	Oid            &insertedOid      = m_queries[m_currIndex]->m_insertedOid;
-	// using the alias for the pointer here, in order to save the result back
-	// in the pgBatchQuery object
-	pgSet         *&dataSet          = m_queries[m_currIndex]->m_resultSet;
 	int            &rc               = m_queries[m_currIndex]->m_returnCode;
 	pgParamsArray  *params           = m_queries[m_currIndex]->m_params;
 	bool            useCallable      = m_queries[m_currIndex]->m_useCallable;
 	pgError        &err              = m_queries[m_currIndex]->m_err;
 
+	// Rows of the last result are streamed only to a caller, which is
+	// interested in that one and not in some other particular result
+	bool            streaming        = m_streamBatchRows > 0 && m_caller &&
+	                                   !useCallable && resultToRetrieve <= 0;
+
+	// Only a query without parameters may be run a statement at a time
+	bool            timed            = !m_queries[m_currIndex]->m_statements.IsEmpty() &&
+	                                   !(params && params->GetCount() > 0);
+
+	m_posOffset = 0;
+	m_queries[m_currIndex]->m_timings.Clear();
+
 	wxCharBuffer queryBuf = query.mb_str(conv);
 
 	if (PQstatus(m_conn->conn) != CONNECTION_OK)
@@ -323,8 +453,9 @@ return_with_error:
 	else
 	{
 		// use the PQsendQuery api in case, we don't have any parameters to
-		// pass to the server
-		if (!PQsendQuery(m_conn->conn, queryBuf))
+		// pass to the server; a query run a statement at a time starts with
+		// its first one
+		if (timed ? !SendStatement(0) : !PQsendQuery(m_conn->conn, queryBuf))
 		{
 			rc = pgQueryResultEvent::PGQ_ERROR_SEND_QUERY;
 
@@ -336,6 +467,23 @@ return_with_error:
 	}
 
 continue_without_error:
+	if (streaming && !PQsetSingleRowMode(m_conn->conn))
+		streaming = false;
+
+	if (streaming)
+	{
+		if (m_streamBatch)
+			PQclear(m_streamBatch);
+		m_streamBatch = NULL;
+		m_streamSeq = 0;
+		m_streamRows = 0;
+		m_streamPrevRows = 0;
+		m_streamBytes = 0;
+		m_streamLimitReached = false;
+		m_streamPosted = false;
+		m_streamLastPost = 0;
+	}
+
 	int resultsRetrieved = 0;
 	PGresult *lastResult = 0;
 	bool connExecutionCancelled = false;
@@ -374,7 +522,10 @@ continue_without_error:
 			}
 		}
 
-		if ((rc = PQconsumeInput(m_conn->conn)) != 1)
+		// While streaming, rows are mostly picked up from what libpq has
+		// buffered already; only go to the socket when it needs more data.
+		if ((!streaming || PQisBusy(m_conn->conn)) &&
+		        (rc = PQconsumeInput(m_conn->conn)) != 1)
 		{
 			if (m_cancelled)
 			{
@@ -416,8 +567,11 @@ continue_without_error:
 
 		if (PQisBusy(m_conn->conn))
 		{
-			Yield();
-			this->Sleep(10);
+			// Show what we have got so far, before waiting for more rows
+			if (streaming)
+				PostStreamedRows(false);
+
+			WaitForServer();
 
 			continue;
 		}
@@ -428,14 +582,70 @@ continue_without_error:
 		PGresult *res = PQgetResult(m_conn->conn);
 
 		if (!res)
-			break;
+		{
+			if (!timed)
+				break;
+
+			// The statement is complete; go on with the next one
+			FinishStatement();
+			if (m_cancelled || m_statement + 1 >= m_queries[m_currIndex]->m_statements.GetCount())
+				break;
+
+			if (!SendStatement(m_statement + 1))
+			{
+				rc = pgQueryResultEvent::PGQ_ERROR_SEND_QUERY;
+
+				err.msg_primary = _("Failed to run PQsendQuery in pgQueryThread.\n") +
+				                  wxString(PQerrorMessage(m_conn->conn), conv);
+
+				if (lastResult)
+					PQclear(lastResult);
+				if (result)
+					PQclear(result);
+
+				return(RaiseEvent(rc));
+			}
+			if (streaming)
+				PQsetSingleRowMode(m_conn->conn);
+
+			continue;
+		}
+
+		if (streaming)
+		{
+			switch (PQresultStatus(res))
+			{
+				case PGRES_SINGLE_TUPLE:
+					if (!m_cancelled)
+						StreamRow(res);
+					PQclear(res);
+					continue;
+
+				case PGRES_TUPLES_OK:
+					// The (row-less) end of a streamed result set
+					if (!m_cancelled)
+						FinishStreamedSet(res);
+					break;
+
+				default:
+					DiscardStreamedRows();
+					break;
+			}
+		}
 
 		if((PQresultStatus(res) == PGRES_NONFATAL_ERROR) ||
 		        (PQresultStatus(res) == PGRES_FATAL_ERROR) ||
 		        (PQresultStatus(res) == PGRES_BAD_RESPONSE))
 		{
 			result = res;
-			err.SetError(res, &conv);
+			err.SetError(res, &conv, m_posOffset);
+
+			// The statements after the one which failed are not run
+			if (timed)
+			{
+				StatementResult(res);
+				FinishStatement();
+			}
 
 			// Wait for the execution to be finished
 			// We need to fetch all the results, before sending the error
@@ -473,10 +683,7 @@ continue_without_error:
 				res = NULL;
 
 				if (PQisBusy(m_conn->conn))
-				{
-					Yield();
-					this->Sleep(10);
-				}
+					WaitForServer();
 			}
 			while (true);
 
@@ -503,7 +710,6 @@ continue_without_error:
 			int copyRc;
 			char *buf;
 			int copyRows = 0;
-			int lastCopyRc = 0;
 
 			rc = PGRES_COPY_OUT;
 
@@ -540,13 +746,10 @@ continue_without_error:
 				if (copyRc > 0)
 					copyRows++;
 
-				if (lastCopyRc == 0 && copyRc == 0)
-				{
-					Yield();
-					this->Sleep(10);
-				}
 				if (copyRc == 0)
 				{
+					WaitForServer();
+
 					if (!PQconsumeInput(m_conn->conn))
 					{
 						// It might be the case - it is a result of the
@@ -581,7 +784,6 @@ continue_without_error:
 						return(RaiseEvent(rc));
 					}
 				}
-				lastCopyRc = copyRc;
 			}
 
 			res = PQgetResult(m_conn->conn);
@@ -592,6 +794,13 @@ continue_without_error:
 
 		resultsRetrieved++;
 
+		if (timed)
+			StatementResult(res);
+
+		// DDL run from the query tool may change the types we have cached,
+		// DISCARD ALL drops the prepared statements
+		m_conn->CheckCacheInvalidation(res);
+
 		// Save the current result, as asked by the component
 		// But - only if the execution is not cancelled
 		if (!m_cancelled && resultsRetrieved == resultToRetrieve)
@@ -637,12 +846,201 @@ out_of_consume_input_loop:
 	if (!result)
 		result = lastResult;
 
-	err.SetError(result, &conv);
+	return StoreResult(result, streaming);
+}
+
+
+// The name of the prepared statement an EXECUTE runs, as the server keeps it
+static bool GetExecutedName(const wxString &statement, wxString &name)
+{
+	wxCharBuffer buf = statement.mb_str(wxConvUTF8);
+	const char *data = buf;
+	if (!data)
+		return false;
+
+	sqlLexer lexer;
+	bool end;
+	size_t len = strlen(data);
+	lexer.Scan(data, len, end);
+	lexer.Finish();
+	if (lexer.GetFirstWord() != wxT("execute") || lexer.GetContentStart() < 0)
+		return false;
+
+	const char *p = data + lexer.GetContentStart() + 7;
+	while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')
+		p++;
+
+	wxString str;
+	if (*p == '"')
+	{
+		// Quoted, with doubled quotes inside
+		const char *from = ++p;
+		while (*p && (*p != '"' || p[1] == '"'))
+			p += (*p == '"') ? 2 : 1;
+		str = wxString(from, wxConvUTF8, p - from);
+		str.Replace(wxT("\"\""), wxT("\""));
+	}
+	else
+	{
+		const char *from = p;
+		while ((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z') || (*p >= '0' && *p <= '9') ||
+		        *p == '_' || *p == '$' || (unsigned char)*p >= 0x80)
+			p++;
+		str = wxString(from, wxConvUTF8, p - from).Lower();
+	}
+
+	if (str.IsEmpty())
+		return false;
+
+	name = str;
+	return true;
+}
+
+
+// Send a statement of a query run a statement at a time
+bool pgQueryThread::SendStatement(size_t index)
+{
+	pgBatchQuery *query = m_queries[m_currIndex];
+
+	pgStatementTiming timing;
+	timing.statement = query->m_statements[index];
+	if (index < query->m_offsets.GetCount())
+		timing.offset = query->m_offsets[index];
+
+	// Which plan an EXECUTE used shows in the counts of the plans made for
+	// the prepared statement, which the server keeps from 14 on
+	m_preparedName = wxEmptyString;
+	if (GetExecutedName(timing.statement, m_preparedName))
+	{
+		timing.plan = PGPLAN_PREPARED;
+		if (!m_conn->BackendMinimumVersion(14, 0) ||
+		        !GetPlanCounts(m_preparedName, m_genericPlans, m_customPlans))
+			m_preparedName = wxEmptyString;
+	}
+
+	query->m_timings.Add(timing);
+	m_statement = index;
+	m_posOffset = timing.offset;
+
+	wxCharBuffer buf = timing.statement.mb_str(*(m_conn->conv));
+	if (!buf)
+		return false;
+
+	m_statementWatch.Start();
+	return PQsendQuery(m_conn->conn, buf) != 0;
+}
+
+
+// Note what a result of the statement being run says about it
+void pgQueryThread::StatementResult(PGresult *res)
+{
+	pgStatementTiming &timing = m_queries[m_currIndex]->m_timings.Last();
+	ExecStatusType status = PQresultStatus(res);
+
+	if (status == PGRES_FATAL_ERROR || status == PGRES_NONFATAL_ERROR ||
+	        status == PGRES_BAD_RESPONSE)
+	{
+		timing.failed = true;
+		return;
+	}
+
+	timing.command = wxString(PQcmdStatus(res), *(m_conn->conv));
+
+	const char *rows = PQcmdTuples(res);
+	if (*rows)
+		timing.rows = atol(rows);
+	else if (status == PGRES_TUPLES_OK)
+		timing.rows = PQntuples(res);
+}
+
+
+// The statement being run is complete (or has failed)
+void pgQueryThread::FinishStatement()
+{
+	pgStatementTiming &timing = m_queries[m_currIndex]->m_timings.Last();
+
+#if wxCHECK_VERSION(2, 9, 3)
+	timing.elapsed = m_statementWatch.TimeInMicro().ToDouble() / 1000.0;
+#else
+	timing.elapsed = m_statementWatch.Time();
+#endif
+
+	long generic, custom;
+	if (!m_preparedName.IsEmpty() && !timing.failed && !m_cancelled &&
+	        GetPlanCounts(m_preparedName, generic, custom))
+	{
+		if (generic > m_genericPlans)
+			timing.plan = PGPLAN_GENERIC;
+		else if (custom > m_customPlans)
+			timing.plan = PGPLAN_CUSTOM;
+	}
+	m_preparedName = wxEmptyString;
+}
+
+
+// The number of times a generic and a custom plan was used for a prepared
+// statement. Only asked for between two statements, once all the results of
+// the one before (and its streamed rows) have been received; the thread
+// owns the connection meanwhile (see pgConn::LockExecution()), so the main
+// thread handling those rows doesn't query through it.
+bool pgQueryThread::GetPlanCounts(const wxString &name, long &generic, long &custom)
+{
+	if (PQtransactionStatus(m_conn->conn) == PQTRANS_ACTIVE || PQisBusy(m_conn->conn))
+		return false;
+
+	wxCharBuffer nameBuf = name.mb_str(*(m_conn->conv));
+	if (!nameBuf)
+		return false;
+
+	const char *values[1] = { nameBuf };
+	PGresult *res = PQexecParams(m_conn->conn,
+	                             "SELECT generic_plans, custom_plans FROM pg_catalog.pg_prepared_statements WHERE name = $1",
+	                             1, NULL, values, NULL, NULL, 0);
+
+	bool found = PQresultStatus(res) == PGRES_TUPLES_OK && PQntuples(res) == 1;
+	if (found)
+	{
+		generic = atol(PQgetvalue(res, 0, 0));
+		custom = atol(PQgetvalue(res, 0, 1));
+	}
+	PQclear(res);
+
+	return found;
+}
+
+
+// Save the (last) result of the current query in its pgBatchQuery, and let
+// the caller know about it.
+int pgQueryThread::StoreResult(PGresult *result, bool streamed)
+{
+	wxMBConv       &conv             = *(m_conn->conv);
+	long           &rowsInserted     = m_queries[m_currIndex]->m_rowsInserted;
+	Oid            &insertedOid      = m_queries[m_currIndex]->m_insertedOid;
+	// using the alias for the pointer here, in order to save the result back
+	// in the pgBatchQuery object
+	pgSet         *&dataSet          = m_queries[m_currIndex]->m_resultSet;
+	int            &rc               = m_queries[m_currIndex]->m_returnCode;
+	pgError        &err              = m_queries[m_currIndex]->m_err;
+
+	if (result && pgQueryStats::Get()->IsEnabled())
+	{
+		m_statsRows += PQntuples(result);
+		m_statsBytes += pgQueryStats::ResultBytes(result);
+	}
+
+	err.SetError(result, &conv, m_posOffset);
 
 	AppendMessage(wxT("\n"));
 
 	rc = PQresultStatus(result);
-	if (rc == PGRES_TUPLES_OK)
+	if (rc == PGRES_TUPLES_OK && streamed)
+	{
+		// The rows have been handed over to the caller already, who keeps
+		// them in the result set of this query
+		PQclear(result);
+		result = NULL;
+	}
+	else if (rc == PGRES_TUPLES_OK)
 	{
 		dataSet = new pgSet(result, m_conn, conv, m_conn->needColQuoting);
 		dataSet->MoveFirst();
@@ -683,6 +1081,12 @@ int pgQueryThread::RaiseEvent(int _retval)
 #if !defined(PGSCLI)
 	if (m_caller)
 	{
+#if wxCHECK_VERSION(2, 9, 3)
+		m_queries[m_currIndex]->m_elapsed = m_queryWatch.TimeInMicro().ToDouble() / 1000.0;
+#else
+		m_queries[m_currIndex]->m_elapsed = m_queryWatch.Time();
+#endif
+
 		pgQueryResultEvent resultEvent(GetId(), m_queries[m_currIndex], m_queries[m_currIndex]->m_eventID);
 
 		// client data
@@ -696,41 +1100,477 @@ int pgQueryThread::RaiseEvent(int _retval)
 }
 
 
+// Add a row received in single row mode to the current batch of rows, and
+// hand the batch over once it is full.
+void pgQueryThread::StreamRow(PGresult *res)
+{
+	m_statsRows++;
+	if (pgQueryStats::Get()->IsEnabled())
+		m_statsBytes += pgQueryStats::ResultBytes(res);
+
+	// Rows beyond the memory limit are received, but thrown away
+	if (m_streamLimitReached)
+		return;
+
+	if (!m_streamRows && m_streamPrevRows)
+	{
+		AppendMessage(wxString::Format(wxPLURAL("query result with %ld row discarded.\n", "query result with %ld rows discarded.\n",
+		                                        m_streamPrevRows), m_streamPrevRows));
+		m_streamPrevRows = 0;
+	}
+
+	if (!m_streamBatch)
+		m_streamBatch = PQcopyResult(res, PG_COPYRES_ATTRS);
+
+	int row = PQntuples(m_streamBatch),
+	    nCols = PQnfields(res);
+
+	for (int col = 0; col < nCols; col++)
+	{
+		if (PQgetisnull(res, 0, col))
+			PQsetvalue(m_streamBatch, row, col, NULL, -1);
+		else
+		{
+			int len = PQgetlength(res, 0, col);
+			PQsetvalue(m_streamBatch, row, col, PQgetvalue(res, 0, col), len);
+			m_streamBytes += len;
+		}
+	}
+	m_streamBytes += nCols * PGQUERYTHREAD_STREAM_FIELD_OVERHEAD;
+	m_streamRows++;
+
+	if (m_streamMemoryLimit > 0 && m_streamBytes >= m_streamMemoryLimit)
+	{
+		m_streamLimitReached = true;
+		AppendMessage(wxString::Format(
+		                  _("The query result has been truncated after %ld rows, as it reached the memory limit for query results. The remaining rows are discarded.\n"),
+		                  m_streamRows));
+	}
+
+	if (PQntuples(m_streamBatch) >= m_streamBatchRows || m_streamLimitReached)
+		PostStreamedRows(true);
+}
+
+
+// Hand over the rows collected so far. Unless forced, a partial batch is
+// handed over only if nothing was shown yet, or some time has passed since.
+void pgQueryThread::PostStreamedRows(bool force)
+{
+	if (!m_streamBatch)
+		return;
+
+	wxLongLong now = wxGetLocalTimeMillis();
+
+	if (!force && m_streamPosted && now - m_streamLastPost < PGQUERYTHREAD_STREAM_INTERVAL)
+		return;
+
+	PGresult *rows = m_streamBatch;
+	m_streamBatch = NULL;
+	m_streamPosted = true;
+	m_streamLastPost = now;
+
+	RaiseRowsEvent(rows);
+}
+
+
+void pgQueryThread::FinishStreamedSet(PGresult *res)
+{
+	if (m_streamRows)
+		PostStreamedRows(true);
+	else
+	{
+		if (m_streamPrevRows)
+			AppendMessage(wxString::Format(wxPLURAL("query result with %ld row discarded.\n", "query result with %ld rows discarded.\n",
+			                                        m_streamPrevRows), m_streamPrevRows));
+
+		// An empty result set still needs its columns to be shown
+		RaiseRowsEvent(PQcopyResult(res, PG_COPYRES_ATTRS));
+	}
+
+	m_streamSeq++;
+	m_streamPrevRows = m_streamRows;
+	m_streamRows = 0;
+	m_streamBytes = 0;
+	m_streamLimitReached = false;
+	m_streamPosted = false;
+}
+
+
+// A result without rows follows the streamed ones, so the caller must not
+// show those any more.
+void pgQueryThread::DiscardStreamedRows()
+{
+	if (m_streamBatch)
+	{
+		PQclear(m_streamBatch);
+		m_streamBatch = NULL;
+	}
+
+	if (m_streamPrevRows || m_streamRows)
+	{
+		if (!m_cancelled)
+			AppendMessage(wxString::Format(wxPLURAL("query result with %ld row discarded.\n", "query result with %ld rows discarded.\n",
+			                                        m_streamPrevRows + m_streamRows), m_streamPrevRows + m_streamRows));
+		RaiseRowsEvent(NULL);
+	}
+
+	m_streamSeq++;
+	m_streamPrevRows = 0;
+	m_streamRows = 0;
+	m_streamBytes = 0;
+	m_streamLimitReached = false;
+	m_streamPosted = false;
+}
+
+
+void pgQueryThread::RaiseRowsEvent(PGresult *rows)
+{
+#if !defined(PGSCLI)
+	if (m_caller)
+	{
+		pgQueryResultEvent rowsEvent(GetId(), m_queries[m_currIndex], m_queries[m_currIndex]->m_eventID,
+		                             PGQueryRowsEvent);
+
+		rowsEvent.SetClientData(rows);
+		rowsEvent.SetInt(m_streamSeq);
+
+		m_caller->AddPendingEvent(rowsEvent);
+		return;
+	}
+#endif
+	if (rows)
+		PQclear(rows);
+}
+
+
+// Build the result set from the streamed rows. This runs in the thread of
+// the receiver of the rows events, which is the only one touching the result
+// set of a streamed query until the query is complete.
+pgSet *pgQueryThread::AppendStreamedRows(pgQueryResultEvent &ev, bool &newSet)
+{
+	PGresult *rows = (PGresult *)ev.GetClientData();
+
+	newSet = false;
+
+	// Ignore the rows of a query, which has been replaced in the meantime
+	if (ev.GetThreadID() != GetId() || m_currIndex < 0 || ev.GetQuery() != m_queries[m_currIndex])
+	{
+		if (rows)
+			PQclear(rows);
+		return NULL;
+	}
+
+	pgSet *&dataSet = m_queries[m_currIndex]->m_resultSet;
+
+	if (rows && dataSet && ev.GetInt() == m_streamSetSeq)
+	{
+		dataSet->AppendChunk(rows);
+		return dataSet;
+	}
+
+	if (dataSet)
+	{
+		delete dataSet;
+		dataSet = NULL;
+	}
+	newSet = true;
+
+	if (rows)
+	{
+		dataSet = new pgSet(rows, m_conn, *(m_conn->conv), m_conn->needColQuoting);
+		m_streamSetSeq = ev.GetInt();
+	}
+
+	return dataSet;
+}
+
+
+#ifdef LIBPQ_HAS_PIPELINING
+// Send a query with the extended query protocol, which is the only one
+// allowed in pipeline mode. Results are expected in the text format.
+static int SendQueryParams(PGconn *conn, const char *query, pgParamsArray *params)
+{
+	int pCount = params ? (int)params->GetCount() : 0;
+
+	if (!pCount)
+		return PQsendQueryParams(conn, query, 0, NULL, NULL, NULL, NULL, 0);
+
+	Oid         *pOids    = (Oid *)malloc(pCount * sizeof(Oid));
+	const char **pParams  = (const char **)malloc(pCount * sizeof(const char *));
+	int         *pLens    = (int *)malloc(pCount * sizeof(int));
+	int         *pFormats = (int *)malloc(pCount * sizeof(int));
+
+	for (int idx = 0; idx < pCount; idx++)
+	{
+		pgParam *param = (*params)[idx];
+
+		pOids[idx] = param->m_type;
+		pParams[idx] = (const char *)param->m_val;
+		pLens[idx] = param->m_len;
+		pFormats[idx] = param->GetFormat();
+	}
+
+	int ret = PQsendQueryParams(conn, query, pCount, pOids, pParams, pLens, pFormats, 0);
+
+	free(pOids);
+	free(pParams);
+	free(pLens);
+	free(pFormats);
+
+	return ret;
+}
+#endif
+
+
+// Send the pending output and read the input of the pipeline, until the next
+// result can be fetched without blocking. Returns false, if the connection
+// failed.
+bool pgQueryThread::WaitForPipeline(bool &cancelSent)
+{
+	while (true)
+	{
+		if (m_cancelled && !cancelSent)
+		{
+			m_conn->CancelExecution();
+			cancelSent = true;
+		}
+
+		int flushRc = PQflush(m_conn->conn);
+
+		if (flushRc < 0 || PQconsumeInput(m_conn->conn) != 1)
+			return false;
+
+		if (!PQisBusy(m_conn->conn))
+			return true;
+
+		WaitForServer(flushRc == 1);
+	}
+}
+
+
+// Execute the queued queries (at least two of them) in pipeline mode: all of
+// them are sent before any result is read, so they take a single round trip
+// together. Each query is followed by a sync point, hence it runs in its own
+// transaction and an error does not affect the following queries, just like
+// running them one by one. The results are stored and reported in order.
+//
+// Returns false (having done nothing) when the queries have to be executed
+// one by one instead.
+bool pgQueryThread::ExecutePipeline()
+{
+#ifdef LIBPQ_HAS_PIPELINING
+	if (!m_pipelining)
+		return false;
+
+	pgBatchQueryArray queries;
+	int first = m_currIndex + 1;
+
+	{
+		wxMutexLocker lock(m_queueLock);
+
+		for (int idx = first; idx < (int)m_queries.GetCount() &&
+		        queries.GetCount() < PGQUERYTHREAD_PIPELINE_MAX; idx++)
+		{
+			// Callable statements can't be part of a pipeline, nor can
+			// queries run a statement at a time
+			if (m_queries[idx]->m_useCallable || !m_queries[idx]->m_statements.IsEmpty())
+				break;
+			queries.Add(m_queries[idx]);
+		}
+	}
+
+	if (queries.GetCount() < 2)
+		return false;
+
+	wxMutexLocker lock(m_queriesLock);
+
+	PGconn   *conn = m_conn->conn;
+	wxMBConv &conv = *(m_conn->conv);
+
+	m_posOffset = 0;
+
+	if (PQstatus(conn) != CONNECTION_OK || !PQenterPipelineMode(conn))
+		return false;
+
+	// Send the queries, up to the first one which can't be sent; that one
+	// (and the rest) will be run on its own, to report the error properly.
+	// The first one is timed from now on.
+	int sent = 0;
+	m_queryWatch.Start();
+
+	for (; sent < (int)queries.GetCount(); sent++)
+	{
+		pgBatchQuery *qry = queries[sent];
+		wxCharBuffer queryBuf = qry->m_query.mb_str(conv);
+
+		if (!queryBuf || qry->m_query.IsEmpty())
+			break;
+
+		if (SendQueryParams(conn, queryBuf, qry->m_params) != 1 || !PQpipelineSync(conn))
+			break;
+
+		qry->m_returnCode = -2;
+		qry->m_rowsInserted = -1l;
+
+		wxLogSql(wxT("Thread executing query in pipeline (%d:%s:%d): %s"),
+		         first + sent + 1, m_conn->GetHost().c_str(), m_conn->GetPort(),
+		         qry->m_query.c_str());
+	}
+
+	if (!sent)
+	{
+		PQexitPipelineMode(conn);
+		return false;
+	}
+
+	bool cancelSent = false,
+	     connOk = true;
+
+	for (int idx = 0; idx < sent; idx++)
+	{
+		// Each following query is timed from the result of the previous
+		// one, both in its result event and in the statistics
+		if (idx)
+			m_queryWatch.Start();
+
+		m_currIndex = first + idx;
+		m_statsRows = 0;
+		m_statsBytes = 0;
+		// The cancel request reaches only the query running at that time,
+		// the following ones may need to be cancelled again
+		cancelSent = false;
+
+		pgBatchQuery *qry = queries[idx];
+		PGresult *result = NULL,
+		          *res;
+
+		// A single statement gives a single result, followed by NULL, and
+		// then the result of the sync point
+		while (connOk && (connOk = WaitForPipeline(cancelSent)) &&
+		        (res = PQgetResult(conn)) != NULL)
+		{
+			m_conn->CheckCacheInvalidation(res);
+
+			if (result)
+				PQclear(result);
+			result = res;
+		}
+
+		if (connOk && (connOk = WaitForPipeline(cancelSent)) &&
+		        (res = PQgetResult(conn)) != NULL)
+		{
+			wxASSERT(PQresultStatus(res) == PGRES_PIPELINE_SYNC);
+			PQclear(res);
+		}
+
+		if (!connOk)
+		{
+			if (result)
+				PQclear(result);
+
+			if (PQstatus(conn) == CONNECTION_BAD)
+			{
+				qry->m_err.msg_primary = _("Connection to the database server lost");
+				qry->m_returnCode = pgQueryResultEvent::PGQ_CONN_LOST;
+			}
+			else
+			{
+				qry->m_err.msg_primary = wxString(PQerrorMessage(conn), conv);
+				qry->m_returnCode = pgQueryResultEvent::PGQ_ERROR_CONSUME_INPUT;
+			}
+			RaiseEvent(qry->m_returnCode);
+			continue;
+		}
+
+		if (m_cancelled)
+		{
+			if (result)
+				PQclear(result);
+
+			qry->m_returnCode = pgQueryResultEvent::PGQ_EXECUTION_CANCELLED;
+			qry->m_err.msg_primary = _("Execution Cancelled");
+
+			if (m_eventOnCancellation)
+				RaiseEvent(qry->m_returnCode);
+			continue;
+		}
+
+		StoreResult(result, false);
+
+		pgQueryStats::Get()->Record(qry->m_query, wxT("pgQueryThread pipeline"),
+		                            m_queryWatch.Time(), m_statsRows, m_statsBytes);
+	}
+
+	if (connOk)
+		PQexitPipelineMode(conn);
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+
 void *pgQueryThread::Entry()
 {
 	do
 	{
 		if (m_currIndex < (((int)m_queries.GetCount()) - 1))
 		{
+			// The connection is ours until the query is done; the main
+			// thread looks up the types of the rows streamed meanwhile
+			// afterwards
+			m_conn->LockExecution();
+
 			// Create the PGcancel object to enable cancelling the running
 			// query
 			m_conn->SetConnCancel();
-			m_currIndex++;
-
-			m_queries[m_currIndex]->m_returnCode = -2;
-			m_queries[m_currIndex]->m_rowsInserted = -1l;
-
-			wxLogSql(wxT("Thread executing query (%d:%s:%d): %s"),
-			         m_currIndex + 1, m_conn->GetHost().c_str(), m_conn->GetPort(),
-			         m_queries[m_currIndex]->m_query.c_str());
 
 			// register the notice processor for the current query
 			m_conn->RegisterNoticeProcessor(m_processor, m_noticeHandler);
 
+			// send all the queued queries at once, if possible, or else
 			// execute the current query now
-			Execute();
+			if (!ExecutePipeline())
+			{
+				m_currIndex++;
+
+				m_queries[m_currIndex]->m_returnCode = -2;
+				m_queries[m_currIndex]->m_rowsInserted = -1l;
+
+				wxLogSql(wxT("Thread executing query (%d:%s:%d): %s"),
+				         m_currIndex + 1, m_conn->GetHost().c_str(), m_conn->GetPort(),
+				         m_queries[m_currIndex]->m_query.c_str());
+
+				m_queryWatch.Start();
+				m_statsRows = 0;
+				m_statsBytes = 0;
+
+				Execute();
+
+				// The receiver may be deleting executed queries meanwhile
+				wxMutexLocker lock(m_queriesLock);
+				pgQueryStats::Get()->Record(m_queries[m_currIndex]->m_query, wxT("pgQueryThread"),
+				                            m_queryWatch.Time(), m_statsRows, m_statsBytes);
+			}
 
 			// remove the notice processor now
 			m_conn->RegisterNoticeProcessor(0, 0);
 
 			// reset the PGcancel object
 			m_conn->ResetConnCancel();
+
+			m_conn->UnlockExecution();
 		}
 
 		if (!m_multiQueries || m_cancelled)
 			break;
 
-		wxThread::Sleep(10);
+		// Sleep until the next query is queued, or the execution is cancelled
+		wxMutexLocker lock(m_queueLock);
+
+		while (!m_cancelled && m_currIndex >= (((int)m_queries.GetCount()) - 1))
+			m_queueCondition.Wait();
 	}
 	while (true);
 
@@ -763,6 +1603,26 @@ int pgQueryThread::DeleteReleasedQueries()
 }
 
 
+int pgQueryThread::DeleteExecutedQueries()
+{
+	wxMutexLocker queueLock(m_queueLock);
+	wxMutexLocker lock(m_queriesLock);
+
+	// The current query stays, as the thread may still be using it
+	int count = m_currIndex;
+	if (count <= 0)
+		return 0;
+
+	for (int idx = 0; idx < count; idx++)
+		delete m_queries[idx];
+
+	m_queries.RemoveAt(0, count);
+	m_currIndex -= count;
+
+	return count;
+}
+
+
 pgError pgQueryThread::GetResultError(int idx)
 {
 	wxMutexLocker lock(m_queriesLock);
@@ -824,8 +1684,8 @@ bool pgBatchQuery::Release()
 }
 
 pgQueryResultEvent::pgQueryResultEvent(
-    unsigned long _thrdId, pgBatchQuery *_qry, int _id) :
-	wxCommandEvent(PGQueryResultEvent, _id), m_thrdId(_thrdId),
+    unsigned long _thrdId, pgBatchQuery *_qry, int _id, wxEventType _type) :
+	wxCommandEvent(_type, _id), m_thrdId(_thrdId),
 	m_query(_qry) { }
 
 pgQueryResultEvent::pgQueryResultEvent(const pgQueryResultEvent &_ev)
@@ -13,6 +13,7 @@
 
 // wxWindows headers
 #include <wx/wx.h>
+#include <wx/math.h>
 
 // PostgreSQL headers
 #include <libpq-fe.h>
@@ -31,15 +32,24 @@ pgSet::pgSet()
 	nCols = 0;
 	nRows = 0;
 	pos = 0;
+	needColQuoting = false;
+	binary = false;
+	colTypesResolved = true;
+	firstChunkRows = 0;
+	lastChunk = 0;
 }
 
 pgSet::pgSet(PGresult *newRes, pgConn *newConn, wxMBConv &cnv, bool needColQt)
 	: conv(cnv)
 {
 	needColQuoting = needColQt;
+	colTypesResolved = false;
+	firstChunkRows = 0;
+	lastChunk = 0;
 
 	conn = newConn;
 	res = newRes;
+	binary = false;
 
 	// Make sure we have tuples
 	if (PQresultStatus(res) != PGRES_TUPLES_OK)
@@ -51,6 +61,7 @@ pgSet::pgSet(PGresult *newRes, pgConn *newConn, wxMBConv &cnv, bool needColQt)
 	else
 	{
 		nCols = PQnfields(res);
+		binary = nCols > 0 && PQbinaryTuples(res);
 		for (int x = 0; x < nCols + 1; x++)
 		{
 			colTypes.Add(wxT(""));
@@ -59,7 +70,10 @@ pgSet::pgSet(PGresult *newRes, pgConn *newConn, wxMBConv &cnv, bool needColQt)
 		}
 
 		nRows = PQntuples(res);
+		firstChunkRows = nRows;
 		MoveFirst();
+
+		BuildColNumbers();
 	}
 }
 
@@ -67,6 +81,131 @@ pgSet::pgSet(PGresult *newRes, pgConn *newConn, wxMBConv &cnv, bool needColQt)
 pgSet::~pgSet()
 {
 	PQclear(res);
+
+	pgSetTextHash::iterator it;
+	for (it = binaryTexts.begin(); it != binaryTexts.end(); ++it)
+		free(it->second);
+
+	for (size_t i = 0; i < chunks.GetCount(); i++)
+		PQclear((PGresult *)chunks[i]);
+}
+
+
+void pgSet::AppendChunk(PGresult *chunk)
+{
+	wxASSERT(PQnfields(chunk) == nCols);
+
+	long chunkRows = PQntuples(chunk);
+	if (!chunkRows)
+	{
+		PQclear(chunk);
+		return;
+	}
+
+	bool wasEof = Eof();
+
+	chunks.Add(chunk);
+	chunkStarts.Add(nRows);
+	nRows += chunkRows;
+
+	// Keep a cursor, which was already past the end, there
+	if (wasEof && pos > 0)
+		pos = nRows + 1;
+	else if (pos == 0)
+		MoveFirst();
+}
+
+
+// Find the chunk holding the given row. Rows are mostly read in sequence,
+// so try the chunk used last time before doing a binary search.
+PGresult *pgSet::ChunkForRow(long row, int &chunkRow) const
+{
+	size_t count = chunks.GetCount();
+
+	if (lastChunk >= count || row < chunkStarts[lastChunk] ||
+	        (lastChunk + 1 < count && row >= chunkStarts[lastChunk + 1]))
+		lastChunk = FindChunk(row);
+
+	chunkRow = row - chunkStarts[lastChunk];
+	return (PGresult *)chunks[lastChunk];
+}
+
+
+size_t pgSet::FindChunk(long row) const
+{
+	size_t lo = 0, hi = chunks.GetCount() - 1;
+	while (lo < hi)
+	{
+		size_t mid = (lo + hi + 1) / 2;
+		if (chunkStarts[mid] <= row)
+			lo = mid;
+		else
+			hi = mid - 1;
+	}
+	return lo;
+}
+
+
+// Unlike the accessors working on the current row, this doesn't change any
+// state of the set, so other threads can read the set with it as long as
+// no rows are appended meanwhile.
+char *pgSet::GetValueAt(long row, const int col) const
+{
+	wxASSERT(!binary);
+	wxASSERT(row >= 0 && row < nRows);
+
+	if (row < firstChunkRows || chunks.IsEmpty())
+		return PQgetvalue(res, row, col);
+
+	size_t chunk = FindChunk(row);
+	return PQgetvalue((PGresult *)chunks[chunk], row - chunkStarts[chunk], col);
+}
+
+
+PGresult *pgSet::GetResult(size_t n, long &firstRow) const
+{
+	wxASSERT(!binary);
+
+	if (!n)
+	{
+		firstRow = 0;
+		return res;
+	}
+
+	firstRow = chunkStarts[n - 1];
+	return (PGresult *)chunks[n - 1];
+}
+
+
+bool pgSet::IsNullAt(long row, const int col) const
+{
+	wxASSERT(row >= 0 && row < nRows);
+
+	if (row < firstChunkRows || chunks.IsEmpty())
+		return PQgetisnull(res, row, col) != 0;
+
+	size_t chunk = FindChunk(row);
+	return PQgetisnull((PGresult *)chunks[chunk], row - chunkStarts[chunk], col) != 0;
+}
+
+
+int pgSet::GetLengthAt(long row, const int col) const
+{
+	wxASSERT(row >= 0 && row < nRows);
+
+	if (row < firstChunkRows || chunks.IsEmpty())
+		return PQgetlength(res, row, col);
+
+	size_t chunk = FindChunk(row);
+	return PQgetlength((PGresult *)chunks[chunk], row - chunkStarts[chunk], col);
+}
+
+
+char *pgSet::ValuePtr(const int col) const
+{
+	int row;
+	PGresult *r = RowResult(pos - 1, row);
+	return PQgetvalue(r, row, col);
 }
 
 
@@ -96,27 +235,43 @@ long pgSet::GetInsertedCount() const
 }
 
 
-pgTypClass pgSet::ColTypClass(const int col) const
+// Fetch the type information of all columns at once from the connection's
+// type cache, which resolves any unknown types in a single catalog query.
+void pgSet::ResolveColTypes() const
 {
-	wxASSERT(col < nCols && col >= 0);
+	if (colTypesResolved)
+		return;
+	colTypesResolved = true;
 
-	if (colClasses[col] != 0)
-		return (pgTypClass)colClasses[col];
+	if (!conn)
+		return;
 
-	wxString typoid = ExecuteScalar(
-	                      wxT("SELECT CASE WHEN typbasetype=0 THEN oid else typbasetype END AS basetype\n")
-	                      wxT("  FROM pg_type WHERE oid=") + NumToStr(ColTypeOid(col)));
+	if (!conn->LoadTypeInfo(this))
+	{
+		// The connection is busy, so try again later
+		colTypesResolved = false;
+		return;
+	}
 
-	switch (StrToLong(typoid))
+	for (int col = 0; col < nCols; col++)
+	{
+		pgTypeInfo info;
+		if (conn->LookupTypeInfo(ColTypeOid(col), ColTypeMod(col), info))
+		{
+			colTypes[col] = info.typeName;
+			colFullTypes[col] = info.fullTypeName;
+			colClasses[col] = TypClassFromOid(info.baseType);
+		}
+	}
+}
+
+
+pgTypClass pgSet::TypClassFromOid(OID typoid)
+{
+	switch (typoid)
 	{
 		case PGOID_TYPE_BOOL:
-//ABDUL: 30 Aug 2021:BEGIN
-#if wxCHECK_VERSION(3, 1, 0)
-			((pgSet*)this)->colClasses[col] = PGTYPCLASS_BOOL;
-#else
-			colClasses[col] = PGTYPCLASS_BOOL;
-#endif
-			break;
+			return PGTYPCLASS_BOOL;
 		case PGOID_TYPE_INT8:
 		case PGOID_TYPE_INT2:
 		case PGOID_TYPE_INT4:
@@ -129,46 +284,37 @@ pgTypClass pgSet::ColTypClass(const int col) const
 		case PGOID_TYPE_MONEY:
 		case PGOID_TYPE_BIT:
 		case PGOID_TYPE_NUMERIC:
-//ABDUL: 30 Aug 2021:BEGIN
-#if wxCHECK_VERSION(3, 1, 0)
-			((pgSet*)this)->colClasses[col] = PGTYPCLASS_NUMERIC;
-#else
-			colClasses[col] = PGTYPCLASS_NUMERIC;
-#endif
-			break;
+			return PGTYPCLASS_NUMERIC;
 		case PGOID_TYPE_BYTEA:
 		case PGOID_TYPE_CHAR:
 		case PGOID_TYPE_NAME:
 		case PGOID_TYPE_TEXT:
 		case PGOID_TYPE_VARCHAR:
-//ABDUL: 30 Aug 2021:BEGIN
-#if wxCHECK_VERSION(3, 1, 0)
-			((pgSet*)this)->colClasses[col] = PGTYPCLASS_STRING;
-#else
-			colClasses[col] = PGTYPCLASS_STRING;
-#endif
-			break;
+			return PGTYPCLASS_STRING;
 		case PGOID_TYPE_TIMESTAMP:
 		case PGOID_TYPE_TIMESTAMPTZ:
 		case PGOID_TYPE_TIME:
 		case PGOID_TYPE_TIMETZ:
 		case PGOID_TYPE_INTERVAL:
-//ABDUL: 30 Aug 2021:BEGIN
-#if wxCHECK_VERSION(3, 1, 0)
-			((pgSet*)this)->colClasses[col] = PGTYPCLASS_DATE;
-#else
-			colClasses[col] = PGTYPCLASS_DATE;
-#endif
-			break;
+			return PGTYPCLASS_DATE;
 		default:
-//ABDUL: 30 Aug 2021:BEGIN
-#if wxCHECK_VERSION(3, 1, 0)
-			((pgSet*)this)->colClasses[col] = PGTYPCLASS_OTHER;
-#else
-			colClasses[col] = PGTYPCLASS_OTHER;
-#endif
-			break;
+			return PGTYPCLASS_OTHER;
 	}
+}
+
+
+pgTypClass pgSet::ColTypClass(const int col) const
+{
+	wxASSERT(col < nCols && col >= 0);
+
+	ResolveColTypes();
+
+	// Without the catalog, at least the built-in types can be classified
+	if (!colTypesResolved)
+		return TypClassFromOid(PQftype(res, col));
+
+	if (colClasses[col] == 0)
+		return PGTYPCLASS_OTHER;
 
 	return (pgTypClass)colClasses[col];
 }
@@ -178,30 +324,18 @@ wxString pgSet::ColType(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
-	if (!colTypes[col].IsEmpty())
-		return colTypes[col];
+	ResolveColTypes();
 
-	wxString szSQL, szResult;
-	szSQL.Printf(wxT("SELECT format_type(oid,NULL) as typname FROM pg_type WHERE oid = %d"), (int)ColTypeOid(col));
-	szResult = ExecuteScalar(szSQL);
-	colTypes[col] = szResult;
-
-	return szResult;
+	return colTypes[col];
 }
 
 wxString pgSet::ColFullType(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
-	if (!colFullTypes[col].IsEmpty())
-		return colFullTypes[col];
-
-	wxString szSQL, szResult;
-	szSQL.Printf(wxT("SELECT format_type(oid,%d) as typname FROM pg_type WHERE oid = %d"), (int)ColTypeMod(col), (int)ColTypeOid(col));
-	szResult = ExecuteScalar(szSQL);
-	colFullTypes[col] = szResult;
+	ResolveColTypes();
 
-	return szResult;
+	return colFullTypes[col];
 }
 
 int pgSet::ColScale(const int col) const
@@ -219,18 +353,52 @@ wxString pgSet::ColName(const int col) const
 }
 
 
-int pgSet::ColNumber(const wxString &colname) const
+// Hash all column names once, so the by-name accessors don't need to
+// convert and linearly search the column names through PQfnumber for
+// every single value. As with PQfnumber, the first of several columns
+// with the same name wins.
+void pgSet::BuildColNumbers()
 {
-	int col;
+	for (int col = 0; col < nCols; col++)
+	{
+		wxString name(PQfname(res, col), conv);
+		if (colNumbers.find(name) == colNumbers.end())
+			colNumbers[name] = col;
+	}
+}
+
 
-	if (needColQuoting)
+int pgSet::LookupColNumber(const wxString &colname) const
+{
+	wxString name = colname;
+
+	// Without column quoting, libpq folds unquoted names to lower case;
+	// leave names that use quoting to PQfnumber itself. Like libpq and
+	// the server, fold A-Z only, not other letters.
+	if (!needColQuoting)
 	{
-		wxString quotedColName = colname;
-		quotedColName.Replace(wxT("\""), wxT("\"\""));
-		col = PQfnumber(res, (wxT("\"") + quotedColName + wxT("\"")).mb_str(conv));
+		if (name.Find(wxT('"')) != wxNOT_FOUND)
+			return PQfnumber(res, name.mb_str(conv));
+
+		for (size_t i = 0 ; i < name.Length() ; i++)
+		{
+			wxChar c = name.GetChar(i);
+			if (c >= wxT('A') && c <= wxT('Z'))
+				name.SetChar(i, c + (wxT('a') - wxT('A')));
+		}
 	}
-	else
-		col = PQfnumber(res, colname.mb_str(conv));
+
+	pgSetColumnHash::const_iterator it = colNumbers.find(name);
+	if (it == colNumbers.end())
+		return -1;
+
+	return it->second;
+}
+
+
+int pgSet::ColNumber(const wxString &colname) const
+{
+	int col = LookupColNumber(colname);
 
 	if (col < 0)
 	{
@@ -241,30 +409,35 @@ int pgSet::ColNumber(const wxString &colname) const
 
 bool pgSet::HasColumn(const wxString &colname) const
 {
-	if (needColQuoting)
-	{
-		wxString quotedColName = colname;
-		quotedColName.Replace(wxT("\""), wxT("\"\""));
-		return (PQfnumber(res, (wxT("\"") + quotedColName + wxT("\"")).mb_str(conv)) < 0 ? false : true);
-	}
-	else
-		return (PQfnumber(res, colname.mb_str(conv)) < 0 ? false : true);
-
+	return LookupColNumber(colname) >= 0;
 }
 
 
 
+// The text of a binary value is formatted once, and kept as long as the set
 char *pgSet::GetCharPtr(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
-	return PQgetvalue(res, pos - 1, col);
+	if (IsBinaryNative(col))
+	{
+		wxLongLong_t key = (wxLongLong_t)(pos - 1) * nCols + col;
+
+		pgSetTextHash::iterator it = binaryTexts.find(key);
+		if (it != binaryTexts.end())
+			return it->second;
+
+		char *text = strdup(FormatBinary(col).mb_str(conv));
+		binaryTexts[key] = text;
+		return text;
+	}
+	return ValuePtr(col);
 }
 
 
 char *pgSet::GetCharPtr(const wxString &col) const
 {
-	return PQgetvalue(res, pos - 1, ColNumber(col));
+	return GetCharPtr(ColNumber(col));
 }
 
 
@@ -272,7 +445,10 @@ wxString pgSet::GetVal(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
-	return wxString(GetCharPtr(col), conv);
+	if (IsBinaryNative(col))
+		return FormatBinary(col);
+
+	return wxString(ValuePtr(col), conv);
 }
 
 
@@ -286,7 +462,10 @@ long pgSet::GetLong(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
-	char *c = PQgetvalue(res, pos - 1, col);
+	if (IsBinaryNative(col))
+		return (long)BinaryInt(col);
+
+	char *c = ValuePtr(col);
 	if (c)
 		return atol(c);
 	else
@@ -296,11 +475,7 @@ long pgSet::GetLong(const int col) const
 
 long pgSet::GetLong(const wxString &col) const
 {
-	char *c = PQgetvalue(res, pos - 1, ColNumber(col));
-	if (c)
-		return atol(c);
-	else
-		return 0;
+	return GetLong(ColNumber(col));
 }
 
 
@@ -308,7 +483,10 @@ bool pgSet::GetBool(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
-	char *c = PQgetvalue(res, pos - 1, col);
+	if (IsBinaryNative(col))
+		return BinaryInt(col) != 0;
+
+	char *c = ValuePtr(col);
 	if (c)
 	{
 		if (*c == 't' || *c == '1' || !strcmp(c, "on"))
@@ -328,6 +506,9 @@ wxDateTime pgSet::GetDateTime(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
+	if (IsBinaryNative(col))
+		return BinaryDateTime(col);
+
 	wxDateTime dt;
 	wxString str = GetVal(col);
 	/* This hasn't just been used. ( Is not infinity ) */
@@ -347,6 +528,14 @@ wxDateTime pgSet::GetDate(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
+	if (IsBinaryNative(col))
+	{
+		wxDateTime dt = BinaryDateTime(col);
+		if (dt.IsValid())
+			dt.ResetTime();
+		return dt;
+	}
+
 	wxDateTime dt;
 	wxString str = GetVal(col);
 	/* This hasn't just been used. ( Is not infinity ) */
@@ -366,6 +555,9 @@ double pgSet::GetDouble(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
+	if (IsBinaryNative(col))
+		return BinaryDouble(col);
+
 	return StrToDouble(GetVal(col));
 }
 
@@ -380,7 +572,10 @@ wxULongLong pgSet::GetLongLong(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
-	char *c = PQgetvalue(res, pos - 1, col);
+	if (IsBinaryNative(col))
+		return wxULongLong((wxULongLong_t)BinaryInt(col));
+
+	char *c = ValuePtr(col);
 	if (c)
 		return atolonglong(c);
 	else
@@ -397,7 +592,10 @@ OID pgSet::GetOid(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
-	char *c = PQgetvalue(res, pos - 1, col);
+	if (IsBinaryNative(col))
+		return (OID)BinaryInt(col);
+
+	char *c = ValuePtr(col);
 	if (c)
 		return (OID)strtoul(c, 0, 10);
 	else
@@ -411,9 +609,263 @@ OID pgSet::GetOid(const wxString &col) const
 }
 
 
-wxString pgSet::ExecuteScalar(const wxString &sql) const
+//////////////////////////////////////////////////////////////////
+// Results in binary format
+//////////////////////////////////////////////////////////////////
+
+// Microseconds per day, and days from 0000-03-01 to 2000-01-01 (the
+// PostgreSQL epoch), for decoding timestamps
+#define PGSET_USECS_PER_DAY     ((wxInt64)86400 * 1000000)
+#define PGSET_EPOCH_DAYS        730425
+// Timestamp values standing for +/-infinity
+#define PGSET_TIMESTAMP_INFINITY wxLL(0x7fffffffffffffff)
+
+bool pgSet::CanFetchBinary(OID typoid)
+{
+	switch (typoid)
+	{
+		case PGOID_TYPE_BOOL:
+		case PGOID_TYPE_INT2:
+		case PGOID_TYPE_INT4:
+		case PGOID_TYPE_INT8:
+		case PGOID_TYPE_OID:
+		case PGOID_TYPE_FLOAT4:
+		case PGOID_TYPE_FLOAT8:
+		case PGOID_TYPE_TIMESTAMP:
+		// The binary format of these is just the text
+		case PGOID_TYPE_CHAR:
+		case PGOID_TYPE_NAME:
+		case PGOID_TYPE_TEXT:
+		case PGOID_TYPE_VARCHAR:
+		case PGOID_TYPE_BPCHAR:
+			return true;
+	}
+	return false;
+}
+
+
+// Is this a column in binary format, which is not just text?
+bool pgSet::IsBinaryNative(const int col) const
+{
+	if (!binary || !PQfformat(res, col))
+		return false;
+
+	switch (PQftype(res, col))
+	{
+		case PGOID_TYPE_CHAR:
+		case PGOID_TYPE_NAME:
+		case PGOID_TYPE_TEXT:
+		case PGOID_TYPE_VARCHAR:
+		case PGOID_TYPE_BPCHAR:
+			return false;
+	}
+	return true;
+}
+
+
+// Integer in network byte order
+static wxUint64 NetworkInt(const char *p, int len)
+{
+	wxUint64 val = 0;
+
+	for (int i = 0; i < len; i++)
+		val = (val << 8) | (unsigned char)p[i];
+	return val;
+}
+
+
+wxInt64 pgSet::BinaryInt(const int col) const
+{
+	int row;
+	PGresult *r = RowResult(pos - 1, row);
+	int len = PQgetlength(r, row, col);
+	const char *p = PQgetvalue(r, row, col);
+
+	if (PQgetisnull(r, row, col))
+		return 0;
+
+	switch (PQftype(res, col))
+	{
+		case PGOID_TYPE_BOOL:
+			return len > 0 && *p != 0;
+		case PGOID_TYPE_INT2:
+			return (wxInt16)NetworkInt(p, len);
+		case PGOID_TYPE_INT4:
+			return (wxInt32)NetworkInt(p, len);
+		case PGOID_TYPE_FLOAT4:
+		case PGOID_TYPE_FLOAT8:
+			return (wxInt64)BinaryDouble(col);
+		default:
+			// int8, oid (unsigned) and timestamp (microseconds since 2000)
+			return (wxInt64)NetworkInt(p, len);
+	}
+}
+
+
+double pgSet::BinaryDouble(const int col) const
 {
-	return conn->ExecuteScalar(sql);
+	int row;
+	PGresult *r = RowResult(pos - 1, row);
+	int len = PQgetlength(r, row, col);
+	const char *p = PQgetvalue(r, row, col);
+
+	if (PQgetisnull(r, row, col))
+		return 0;
+
+	switch (PQftype(res, col))
+	{
+		case PGOID_TYPE_FLOAT4:
+		{
+			wxUint32 bits = (wxUint32)NetworkInt(p, len);
+			float f;
+			memcpy(&f, &bits, sizeof(f));
+			return f;
+		}
+		case PGOID_TYPE_FLOAT8:
+		{
+			wxUint64 bits = NetworkInt(p, len);
+			double d;
+			memcpy(&d, &bits, sizeof(d));
+			return d;
+		}
+		default:
+			return (double)BinaryInt(col);
+	}
+}
+
+
+// Split a timestamp into its (proleptic Gregorian) date and time of day
+static bool SplitTimestamp(wxInt64 usecs, long &year, int &month, int &day, wxInt64 &timeOfDay)
+{
+	// +/-infinity
+	if (usecs == PGSET_TIMESTAMP_INFINITY || usecs == -PGSET_TIMESTAMP_INFINITY - 1)
+		return false;
+
+	wxInt64 days = usecs / PGSET_USECS_PER_DAY;
+	timeOfDay = usecs % PGSET_USECS_PER_DAY;
+	if (timeOfDay < 0)
+	{
+		timeOfDay += PGSET_USECS_PER_DAY;
+		days--;
+	}
+
+	// Days since 0000-03-01 to the civil date
+	days += PGSET_EPOCH_DAYS;
+	wxInt64 era = (days >= 0 ? days : days - 146096) / 146097;
+	wxInt64 doe = days - era * 146097;
+	wxInt64 yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+	wxInt64 doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+	wxInt64 mp = (5 * doy + 2) / 153;
+
+	day = (int)(doy - (153 * mp + 2) / 5 + 1);
+	month = (int)(mp < 10 ? mp + 3 : mp - 9);
+	year = (long)(yoe + era * 400 + (month <= 2 ? 1 : 0));
+
+	return true;
+}
+
+
+wxDateTime pgSet::BinaryDateTime(const int col) const
+{
+	wxDateTime dt;
+	long year;
+	int month, day;
+	wxInt64 timeOfDay;
+
+	if (PQftype(res, col) != PGOID_TYPE_TIMESTAMP || IsNull(col) ||
+	        !SplitTimestamp(BinaryInt(col), year, month, day, timeOfDay))
+		return dt;
+
+	long secs = (long)(timeOfDay / 1000000);
+	dt.Set((wxDateTime::wxDateTime_t)day, (wxDateTime::Month)(month - 1), (int)year,
+	       (wxDateTime::wxDateTime_t)(secs / 3600), (wxDateTime::wxDateTime_t)(secs / 60 % 60),
+	       (wxDateTime::wxDateTime_t)(secs % 60), (wxDateTime::wxDateTime_t)(timeOfDay / 1000 % 1000));
+	return dt;
+}
+
+
+// Format a binary value the way the server would have sent it as text (for
+// timestamps, in the ISO DateStyle)
+wxString pgSet::FormatBinary(const int col) const
+{
+	if (IsNull(col))
+		return wxEmptyString;
+
+	switch (PQftype(res, col))
+	{
+		case PGOID_TYPE_BOOL:
+			return BinaryInt(col) ? wxT("t") : wxT("f");
+
+		case PGOID_TYPE_OID:
+			return wxString::Format(wxT("%lu"), (unsigned long)BinaryInt(col));
+
+		case PGOID_TYPE_FLOAT4:
+		case PGOID_TYPE_FLOAT8:
+		{
+			double val = BinaryDouble(col);
+
+			if (wxIsNaN(val))
+				return wxT("NaN");
+			if (!wxFinite(val))
+				return val > 0 ? wxT("Infinity") : wxT("-Infinity");
+
+			// The shortest digits which read back to the same value, laid
+			// out as float4out() and float8out() of PostgreSQL 12 do: in
+			// exponential notation, unless the exponent is from -4 to
+			// below FLT_DIG or DBL_DIG
+			bool isFloat4 = PQftype(res, col) == PGOID_TYPE_FLOAT4;
+			int maxDigits = isFloat4 ? 9 : 17;
+			int digits;
+			char buf[64];
+			for (digits = 1; digits < maxDigits; digits++)
+			{
+				sprintf(buf, "%.*e", digits - 1, val);
+				if (isFloat4 ? (float)strtod(buf, NULL) == (float)val : strtod(buf, NULL) == val)
+					break;
+			}
+			if (digits == maxDigits)
+				sprintf(buf, "%.*e", digits - 1, val);
+
+			int exponent = atoi(strchr(buf, 'e') + 1);
+			if (val == 0 || (exponent >= -4 && exponent < (isFloat4 ? 6 : 15)))
+			{
+				int decimals = digits - 1 - exponent;
+				sprintf(buf, "%.*f", decimals > 0 ? decimals : 0, val);
+			}
+			return wxString(buf, wxConvLibc);
+		}
+
+		case PGOID_TYPE_TIMESTAMP:
+		{
+			wxInt64 usecs = BinaryInt(col);
+			long year;
+			int month, day;
+			wxInt64 timeOfDay;
+
+			if (!SplitTimestamp(usecs, year, month, day, timeOfDay))
+				return usecs > 0 ? wxT("infinity") : wxT("-infinity");
+
+			long secs = (long)(timeOfDay / 1000000);
+			long fraction = (long)(timeOfDay % 1000000);
+
+			wxString str = wxString::Format(wxT("%04ld-%02d-%02d %02ld:%02ld:%02ld"),
+			                                year > 0 ? year : 1 - year, month, day,
+			                                secs / 3600, secs / 60 % 60, secs % 60);
+			if (fraction)
+			{
+				wxString frac = wxString::Format(wxT(".%06ld"), fraction);
+				while (frac.Last() == wxT('0'))
+					frac.RemoveLast();
+				str += frac;
+			}
+			if (year <= 0)
+				str += wxT(" BC");
+			return str;
+		}
+
+		default:
+			return wxLongLong(BinaryInt(col)).ToString();
+	}
 }
 
 
@@ -413,6 +413,7 @@ bool dbgController::Start()
 	m_dbgThread = new pgQueryThread(
 	    m_dbgConn, this, &(dbgController::NoticeHandler), this);
 	m_dbgThread->SetEventOnCancellation(false);
+	m_dbgThread->EnablePipelining(true);
 
 	if (m_dbgThread->Create() != wxTHREAD_NO_ERROR)
 	{
@@ -886,6 +887,9 @@ void dbgController::UpdateBreakpoints()
 	m_dbgThread->AddQuery(
 	    wxString::Format(ms_cmdGetBreakpoints, m_model->GetSession().c_str()),
 	    NULL, RESULT_ID_GET_BREAKPOINTS);
+	m_dbgThread->AddQuery(
+	    wxString::Format(ms_cmdGetVars, m_model->GetSession().c_str()),
+	    NULL, RESULT_ID_GET_VARS);
 	UNLOCKMUTEX(m_dbgThreadLock);
 }
 
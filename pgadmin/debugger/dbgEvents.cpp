@@ -490,9 +490,18 @@ void dbgController::ResultBreakpoint(pgQueryResultEvent &_ev)
 			m_model->AddSource(func, src);
 			m_frm->DisplaySource(src);
 
+			// The stack, the break-points and the variables do not depend on
+			// each other, so queue them together; the debugger thread sends
+			// them in a single pipeline, where the server supports it.
 			m_dbgThread->AddQuery(
 			    wxString::Format(ms_cmdGetStack, m_model->GetSession().c_str()),
 			    NULL, RESULT_ID_GET_STACK);
+			m_dbgThread->AddQuery(
+			    wxString::Format(ms_cmdGetBreakpoints, m_model->GetSession().c_str()),
+			    NULL, RESULT_ID_GET_BREAKPOINTS);
+			m_dbgThread->AddQuery(
+			    wxString::Format(ms_cmdGetVars, m_model->GetSession().c_str()),
+			    NULL, RESULT_ID_GET_VARS);
 
 			m_frm->EnableToolsAndMenus(true);
 		}
@@ -595,11 +604,6 @@ void dbgController::ResultStack(pgQueryResultEvent &_ev)
 			dbgStackFrameList stacks;
 			ctlStackWindow    *stackWin = m_frm->GetStackWindow();
 
-			// Fetched the stack, now fetch the break-points
-			m_dbgThread->AddQuery(
-			    wxString::Format(ms_cmdGetBreakpoints, m_model->GetSession().c_str()),
-			    NULL, RESULT_ID_GET_BREAKPOINTS);
-
 			stackWin->ClearStack();
 
 			int selected = 0,
@@ -668,10 +672,6 @@ void dbgController::ResultBreakpoints(pgQueryResultEvent &_ev)
 				pkgCol = set->ColNumber(wxT("pkg"));
 			}
 
-			m_dbgThread->AddQuery(
-			    wxString::Format(ms_cmdGetVars, m_model->GetSession().c_str()),
-			    NULL, RESULT_ID_GET_VARS);
-
 			m_frm->ClearBreakpointMarkers();
 			dbgBreakPointList &breakpoints = m_model->GetBreakPoints();
 			WX_CLEAR_ARRAY(breakpoints);
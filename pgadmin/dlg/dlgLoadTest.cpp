@@ -0,0 +1,252 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// dlgLoadTest.cpp - Run a script with a number of concurrent clients
+//
+//////////////////////////////////////////////////////////////////////////
+
+// App headers
+#include "pgAdmin3.h"
+
+#include <wx/spinctrl.h>
+
+#include "utils/misc.h"
+#include "db/pgConn.h"
+#include "db/pgLoadTest.h"
+#include "utils/sqlLexer.h"
+#include "ctl/ctlListView.h"
+#include "dlg/dlgLoadTest.h"
+#include "frm/menu.h"
+
+// How often the figures are refreshed while the test runs (ms)
+#define LOADTEST_REFRESH_INTERVAL   500
+#define LOADTEST_BAR_WIDTH          40
+
+wxWindowID TIMER_LOADTEST_ID = ::wxNewId();
+
+#define spnClients          CTRL_SPIN("spnClients")
+#define spnSeconds          CTRL_SPIN("spnSeconds")
+#define spnIterations       CTRL_SPIN("spnIterations")
+#define rbSeconds           CTRL_RADIOBUTTON("rbSeconds")
+#define rbIterations        CTRL_RADIOBUTTON("rbIterations")
+#define stStatements        CTRL_STATIC("stStatements")
+#define lstSummary          CTRL_LISTVIEW("lstSummary")
+#define lstHistogram        CTRL_LISTVIEW("lstHistogram")
+#define lstClients          CTRL_LISTVIEW("lstClients")
+#define btnStart            CTRL_BUTTON("btnStart")
+#define btnStop             CTRL_BUTTON("btnStop")
+
+BEGIN_EVENT_TABLE(dlgLoadTest, pgDialog)
+	EVT_BUTTON(XRCID("btnStart"),               dlgLoadTest::OnStart)
+	EVT_BUTTON(XRCID("btnStop"),                dlgLoadTest::OnStop)
+	EVT_RADIOBUTTON(XRCID("rbSeconds"),         dlgLoadTest::OnLimit)
+	EVT_RADIOBUTTON(XRCID("rbIterations"),      dlgLoadTest::OnLimit)
+	EVT_MENU(LOADTEST_COMPLETE,                 dlgLoadTest::OnComplete)
+	EVT_TIMER(TIMER_LOADTEST_ID,                dlgLoadTest::OnTimer)
+	EVT_BUTTON(wxID_CANCEL,                     dlgLoadTest::OnClose)
+	EVT_CLOSE(                                  dlgLoadTest::OnCloseWindow)
+END_EVENT_TABLE()
+
+
+dlgLoadTest::dlgLoadTest(wxWindow *parent, pgConn *_conn, const wxString &_script) :
+	pgDialog(),
+	timer(this, TIMER_LOADTEST_ID)
+{
+	conn = _conn;
+	script = _script;
+	loadTest = NULL;
+
+	SetFont(settings->GetSystemFont());
+	LoadResource(parent, wxT("dlgLoadTest"));
+	RestorePosition();
+
+	spnClients->SetRange(1, PGLOADTEST_MAX_CLIENTS);
+
+	size_t statements = sqlLexer::Split(script).GetCount();
+	stStatements->SetLabel(wxString::Format(
+	                           wxPLURAL("Each iteration runs %d statement; every client has a connection of its own.",
+	                                    "Each iteration runs %d statements; every client has a connection of its own.",
+	                                    statements), (int)statements));
+
+	lstSummary->AddColumn(_("Property"), 150);
+	lstSummary->AddColumn(_("Value"), 150);
+
+	lstHistogram->AddColumn(_("Latency"), 100);
+	lstHistogram->AddColumn(_("Transactions"), 90, wxLIST_FORMAT_RIGHT);
+	lstHistogram->AddColumn(_("Distribution"), 250);
+
+	lstClients->AddColumn(_("Client"), 60);
+	lstClients->AddColumn(_("Transactions"), 90, wxLIST_FORMAT_RIGHT);
+	lstClients->AddColumn(_("Errors"), 60, wxLIST_FORMAT_RIGHT);
+	lstClients->AddColumn(_("Share"), 250);
+
+	// Make room for the statement count
+	Layout();
+	EnableControls();
+}
+
+
+dlgLoadTest::~dlgLoadTest()
+{
+	Stop();
+	if (loadTest)
+		delete loadTest;
+
+	SavePosition();
+}
+
+
+void dlgLoadTest::EnableControls()
+{
+	bool running = loadTest && loadTest->IsRunning();
+
+	spnClients->Enable(!running);
+	rbSeconds->Enable(!running);
+	rbIterations->Enable(!running);
+	spnSeconds->Enable(!running && rbSeconds->GetValue());
+	spnIterations->Enable(!running && rbIterations->GetValue());
+
+	btnStart->Enable(!running);
+	btnStop->Enable(running);
+}
+
+
+void dlgLoadTest::Start()
+{
+	if (loadTest)
+		delete loadTest;
+
+	wxBusyCursor wait;
+
+	loadTest = new pgLoadTest(conn, script, spnClients->GetValue(),
+	                          rbSeconds->GetValue() ? spnSeconds->GetValue() : 0,
+	                          rbIterations->GetValue() ? spnIterations->GetValue() : 0,
+	                          this, LOADTEST_COMPLETE);
+
+	if (!loadTest->Start())
+	{
+		wxLogError(wxT("%s"), loadTest->GetLastError().c_str());
+		delete loadTest;
+		loadTest = NULL;
+		return;
+	}
+
+	timer.Start(LOADTEST_REFRESH_INTERVAL);
+	ShowResults();
+	EnableControls();
+}
+
+
+void dlgLoadTest::Stop()
+{
+	timer.Stop();
+	if (loadTest && loadTest->IsRunning())
+	{
+		wxBusyCursor wait;
+		loadTest->Stop();
+	}
+}
+
+
+void dlgLoadTest::ShowResults()
+{
+	lstSummary->DeleteAllItems();
+	lstHistogram->DeleteAllItems();
+	lstClients->DeleteAllItems();
+
+	if (!loadTest)
+		return;
+
+	long transactions = loadTest->GetTransactions();
+
+	lstSummary->AppendItem(-1, _("Clients"), NumToStr((long)loadTest->GetClients().GetCount()));
+	lstSummary->AppendItem(-1, _("Elapsed"), wxString::Format(_("%.1f s"), loadTest->GetElapsed()));
+	lstSummary->AppendItem(-1, _("Transactions"), NumToStr(transactions));
+	lstSummary->AppendItem(-1, _("TPS"), wxString::Format(wxT("%.1f"), loadTest->GetTps()));
+	lstSummary->AppendItem(-1, _("Average latency"), wxString::Format(_("%.3f ms"), loadTest->GetAverageLatency()));
+	lstSummary->AppendItem(-1, _("Errors"), NumToStr(loadTest->GetErrors()));
+	lstSummary->AppendItem(-1, _("Fairness"), wxString::Format(wxT("%.3f"), loadTest->GetFairness()));
+	if (loadTest->GetErrors())
+		lstSummary->AppendItem(-1, _("Last error"), loadTest->GetLastError());
+
+	int bucket;
+	for (bucket = 0 ; bucket < PGQUERYSTATS_BUCKETS ; bucket++)
+	{
+		long count = loadTest->GetHistogram(bucket);
+		int width = transactions ? (int)((count * LOADTEST_BAR_WIDTH + transactions - 1) / transactions) : 0;
+
+		lstHistogram->AppendItem(-1, pgQueryStats::GetBucketLabel(bucket), NumToStr(count), wxString(wxT('#'), width));
+	}
+
+	// Bars relative to the busiest client, which show unfair scheduling
+	// at a glance
+	const pgLoadTestClientArray &clients = loadTest->GetClients();
+	long most = 0;
+	size_t i;
+	for (i = 0 ; i < clients.GetCount() ; i++)
+	{
+		if (clients.Item(i)->transactions > most)
+			most = clients.Item(i)->transactions;
+	}
+
+	for (i = 0 ; i < clients.GetCount() ; i++)
+	{
+		pgLoadTestClient *client = clients.Item(i);
+		int width = most ? (int)((client->transactions * LOADTEST_BAR_WIDTH + most - 1) / most) : 0;
+
+		lstClients->AppendItem(-1, NumToStr((long)client->number), NumToStr(client->transactions),
+		                       NumToStr(client->errors), wxString(wxT('#'), width));
+	}
+}
+
+
+void dlgLoadTest::OnStart(wxCommandEvent &ev)
+{
+	Start();
+}
+
+
+void dlgLoadTest::OnStop(wxCommandEvent &ev)
+{
+	Stop();
+	ShowResults();
+	EnableControls();
+}
+
+
+void dlgLoadTest::OnLimit(wxCommandEvent &ev)
+{
+	EnableControls();
+}
+
+
+void dlgLoadTest::OnComplete(wxCommandEvent &ev)
+{
+	timer.Stop();
+	ShowResults();
+	EnableControls();
+}
+
+
+void dlgLoadTest::OnTimer(wxTimerEvent &ev)
+{
+	if (loadTest && loadTest->IsRunning())
+		ShowResults();
+}
+
+
+void dlgLoadTest::OnClose(wxCommandEvent &ev)
+{
+	Close();
+}
+
+
+void dlgLoadTest::OnCloseWindow(wxCloseEvent &ev)
+{
+	Stop();
+	EndModal(wxID_CANCEL);
+}
@@ -0,0 +1,380 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// dlgQueryBenchmark.cpp - Repeated, timed runs of a query
+//
+//////////////////////////////////////////////////////////////////////////
+
+// App headers
+#include "pgAdmin3.h"
+
+#include <wx/ffile.h>
+#include <wx/spinctrl.h>
+
+#include "utils/misc.h"
+#include "db/pgConn.h"
+#include "ctl/ctlListView.h"
+#include "dlg/dlgQueryBenchmark.h"
+#include "frm/menu.h"
+
+// Buckets of the latency histogram, spread evenly over the range of all runs
+#define BENCHMARK_BUCKETS       10
+#define BENCHMARK_BAR_WIDTH     40
+
+#define spnRuns             CTRL_SPIN("spnRuns")
+#define spnWarmups          CTRL_SPIN("spnWarmups")
+#define chkSeparate         CTRL_CHECKBOX("chkSeparate")
+#define chkServerTimings    CTRL_CHECKBOX("chkServerTimings")
+#define chkCompare          CTRL_CHECKBOX("chkCompare")
+#define txtCompare          CTRL_TEXT("txtCompare")
+#define lstResults          CTRL_LISTVIEW("lstResults")
+#define lstHistogram        CTRL_LISTVIEW("lstHistogram")
+#define gauge               CTRL_GAUGE("gauge")
+#define btnStart            CTRL_BUTTON("btnStart")
+#define btnStop             CTRL_BUTTON("btnStop")
+#define btnExport           CTRL_BUTTON("btnExport")
+
+BEGIN_EVENT_TABLE(dlgQueryBenchmark, pgDialog)
+	EVT_BUTTON(XRCID("btnStart"),           dlgQueryBenchmark::OnStart)
+	EVT_BUTTON(XRCID("btnStop"),            dlgQueryBenchmark::OnStop)
+	EVT_BUTTON(XRCID("btnExport"),          dlgQueryBenchmark::OnExport)
+	EVT_CHECKBOX(XRCID("chkCompare"),       dlgQueryBenchmark::OnCompare)
+	EVT_MENU(BENCHMARK_PROGRESS,            dlgQueryBenchmark::OnProgress)
+	EVT_BUTTON(wxID_CANCEL,                 dlgQueryBenchmark::OnClose)
+	EVT_CLOSE(                              dlgQueryBenchmark::OnCloseWindow)
+END_EVENT_TABLE()
+
+
+static wxString FormatMs(double ms)
+{
+	return wxString::Format(wxT("%.3f"), ms);
+}
+
+
+dlgQueryBenchmark::dlgQueryBenchmark(wxWindow *parent, pgConn *_conn, const wxString &_query) :
+	pgDialog()
+{
+	conn = _conn;
+	benchConn = NULL;
+	query = _query;
+	thread = NULL;
+	seq = 0;
+
+	SetFont(settings->GetSystemFont());
+	LoadResource(parent, wxT("dlgQueryBenchmark"));
+	RestorePosition();
+
+	txtCompare->SetValue(query);
+
+	lstResults->AddColumn(_("Query"), 250);
+	lstResults->AddColumn(_("Runs"), 50, wxLIST_FORMAT_RIGHT);
+	lstResults->AddColumn(_("Errors"), 50, wxLIST_FORMAT_RIGHT);
+	lstResults->AddColumn(_("Min ms"), 70, wxLIST_FORMAT_RIGHT);
+	lstResults->AddColumn(_("Median ms"), 70, wxLIST_FORMAT_RIGHT);
+	lstResults->AddColumn(_("95% ms"), 70, wxLIST_FORMAT_RIGHT);
+	lstResults->AddColumn(_("Max ms"), 70, wxLIST_FORMAT_RIGHT);
+	lstResults->AddColumn(_("Mean ms"), 70, wxLIST_FORMAT_RIGHT);
+	lstResults->AddColumn(_("Planning ms"), 80, wxLIST_FORMAT_RIGHT);
+	lstResults->AddColumn(_("Execution ms"), 80, wxLIST_FORMAT_RIGHT);
+
+	EnableControls();
+}
+
+
+dlgQueryBenchmark::~dlgQueryBenchmark()
+{
+	Stop();
+	SavePosition();
+}
+
+
+void dlgQueryBenchmark::EnableControls()
+{
+	bool running = (thread != NULL);
+
+	spnRuns->Enable(!running);
+	spnWarmups->Enable(!running);
+	chkSeparate->Enable(!running);
+	// TIMING off is known to EXPLAIN as of 9.2
+	chkServerTimings->Enable(!running && conn->BackendMinimumVersion(9, 2) && !conn->GetIsGreenplum());
+	chkCompare->Enable(!running);
+	txtCompare->Enable(!running && chkCompare->GetValue());
+
+	btnStart->Enable(!running);
+	btnStop->Enable(running);
+	btnExport->Enable(!running && results.GetCount() > 0);
+}
+
+
+void dlgQueryBenchmark::Start()
+{
+	wxArrayString queries;
+	queries.Add(query);
+	if (chkCompare->GetValue() && !txtCompare->GetValue().Strip(wxString::both).IsEmpty())
+		queries.Add(txtCompare->GetValue());
+
+	pgConn *runConn = conn;
+	if (chkSeparate->GetValue())
+	{
+		if (!benchConn)
+		{
+			benchConn = conn->Duplicate(wxT("pgAdmin benchmark"));
+			if (!benchConn || benchConn->GetStatus() != PGCONN_OK)
+			{
+				wxLogError(_("Could not open a separate connection for the benchmark."));
+				if (benchConn)
+				{
+					delete benchConn;
+					benchConn = NULL;
+				}
+				return;
+			}
+		}
+		runConn = benchConn;
+	}
+
+	results.Empty();
+	lstResults->DeleteAllItems();
+	lstHistogram->ClearAll();
+
+	thread = new pgBenchmarkThread(runConn, queries, spnRuns->GetValue(), spnWarmups->GetValue(),
+	                               chkServerTimings->IsEnabled() && chkServerTimings->GetValue(),
+	                               this, BENCHMARK_PROGRESS, ++seq);
+
+	if (thread->Create() != wxTHREAD_NO_ERROR || thread->Run() != wxTHREAD_NO_ERROR)
+	{
+		wxLogError(_("Could not start the benchmark."));
+		delete thread;
+		thread = NULL;
+		return;
+	}
+
+	gauge->SetRange(thread->GetRunsTotal());
+	gauge->SetValue(0);
+	EnableControls();
+}
+
+
+// Cancels a running benchmark and waits for it to finish
+void dlgQueryBenchmark::Stop()
+{
+	if (thread)
+	{
+		thread->Cancel();
+		thread->Wait();
+		delete thread;
+		thread = NULL;
+	}
+}
+
+
+void dlgQueryBenchmark::ShowResults()
+{
+	lstResults->DeleteAllItems();
+
+	size_t i;
+	for (i = 0 ; i < results.GetCount() ; i++)
+	{
+		pgBenchmarkResult &result = results.Item(i);
+		pgBenchmarkSummary latency(result.latencies);
+
+		wxString label = result.query.Strip(wxString::both);
+		label.Replace(wxT("\n"), wxT(" "));
+		if (label.Length() > 200)
+			label = label.Left(200) + wxT("...");
+
+		long pos = lstResults->InsertItem(i, label);
+		lstResults->SetItem(pos, 1, NumToStr((long)latency.count));
+		lstResults->SetItem(pos, 2, NumToStr(result.errors));
+		if (latency.count)
+		{
+			lstResults->SetItem(pos, 3, FormatMs(latency.min));
+			lstResults->SetItem(pos, 4, FormatMs(latency.median));
+			lstResults->SetItem(pos, 5, FormatMs(latency.p95));
+			lstResults->SetItem(pos, 6, FormatMs(latency.max));
+			lstResults->SetItem(pos, 7, FormatMs(latency.mean));
+		}
+		// Medians of what the server reports, comparable to the median
+		// client latency
+		pgBenchmarkSummary planning(result.planningTimes), execution(result.executionTimes);
+		if (planning.count)
+			lstResults->SetItem(pos, 8, FormatMs(planning.median));
+		if (execution.count)
+			lstResults->SetItem(pos, 9, FormatMs(execution.median));
+	}
+
+	ShowHistogram();
+}
+
+
+void dlgQueryBenchmark::ShowHistogram()
+{
+	lstHistogram->ClearAll();
+	lstHistogram->AddColumn(_("Latency ms"), 150);
+
+	size_t i, j;
+	double low = 0, high = 0;
+	bool any = false;
+
+	for (i = 0 ; i < results.GetCount() ; i++)
+	{
+		pgBenchmarkSummary latency(results.Item(i).latencies);
+		if (!latency.count)
+			continue;
+
+		if (!any || latency.min < low)
+			low = latency.min;
+		if (!any || latency.max > high)
+			high = latency.max;
+		any = true;
+	}
+
+	// Side by side when compared: the runs, and a bar, per query
+	for (i = 0 ; i < results.GetCount() ; i++)
+	{
+		wxString suffix = results.GetCount() > 1 ? wxString::Format(wxT(" %d"), (int)i + 1) : wxString();
+		lstHistogram->AddColumn(_("Runs") + suffix, 60, wxLIST_FORMAT_RIGHT);
+		lstHistogram->AddColumn(_("Distribution") + suffix, 250);
+	}
+
+	if (!any)
+		return;
+
+	double step = (high - low) / BENCHMARK_BUCKETS;
+
+	int bucket;
+	for (bucket = 0 ; bucket < BENCHMARK_BUCKETS ; bucket++)
+	{
+		double from = low + step * bucket;
+		long pos = lstHistogram->InsertItem(bucket, FormatMs(from) + wxT(" - ") + FormatMs(from + step));
+
+		for (i = 0 ; i < results.GetCount() ; i++)
+		{
+			const wxArrayDouble &latencies = results.Item(i).latencies;
+			size_t count = latencies.GetCount();
+			if (!count)
+				continue;
+
+			long runs = 0;
+			for (j = 0 ; j < count ; j++)
+			{
+				int b = step > 0 ? (int)((latencies.Item(j) - low) / step) : 0;
+				if (b >= BENCHMARK_BUCKETS)
+					b = BENCHMARK_BUCKETS - 1;
+				if (b == bucket)
+					runs++;
+			}
+
+			int width = (int)((runs * BENCHMARK_BAR_WIDTH + count - 1) / count);
+			lstHistogram->SetItem(pos, 1 + i * 2, NumToStr(runs));
+			lstHistogram->SetItem(pos, 2 + i * 2, wxString(wxT('#'), width));
+		}
+
+		// All runs took the same time
+		if (step <= 0)
+			break;
+	}
+}
+
+
+// One line per timed run, for a spreadsheet to chew on
+void dlgQueryBenchmark::Export()
+{
+	wxFileDialog dlg(this, _("Export benchmark"), wxEmptyString, wxT("benchmark.csv"),
+	                 _("CSV files (*.csv)|*.csv|All files (*.*)|*.*"), wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+	if (dlg.ShowModal() != wxID_OK)
+		return;
+
+	wxString str = wxT("query,run,client_ms,planning_ms,execution_ms\n");
+
+	size_t i, j;
+	for (i = 0 ; i < results.GetCount() ; i++)
+	{
+		pgBenchmarkResult &result = results.Item(i);
+		for (j = 0 ; j < result.latencies.GetCount() ; j++)
+		{
+			str += NumToStr((long)i + 1) + wxT(",") + NumToStr((long)j + 1) + wxT(",") + NumToStr(result.latencies.Item(j)) + wxT(",");
+			// Empty where the server timings are not known
+			if (j < result.planningTimes.GetCount() && result.planningTimes.Item(j) >= 0)
+				str += NumToStr(result.planningTimes.Item(j));
+			str += wxT(",");
+			if (j < result.executionTimes.GetCount() && result.executionTimes.Item(j) >= 0)
+				str += NumToStr(result.executionTimes.Item(j));
+			str += wxT("\n");
+		}
+	}
+
+	wxFFile file;
+	if (!file.Open(dlg.GetPath(), wxT("w")) || !file.Write(str, wxConvUTF8))
+		wxLogError(__("Could not write the file %s: Errcode=%d."), dlg.GetPath().c_str(), wxSysErrorCode());
+}
+
+
+void dlgQueryBenchmark::OnStart(wxCommandEvent &ev)
+{
+	Start();
+}
+
+
+void dlgQueryBenchmark::OnStop(wxCommandEvent &ev)
+{
+	// The thread reports once more when it has stopped
+	if (thread)
+		thread->Cancel();
+}
+
+
+void dlgQueryBenchmark::OnCompare(wxCommandEvent &ev)
+{
+	EnableControls();
+}
+
+
+void dlgQueryBenchmark::OnExport(wxCommandEvent &ev)
+{
+	Export();
+}
+
+
+void dlgQueryBenchmark::OnProgress(wxCommandEvent &ev)
+{
+	// Left over from a benchmark stopped before
+	if (!thread || ev.GetInt() != seq)
+		return;
+
+	gauge->SetValue(thread->GetRunsDone());
+	thread->GetResults(results);
+	ShowResults();
+
+	if (ev.GetExtraLong())
+	{
+		thread->Wait();
+		delete thread;
+		thread = NULL;
+		EnableControls();
+	}
+}
+
+
+void dlgQueryBenchmark::OnClose(wxCommandEvent &ev)
+{
+	Close();
+}
+
+
+void dlgQueryBenchmark::OnCloseWindow(wxCloseEvent &ev)
+{
+	Stop();
+
+	if (benchConn)
+	{
+		delete benchConn;
+		benchConn = NULL;
+	}
+
+	EndModal(wxID_CANCEL);
+}
@@ -0,0 +1,219 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// dlgQueryProfile.cpp - Client query profile
+//
+//////////////////////////////////////////////////////////////////////////
+
+// App headers
+#include "pgAdmin3.h"
+
+#include "utils/misc.h"
+#include "utils/sysSettings.h"
+#include "ctl/ctlListView.h"
+#include "dlg/dlgQueryProfile.h"
+#include "frm/frmMain.h"
+
+wxWindowID LST_PROFILE_ID = ::wxNewId();
+wxWindowID CHK_PROFILE_ENABLED_ID = ::wxNewId();
+wxWindowID BTN_PROFILE_RESET_ID = ::wxNewId();
+wxWindowID BTN_PROFILE_CSV_ID = ::wxNewId();
+wxWindowID BTN_PROFILE_JSON_ID = ::wxNewId();
+
+BEGIN_EVENT_TABLE(dlgQueryProfile, wxDialog)
+	EVT_LIST_ITEM_SELECTED(LST_PROFILE_ID,  dlgQueryProfile::OnSelect)
+	EVT_CHECKBOX(CHK_PROFILE_ENABLED_ID,    dlgQueryProfile::OnEnable)
+	EVT_BUTTON(wxID_REFRESH,                dlgQueryProfile::OnRefresh)
+	EVT_BUTTON(BTN_PROFILE_RESET_ID,        dlgQueryProfile::OnReset)
+	EVT_BUTTON(BTN_PROFILE_CSV_ID,          dlgQueryProfile::OnExportCSV)
+	EVT_BUTTON(BTN_PROFILE_JSON_ID,         dlgQueryProfile::OnExportJSON)
+	EVT_BUTTON(wxID_CANCEL,                 dlgQueryProfile::OnClose)
+END_EVENT_TABLE()
+
+
+dlgQueryProfile::dlgQueryProfile(wxWindow *parent) :
+	wxDialog(parent, -1, _("Client query profile"), wxDefaultPosition, wxDefaultSize, wxDEFAULT_DIALOG_STYLE | wxRESIZE_BORDER)
+{
+	wxBoxSizer *mainSizer = new wxBoxSizer(wxVERTICAL);
+
+	lstQueries = new ctlListView(this, LST_PROFILE_ID, wxDefaultPosition, wxDefaultSize, wxLC_REPORT | wxLC_SINGLE_SEL);
+	lstQueries->AddColumn(_("Caller"), 200);
+	lstQueries->AddColumn(_("Query"), 300);
+	lstQueries->AddColumn(_("Calls"), 60, wxLIST_FORMAT_RIGHT);
+	lstQueries->AddColumn(_("UI calls"), 60, wxLIST_FORMAT_RIGHT);
+	lstQueries->AddColumn(_("Rows"), 70, wxLIST_FORMAT_RIGHT);
+	lstQueries->AddColumn(_("Bytes"), 80, wxLIST_FORMAT_RIGHT);
+	lstQueries->AddColumn(_("Total ms"), 80, wxLIST_FORMAT_RIGHT);
+	lstQueries->AddColumn(_("Avg ms"), 70, wxLIST_FORMAT_RIGHT);
+	lstQueries->AddColumn(_("Max ms"), 70, wxLIST_FORMAT_RIGHT);
+	mainSizer->Add(lstQueries, 3, wxEXPAND | wxALL, 5);
+
+	lstHistogram = new ctlListView(this, -1, wxDefaultPosition, wxDefaultSize, wxLC_REPORT | wxLC_SINGLE_SEL);
+	lstHistogram->AddColumn(_("Latency"), 120);
+	lstHistogram->AddColumn(_("Calls"), 80, wxLIST_FORMAT_RIGHT);
+	lstHistogram->AddColumn(_("Distribution"), 300);
+	mainSizer->Add(lstHistogram, 2, wxEXPAND | wxLEFT | wxRIGHT, 5);
+
+	wxBoxSizer *bottomSizer = new wxBoxSizer(wxHORIZONTAL);
+
+	chkEnabled = new wxCheckBox(this, CHK_PROFILE_ENABLED_ID, _("Record queries"));
+	chkEnabled->SetValue(pgQueryStats::Get()->IsEnabled());
+	bottomSizer->Add(chkEnabled, 0, wxALIGN_CENTER_VERTICAL);
+
+	bottomSizer->AddStretchSpacer();
+
+	bottomSizer->Add(new wxButton(this, wxID_REFRESH, _("&Refresh")));
+	bottomSizer->Add(new wxButton(this, BTN_PROFILE_RESET_ID, _("R&eset")), 0, wxLEFT, 5);
+	bottomSizer->Add(new wxButton(this, BTN_PROFILE_CSV_ID, _("Export C&SV...")), 0, wxLEFT, 5);
+	bottomSizer->Add(new wxButton(this, BTN_PROFILE_JSON_ID, _("Export &JSON...")), 0, wxLEFT, 5);
+	bottomSizer->Add(new wxButton(this, wxID_CANCEL, _("&Close")), 0, wxLEFT, 10);
+
+	mainSizer->Add(bottomSizer, 0, wxALL | wxEXPAND, 5);
+	SetSizer(mainSizer);
+
+	SetSize(wxSize(900, 550));
+
+	Layout();
+	Centre();
+
+	Populate();
+}
+
+
+void dlgQueryProfile::Populate()
+{
+	pgQueryStats::Get()->GetEntries(entries);
+
+	lstQueries->DeleteAllItems();
+	lstHistogram->DeleteAllItems();
+
+	size_t i;
+	for (i = 0 ; i < entries.GetCount() ; i++)
+	{
+		pgQueryStatsEntry &entry = entries.Item(i);
+
+		// Long queries are cut short in the list; the export has them in full
+		wxString query = entry.fingerprint;
+		if (query.Length() > 200)
+			query = query.Left(200) + wxT("...");
+
+		long pos = lstQueries->InsertItem(i, entry.caller);
+		lstQueries->SetItem(pos, 1, query);
+		lstQueries->SetItem(pos, 2, NumToStr(entry.calls));
+		lstQueries->SetItem(pos, 3, NumToStr(entry.uiCalls));
+		lstQueries->SetItem(pos, 4, NumToStr(entry.rows));
+		lstQueries->SetItem(pos, 5, entry.bytes.ToString());
+		lstQueries->SetItem(pos, 6, entry.totalTime.ToString());
+		lstQueries->SetItem(pos, 7, NumToStr((entry.totalTime / entry.calls).ToLong()));
+		lstQueries->SetItem(pos, 8, NumToStr(entry.maxTime));
+	}
+
+	if (entries.GetCount())
+		lstQueries->Select(0);
+}
+
+
+void dlgQueryProfile::ShowHistogram(long item)
+{
+	lstHistogram->DeleteAllItems();
+
+	if (item < 0 || item >= (long)entries.GetCount())
+		return;
+
+	pgQueryStatsEntry &entry = entries.Item(item);
+
+	int bucket;
+	for (bucket = 0 ; bucket < PGQUERYSTATS_BUCKETS ; bucket++)
+	{
+		long calls = entry.histogram[bucket];
+		int width = (int)((calls * 50 + entry.calls - 1) / entry.calls);
+
+		lstHistogram->AppendItem(-1, pgQueryStats::GetBucketLabel(bucket), NumToStr(calls), wxString(wxT('#'), width));
+	}
+}
+
+
+void dlgQueryProfile::Export(bool json)
+{
+	wxString filter;
+	if (json)
+		filter = _("JSON files (*.json)|*.json|All files (*.*)|*.*");
+	else
+		filter = _("CSV files (*.csv)|*.csv|All files (*.*)|*.*");
+
+	wxFileDialog dlg(this, _("Export query profile"), wxEmptyString, json ? wxT("queryprofile.json") : wxT("queryprofile.csv"),
+	                 filter, wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+	if (dlg.ShowModal() != wxID_OK)
+		return;
+
+	bool done;
+	if (json)
+		done = pgQueryStats::Get()->ExportJSON(dlg.GetPath());
+	else
+		done = pgQueryStats::Get()->ExportCSV(dlg.GetPath());
+
+	if (!done)
+		wxLogError(__("Could not write the file %s: Errcode=%d."), dlg.GetPath().c_str(), wxSysErrorCode());
+}
+
+
+void dlgQueryProfile::OnSelect(wxListEvent &ev)
+{
+	ShowHistogram(ev.GetIndex());
+}
+
+
+void dlgQueryProfile::OnEnable(wxCommandEvent &ev)
+{
+	pgQueryStats::Get()->Enable(chkEnabled->GetValue());
+	settings->SetQueryStatsEnabled(chkEnabled->GetValue());
+}
+
+
+void dlgQueryProfile::OnRefresh(wxCommandEvent &ev)
+{
+	Populate();
+}
+
+
+void dlgQueryProfile::OnReset(wxCommandEvent &ev)
+{
+	pgQueryStats::Get()->Clear();
+	Populate();
+}
+
+
+void dlgQueryProfile::OnExportCSV(wxCommandEvent &ev)
+{
+	Export(false);
+}
+
+
+void dlgQueryProfile::OnExportJSON(wxCommandEvent &ev)
+{
+	Export(true);
+}
+
+
+void dlgQueryProfile::OnClose(wxCommandEvent &ev)
+{
+	Destroy();
+}
+
+
+queryProfileFactory::queryProfileFactory(menuFactoryList *list, wxMenu *mnu, ctlMenuToolbar *toolbar) : actionFactory(list)
+{
+	mnu->Append(id, _("Client query &profile..."), _("Show the timings of the queries sent by pgAdmin."));
+}
+
+
+wxWindow *queryProfileFactory::StartDialog(frmMain *form, pgObject *obj)
+{
+	dlgQueryProfile *dlg = new dlgQueryProfile(form);
+	dlg->Show();
+	return 0;
+}
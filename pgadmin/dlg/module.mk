@@ -35,6 +35,7 @@ pgadmin3_SOURCES += \
 	dlg/dlgIndex.cpp \
 	dlg/dlgIndexConstraint.cpp \
 	dlg/dlgLanguage.cpp \
+	dlg/dlgLoadTest.cpp \
 	dlg/dlgMainConfig.cpp \
 	dlg/dlgManageFavourites.cpp \
 	dlg/dlgMoveTablespace.cpp \
@@ -42,6 +43,8 @@ pgadmin3_SOURCES += \
 	dlg/dlgPackage.cpp \
 	dlg/dlgPgpassConfig.cpp \
 	dlg/dlgProperty.cpp \
+	dlg/dlgQueryBenchmark.cpp \
+	dlg/dlgQueryProfile.cpp \
 	dlg/dlgReassignDropOwned.cpp \
 	dlg/dlgRole.cpp \
 	dlg/dlgRule.cpp \
@@ -58,6 +58,7 @@ BEGIN_EVENT_TABLE(frmMain, pgFrame)
 	EVT_MENU(MNU_TOOLBAR,                   frmMain::OnToggleToolBar)
 	EVT_MENU(MNU_DEFAULTVIEW,               frmMain::OnDefaultView)
 	EVT_MENU(MNU_CHECKALIVE,                frmMain::OnCheckAlive)
+	EVT_TIMER(TIMER_CONNECT_ID,             frmMain::OnConnectTimer)
 	EVT_MENU(MNU_CONTEXTMENU,               frmMain::OnContextMenu)
 
 	EVT_AUINOTEBOOK_PAGE_CHANGED(wxID_ANY,	frmMain::OnPageChange)
@@ -622,7 +623,7 @@ void frmMain::OnSelActivated(wxTreeEvent &event)
 	if (data->IsCreatedBy(serverFactory))
 	{
 		server = (pgServer *)data;
-		if (!server->GetConnected())
+		if (!server->GetConnected() && !server->IsConnecting())
 		{
 			if (ReconnectServer(server) == PGCONN_OK)
 			{
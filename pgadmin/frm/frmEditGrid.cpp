@@ -19,6 +19,7 @@
 #include "frm/frmMain.h"
 #include "frm/menu.h"
 #include "db/pgQueryThread.h"
+#include "db/pgConnPool.h"
 
 #include <wx/generic/gridctrl.h>
 #include <wx/clipbrd.h>
@@ -1525,7 +1526,7 @@ frmEditGrid::~frmEditGrid()
 	manager.UnInit();
 
 	if (connection)
-		delete connection;
+		pgConnPool::Get()->Release(connection);
 }
 
 
@@ -3349,7 +3350,7 @@ wxWindow *editGridFactoryBase::ViewData(frmMain *form, pgObject *obj, bool filte
 	wxString applicationname = appearanceFactory->GetLongAppName() + _(" - Edit Grid");
 
 	pgServer *server = db->GetServer();
-	pgConn *conn = db->CreateConn(applicationname);
+	pgConn *conn = db->CreatePooledConn(applicationname);
 	if (conn)
 	{
 		wxString txt = _("Edit Data - ")
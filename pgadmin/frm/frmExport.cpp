@@ -13,11 +13,10 @@
 
 // App headers
 #include "pgAdmin3.h"
-#include <wx/file.h>
+#include <wx/progdlg.h>
 #include "frm/frmExport.h"
 #include "utils/sysSettings.h"
 #include "utils/misc.h"
-#include "ctl/ctlSQLResult.h"
 
 #define txtFilename     CTRL_TEXT("txtFilename")
 #define btnOK           CTRL_BUTTON("wxID_OK")
@@ -31,6 +30,12 @@
 #define chkColnames     CTRL_CHECKBOX("chkColnames")
 #define cbColSeparator  CTRL_COMBOBOX("cbColSeparator")
 #define cbQuoteChar     CTRL_COMBOBOX("cbQuoteChar")
+#define chkCompress     CTRL_CHECKBOX("chkCompress")
+
+// Interval at which the progress of an export is shown, and the time after
+// which it is shown at all (in ms)
+#define EXPORT_PROGRESS_INTERVAL    100
+#define EXPORT_PROGRESS_DELAY       500
 
 
 BEGIN_EVENT_TABLE(frmExport, pgDialog)
@@ -78,6 +83,7 @@ frmExport::frmExport(wxWindow *p)
 
 
 	cbQuoteChar->SetValue(settings->GetExportQuoteChar());
+	chkCompress->SetValue(settings->GetExportCompress());
 
 	wxString val;
 	settings->Read(wxT("Export/LastFile"), &val, wxEmptyString);
@@ -121,6 +127,7 @@ void frmExport::OnOK(wxCommandEvent &ev)
 		settings->SetExportQuoting(0);
 
 	settings->SetExportQuoteChar(cbQuoteChar->GetValue());
+	settings->SetExportCompress(chkCompress->GetValue());
 
 	settings->Write(wxT("Export/LastFile"), txtFilename->GetValue());
 
@@ -133,160 +140,58 @@ void frmExport::OnOK(wxCommandEvent &ev)
 
 
 
-bool frmExport::Export(pgSet *set)
+// The set is written by a pgExportThread, while the progress is shown here.
+// The dialog showing it is modal, so the set stays as it is meanwhile.
+bool frmExport::Export(pgSet *set, const long *rowOrder, long rowCount)
 {
-	ctlSQLResult *grid = 0;
-	if (!set)
-	{
-		wxLogInfo(wxT("Exporting data from the grid"));
-		grid = (ctlSQLResult *)parent;
-	}
-	else
-		wxLogInfo(wxT("Exporting data from a resultset"));
+	wxLogInfo(wxT("Exporting data from a resultset"));
 
-	wxFile file(txtFilename->GetValue(), wxFile::write);
-	if (!file.IsOpened())
+	pgExportOptions options = GetOptions();
+	pgExportThread *thread = new pgExportThread(set, options, rowOrder, rowCount);
+	if (thread->Create() != wxTHREAD_NO_ERROR || thread->Run() != wxTHREAD_NO_ERROR)
 	{
-		wxLogError(__("Failed to open file %s."), txtFilename->GetValue().c_str());
+		delete thread;
+		wxLogError(_("Could not start the export thread."));
 		return false;
 	}
 
-	wxString line;
-	long skipped = 0;
-	wxWX2MBbuf buf;
-
-	int colCount, rowCount;
+	long total = thread->GetEstimatedRows(), rows;
+	wxLongLong bytes;
+	wxStopWatch stopwatch;
+	wxProgressDialog *progress = NULL;
 
-	if (set)
-	{
-		colCount = set->NumCols();
-		rowCount = set->NumRows();
-	}
-	else
+	while (thread->IsRunning())
 	{
-		colCount = grid->GetNumberCols();
-		rowCount = grid->NumRows();
-	}
+		wxMilliSleep(EXPORT_PROGRESS_INTERVAL);
 
-	int col;
-	if (chkColnames->GetValue())
-	{
-		for (col = 0 ; col < colCount ; col++)
-		{
-			if (!col)
-				line = wxEmptyString;
-			else
-				line += cbColSeparator->GetValue();
-
-			if (rbQuoteStrings->GetValue() || rbQuoteAll->GetValue())
-			{
-				wxString qc = cbQuoteChar->GetValue();
-
-				wxString hdr;
-				if (set)
-					hdr = set->ColName(col);
-				else
-					hdr = grid->OnGetItemText(-1, col + 1).BeforeFirst('\n');
-
-				hdr.Replace(qc, qc + qc);
-				line += qc + hdr + qc;
-			}
-			else
-			{
-				if (set)
-					line += set->ColName(col);
-				else
-					line += grid->OnGetItemText(-1, col + 1).BeforeFirst('\n');
-			}
-		}
-		if (rbCRLF->GetValue())
-			line += wxT("\r\n");
-		else
-			line += wxT("\n");
-
-		if (rbUnicode->GetValue())
-			file.Write(line, wxConvUTF8);
-		else
-		{
-			buf = line.mb_str(wxConvLibc);
-			if (!buf)
-				skipped++;
-			else
-				file.Write(line, wxConvLibc);
-		}
-	}
+		// Small exports are done before it's worth showing the progress
+		if (stopwatch.Time() < EXPORT_PROGRESS_DELAY)
+			continue;
 
+		thread->GetProgress(rows, bytes);
+		wxString msg = wxString::Format(_("%ld of %ld rows written (%.1f MB)"), rows, total, bytes.ToDouble() / (1024 * 1024));
 
-	wxString text;
-	OID typOid;
+		if (!progress)
+			progress = new wxProgressDialog(_("Export data"), msg, total, parent,
+			                                wxPD_APP_MODAL | wxPD_CAN_ABORT | wxPD_AUTO_HIDE | wxPD_ELAPSED_TIME | wxPD_REMAINING_TIME);
 
-	int row;
-	for (row = 0 ; row < rowCount ; row++)
-	{
-		for (col = 0 ; col < colCount ; col++)
-		{
-			if (!col)
-				line = wxEmptyString;
-			else
-				line += cbColSeparator->GetValue();
-
-			bool needQuote = rbQuoteAll->GetValue();
-
-			if (set)
-			{
-				text = set->GetVal(col);
-				typOid = set->ColTypClass(col);
-			}
-			else
-			{
-				text = grid->OnGetItemText(row, col + 1);
-				typOid = grid->colTypClasses[col];
-			}
-
-			if (!needQuote && rbQuoteStrings->GetValue())
-			{
-				// find out if string
-				switch (typOid)
-				{
-					case PGTYPCLASS_NUMERIC:
-					case PGTYPCLASS_BOOL:
-						break;
-					default:
-						needQuote = true;
-						break;
-				}
-			}
-			if (needQuote)
-			{
-				wxString qc = cbQuoteChar->GetValue();
-				text.Replace(qc, qc + qc);
-				line += qc + text + qc;
-			}
-			else
-				line += text;
-		}
-		if (rbCRLF->GetValue())
-			line += wxT("\r\n");
-		else
-			line += wxT("\n");
-
-		if (rbUnicode->GetValue())
-			file.Write(line, wxConvUTF8);
-		else
-		{
-			buf = line.mb_str(wxConvLibc);
-			if (!buf)
-				skipped++;
-			else
-				file.Write(line, wxConvLibc);
-		}
-
-		if (set)
-			set->MoveNext();
+		// Reaching the maximum would close the dialog before the thread
+		if (!progress->Update(wxMin(rows, total - 1), msg))
+			thread->Cancel();
 	}
-	file.Close();
+	thread->Wait();
 
-	if (skipped)
+	if (progress)
+		delete progress;
+
+	bool done = thread->Succeeded();
+	long skipped = thread->GetSkipped();
+
+	if (thread->Cancelled())
+		wxMessageBox(_("Data export cancelled."), _("Export data"), wxICON_INFORMATION | wxOK);
+	else if (!done)
+		wxLogError(wxT("%s"), thread->GetError().c_str());
+	else if (skipped)
 		wxLogError(wxPLURAL(
 		               "Data export incomplete.\n\n%d row contained characters that could not be converted to the local charset.\n\nPlease correct the data or try using UTF8 instead.",
 		               "Data export incomplete.\n\n%d rows contained characters that could not be converted to the local charset.\n\nPlease correct the data or try using UTF8 instead.",
@@ -294,7 +199,33 @@ bool frmExport::Export(pgSet *set)
 	else
 		wxMessageBox(_("Data export completed successfully."), _("Export data"), wxICON_INFORMATION | wxOK);
 
-	return true;
+	delete thread;
+	return done;
+}
+
+
+pgExportOptions frmExport::GetOptions()
+{
+	pgExportOptions options;
+
+	options.filename = txtFilename->GetValue();
+	options.colSeparator = cbColSeparator->GetValue();
+	options.quoteChar = cbQuoteChar->GetValue();
+	options.rowSeparator = rbCRLF->GetValue() ? wxT("\r\n") : wxT("\n");
+	if (rbQuoteAll->GetValue())
+		options.quoting = 2;
+	else if (rbQuoteStrings->GetValue())
+		options.quoting = 1;
+	else
+		options.quoting = 0;
+	options.unicode = rbUnicode->GetValue();
+	options.colNames = chkColnames->GetValue();
+	options.compress = chkCompress->GetValue();
+
+	if (options.compress && !options.filename.Lower().EndsWith(wxT(".gz")))
+		options.filename += wxT(".gz");
+
+	return options;
 }
 
 
@@ -73,6 +73,9 @@
 #include "dlg/dlgServer.h"
 #include "dlg/dlgDatabase.h"
 #include "dlg/dlgSearchObject.h"
+#include "dlg/dlgQueryProfile.h"
+#include "db/pgQueryStats.h"
+#include "db/pgCatalogCache.h"
 #include "schema/pgTable.h"
 #include "schema/pgView.h"
 #include "schema/pgFunction.h"
@@ -108,6 +111,7 @@ frmMain::frmMain(const wxString &title)
 	lastPluginUtility = NULL;
 	pluginUtilityCount = 0;
 	m_refreshing = false;
+	connectTimer.SetOwner(this, TIMER_CONNECT_ID);
 
 	dlgName = wxT("frmMain");
 	SetMinSize(wxSize(600, 450));
@@ -244,6 +248,8 @@ frmMain::frmMain(const wxString &title)
 
 frmMain::~frmMain()
 {
+	connectTimer.Stop();
+
 	// Store the servers, to ensure we store the last database/schema etc
 	StoreServers();
 
@@ -370,8 +376,10 @@ void frmMain::CreateMenus()
 	//--------------------------
 
 	new connectServerFactory(menuFactories, toolsMenu, 0);
+	new connectAllServersFactory(menuFactories, toolsMenu, 0);
 	new disconnectServerFactory(menuFactories, toolsMenu, 0);
 	new disconnectDatabaseFactory(menuFactories, toolsMenu, 0);
+	new queryProfileFactory(menuFactories, toolsMenu, 0);
 
 	new startServiceFactory(menuFactories, toolsMenu, 0);
 	new stopServiceFactory(menuFactories, toolsMenu, 0);
@@ -591,6 +599,14 @@ void frmMain::Refresh(pgObject *data)
 		// refresh information about the object
 		data->SetDirty();
 
+		// and the names the query tools complete from
+		wxString schemaName;
+		if (data->GetMetaType() == PGM_SCHEMA && !data->IsCollection())
+			schemaName = data->GetName();
+		else if (data->GetSchema())
+			schemaName = data->GetSchema()->GetName();
+		pgCatalogCache::Invalidate(data->GetConnection(), schemaName);
+
 		pgObject *newData = data->Refresh(browser, currentItem);
 		done = !data->GetConnection() || data->GetConnection()->GetStatus() == PGCONN_OK;
 
@@ -786,6 +802,7 @@ void frmMain::ShowObjStatistics(pgObject *data, wxWindow *ctrl)
 
 	if ((!ctrl && statistics->IsShownOnScreen()) || ctrl == statistics)
 	{
+		pgQueryStatsCaller caller(data->GetTypeName() + wxT(" statistics"));
 		statistics->Freeze();
 		data->ShowStatistics(this, statistics);
 		statistics->Thaw();
@@ -793,6 +810,7 @@ void frmMain::ShowObjStatistics(pgObject *data, wxWindow *ctrl)
 
 	if ((!ctrl && dependencies->IsShownOnScreen()) || ctrl == dependencies)
 	{
+		pgQueryStatsCaller caller(data->GetTypeName() + wxT(" dependencies"));
 		dependencies->Freeze();
 		data->ShowDependencies(this, dependencies);
 		dependencies->Thaw();
@@ -800,6 +818,7 @@ void frmMain::ShowObjStatistics(pgObject *data, wxWindow *ctrl)
 
 	if ((!ctrl && dependents->IsShownOnScreen()) || ctrl == dependents)
 	{
+		pgQueryStatsCaller caller(data->GetTypeName() + wxT(" dependents"));
 		dependents->Freeze();
 		data->ShowDependents(this, dependents);
 		dependents->Thaw();
@@ -1136,6 +1155,144 @@ int frmMain::ReconnectServer(pgServer *server, bool restore)
 }
 
 
+// Start connecting a server without waiting for it; the connection is made
+// by a thread of the server, and finished by OnConnectTimer() once that is
+// done, so that any number of servers connect in parallel while the browser
+// remains usable.
+bool frmMain::StartConnectServer(pgServer *server)
+{
+	if (server->GetConnected() || server->IsConnecting())
+		return false;
+
+	int res = server->StartConnect(this, true, wxEmptyString, false, true, true);
+	switch (res)
+	{
+		case PGCONN_CONNECTING:
+			connectingServers.Add(server);
+			connectStarted.Add(wxGetLocalTime());
+			ShowConnectProgress();
+
+			if (!connectTimer.IsRunning())
+				connectTimer.Start(50);
+			return true;
+
+		case PGCONN_BAD:
+			wxLogError(__("Error connecting to the server %s: %s"),
+			           server->GetDescription().c_str(), server->GetLastError().c_str());
+			break;
+
+		default:
+			wxLogInfo(wxT("pgServer object didn't initialise because the user aborted."));
+			break;
+	}
+
+	server->Disconnect(this);
+	return false;
+}
+
+
+// A server going away while it connects must no longer be polled
+void frmMain::ForgetConnectingServer(pgServer *server)
+{
+	int index = connectingServers.Index(server);
+	if (index == wxNOT_FOUND)
+		return;
+
+	connectingServers.RemoveAt(index);
+	connectStarted.RemoveAt(index);
+}
+
+
+void frmMain::ConnectAllServers()
+{
+	wxTreeItemIdValue groupcookie, servercookie;
+	wxTreeItemId groupitem, serveritem;
+
+	groupitem = browser->GetFirstChild(browser->GetRootItem(), groupcookie);
+	while (groupitem)
+	{
+		serveritem = browser->GetFirstChild(groupitem, servercookie);
+		while (serveritem)
+		{
+			pgObject *object = browser->GetObject(serveritem);
+			if (object && object->IsCreatedBy(serverFactory))
+				StartConnectServer((pgServer *)object);
+
+			serveritem = browser->GetNextChild(groupitem, servercookie);
+		}
+		groupitem = browser->GetNextChild(browser->GetRootItem(), groupcookie);
+	}
+}
+
+
+void frmMain::OnConnectTimer(wxTimerEvent &event)
+{
+	size_t i = connectingServers.GetCount();
+	while (i-- > 0)
+	{
+		pgServer *server = connectingServers.Item(i);
+
+		// Disconnecting the server cancels the connect
+		if (!server->IsConnecting())
+		{
+			browser->SetItemText(server->GetId(), server->GetFullName());
+			connectingServers.RemoveAt(i);
+			connectStarted.RemoveAt(i);
+			continue;
+		}
+
+		if (!server->IsConnectDone())
+			continue;
+
+		int res = server->EndConnect(this);
+
+		connectingServers.RemoveAt(i);
+		connectStarted.RemoveAt(i);
+		browser->SetItemText(server->GetId(), server->GetFullName());
+
+		if (res == PGCONN_OK)
+		{
+			wxLogInfo(wxT("pgServer object initialised as required."));
+			server->ShowTreeDetail(browser);
+		}
+		else
+		{
+			wxLogError(__("Error connecting to the server %s: %s"),
+			           server->GetDescription().c_str(), server->GetLastError().c_str());
+			server->Disconnect(this);
+		}
+	}
+
+	if (connectingServers.IsEmpty())
+		connectTimer.Stop();
+
+	ShowConnectProgress();
+}
+
+
+void frmMain::ShowConnectProgress()
+{
+	long now = wxGetLocalTime();
+	size_t i;
+
+	for (i = 0 ; i < connectingServers.GetCount() ; i++)
+	{
+		pgServer *server = connectingServers.Item(i);
+		wxString label = server->GetFullName() + wxT(" - ")
+		                 + wxString::Format(_("connecting (%lds)"), now - connectStarted.Item(i));
+
+		if (browser->GetItemText(server->GetId()) != label)
+			browser->SetItemText(server->GetId(), label);
+	}
+
+	if (connectingServers.IsEmpty())
+		SetStatusText(_("Ready."));
+	else
+		SetStatusText(wxString::Format(wxPLURAL("Connecting to %d server...", "Connecting to %d servers...", connectingServers.GetCount()),
+		                               (int)connectingServers.GetCount()));
+}
+
+
 bool frmMain::reportError(const wxString &error, const wxString &msgToIdentify, const wxString &hint)
 {
 	bool identified = false;
@@ -93,6 +93,8 @@
 #define chkAutoCommit               CTRL_CHECKBOX("chkAutoCommit")
 #define chkDoubleClickProperties    CTRL_CHECKBOX("chkDoubleClickProperties")
 #define chkShowNotices			    CTRL_CHECKBOX("chkShowNotices")
+#define chkPrepareCatalogQueries    CTRL_CHECKBOX("chkPrepareCatalogQueries")
+#define chkBinaryCatalogResults     CTRL_CHECKBOX("chkBinaryCatalogResults")
 #define cbLanguage                  CTRL_COMBOBOX("cbLanguage")
 #define pickerSqlFont               CTRL_FONTPICKER("pickerSqlFont")
 #define chkSuppressHints            CTRL_CHECKBOX("chkSuppressHints")
@@ -157,6 +159,7 @@ BEGIN_EVENT_TABLE(frmOptions, pgDialog)
 	EVT_CHECKBOX(XRCID("chkResetHints"),                          frmOptions::OnResetHints)
 	EVT_CHECKBOX(XRCID("chkSQLUseSystemBackgroundColour"),        frmOptions::OnChangeSQLUseCustomColour)
 	EVT_CHECKBOX(XRCID("chkSQLUseSystemForegroundColour"),        frmOptions::OnChangeSQLUseCustomColour)
+	EVT_CHECKBOX(XRCID("chkPrepareCatalogQueries"),               frmOptions::OnChangePrepareCatalogQueries)
 	EVT_BUTTON (wxID_OK,                                          frmOptions::OnOK)
 	EVT_BUTTON (wxID_HELP,                                        frmOptions::OnHelp)
 	EVT_BUTTON (wxID_CANCEL,                                      frmOptions::OnCancel)
@@ -311,6 +314,10 @@ frmOptions::frmOptions(frmMain *parent)
 	txtDecimalMark->SetValue(settings->GetDecimalMark());
 	chkColumnNames->SetValue(settings->GetColumnNames());
 	chkShowNotices->SetValue(settings->GetShowNotices());
+	chkPrepareCatalogQueries->SetValue(settings->GetPrepareCatalogQueries());
+	chkBinaryCatalogResults->SetValue(settings->GetBinaryCatalogResults());
+	// Only the results of prepared statements are fetched in binary
+	chkBinaryCatalogResults->Enable(chkPrepareCatalogQueries->GetValue());
 
 	txtPgHelpPath->SetValue(settings->GetPgHelpPath());
 	txtEdbHelpPath->SetValue(settings->GetEdbHelpPath());
@@ -539,6 +546,11 @@ void frmOptions::OnChangeSQLUseCustomColour(wxCommandEvent &ev)
 	UpdateColourControls();
 }
 
+void frmOptions::OnChangePrepareCatalogQueries(wxCommandEvent &ev)
+{
+	chkBinaryCatalogResults->Enable(chkPrepareCatalogQueries->GetValue());
+}
+
 void frmOptions::OnOK(wxCommandEvent &ev)
 {
 	// Check the PostgreSQL and EnterpriseDB paths
@@ -678,6 +690,8 @@ void frmOptions::OnOK(wxCommandEvent &ev)
 	settings->SetAutoCommit(chkAutoCommit->GetValue());
 	settings->SetDoubleClickProperties(chkDoubleClickProperties->GetValue());
 	settings->SetShowNotices(chkShowNotices->GetValue());
+	settings->SetPrepareCatalogQueries(chkPrepareCatalogQueries->GetValue());
+	settings->SetBinaryCatalogResults(chkBinaryCatalogResults->GetValue());
 
 	settings->SetUnicodeFile(chkUnicodeFile->GetValue());
 	settings->SetWriteBOM(chkWriteBOM->GetValue());
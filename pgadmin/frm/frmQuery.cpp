@@ -32,13 +32,20 @@
 #include "frm/menu.h"
 #include "ctl/explainCanvas.h"
 #include "db/pgConn.h"
+#include "db/pgConnPool.h"
+#include "db/pgCatalogCache.h"
+#include "db/pgFileExecThread.h"
+#include "utils/sqlLexer.h"
 
 #include "ctl/ctlMenuToolbar.h"
 #include "ctl/ctlSQLResult.h"
+#include "ctl/ctlStatementTimings.h"
 #include "dlg/dlgSelectConnection.h"
 #include "dlg/dlgAddFavourite.h"
 #include "dlg/dlgManageFavourites.h"
 #include "dlg/dlgManageMacros.h"
+#include "dlg/dlgQueryBenchmark.h"
+#include "dlg/dlgLoadTest.h"
 #include "frm/frmReport.h"
 #include "gqb/gqbViewController.h"
 #include "gqb/gqbModel.h"
@@ -56,6 +63,7 @@
 #include "utils/sysSettings.h"
 #include "utils/utffile.h"
 #include "utils/misc.h"
+#include "utils/queryHistory.h"
 #include "pgscript/pgsApplication.h"
 
 // Icons
@@ -86,10 +94,6 @@
 #define CTRLID_DATABASELABEL    4201
 #define CTL_SQLQUERYBOOK        4202
 
-#define XML_FROM_WXSTRING(s) ((const xmlChar *)(const char *)s.mb_str(wxConvUTF8))
-#define WXSTRING_FROM_XML(s) wxString((char *)s, wxConvUTF8)
-#define XML_STR(s) ((const xmlChar *)s)
-
 // Initialize execution 'mutex'. As this will always run in the
 // main thread, there aren't any real concurrency issues, so
 // a simple flag will suffice.
@@ -101,6 +105,10 @@ BEGIN_EVENT_TABLE(frmQuery, pgFrame)
 	EVT_SIZE(                       frmQuery::OnSize)
 	EVT_COMBOBOX(CTRLID_CONNECTION, frmQuery::OnChangeConnection)
 	EVT_COMBOBOX(CTL_SQLQUERYCBOX,  frmQuery::OnChangeQuery)
+#if wxCHECK_VERSION(2, 9, 0)
+	EVT_COMBOBOX_DROPDOWN(CTL_SQLQUERYCBOX, frmQuery::OnDropDownQueries)
+#endif
+	EVT_TEXT(CTL_HISTORYFILTER,     frmQuery::OnHistoryFilter)
 	EVT_CLOSE(                      frmQuery::OnClose)
 	EVT_SET_FOCUS(                  frmQuery::OnSetFocus)
 	EVT_MENU(MNU_NEW,               frmQuery::OnNew)
@@ -120,15 +128,23 @@ BEGIN_EVENT_TABLE(frmQuery, pgFrame)
 	EVT_MENU(MNU_UNDO,              frmQuery::OnUndo)
 	EVT_MENU(MNU_REDO,              frmQuery::OnRedo)
 	EVT_MENU(MNU_EXECUTE,           frmQuery::OnExecute)
+	EVT_MENU(MNU_EXECSTATEMENT,     frmQuery::OnExecuteStatement)
 	EVT_MENU(MNU_EXECPGS,           frmQuery::OnExecScript)
 	EVT_MENU(MNU_EXECFILE,          frmQuery::OnExecFile)
 	EVT_MENU(MNU_EXPLAIN,           frmQuery::OnExplain)
 	EVT_MENU(MNU_EXPLAINANALYZE,    frmQuery::OnExplain)
+	EVT_MENU(MNU_BENCHMARK,         frmQuery::OnBenchmark)
+	EVT_MENU(MNU_LOADTEST,          frmQuery::OnLoadTest)
+#ifdef __WXDEBUG__
+	EVT_MENU(MNU_TIMERESULTGRID,    frmQuery::OnTimeResultGrid)
+#endif
+	EVT_MENU(MNU_EXECSQLFILE,       frmQuery::OnExecSqlFile)
 	EVT_MENU(MNU_DOCOMMIT,          frmQuery::OnCommit)
 	EVT_MENU(MNU_DOROLLBACK,        frmQuery::OnRollback)
 	EVT_MENU(MNU_CANCEL,            frmQuery::OnCancel)
 	EVT_MENU(MNU_AUTOROLLBACK,      frmQuery::OnAutoRollback)
 	EVT_MENU(MNU_AUTOCOMMIT,        frmQuery::OnAutoCommit)
+	EVT_MENU(MNU_TIMESTATEMENTS,    frmQuery::OnTimeStatements)
 	EVT_MENU(MNU_CONTENTS,          frmQuery::OnContents)
 	EVT_MENU(MNU_HELP,              frmQuery::OnHelp)
 	EVT_MENU(MNU_CLEARHISTORY,      frmQuery::OnClearHistory)
@@ -170,7 +186,12 @@ BEGIN_EVENT_TABLE(frmQuery, pgFrame)
 	EVT_TIMER(CTL_TIMERFRM,         frmQuery::OnTimer)
 // These fire when the queries complete
 	EVT_PGQUERYRESULT(QUERY_COMPLETE, frmQuery::OnQueryComplete)
+	EVT_PGQUERYROWS(QUERY_COMPLETE, frmQuery::OnQueryRows)
 	EVT_MENU(PGSCRIPT_COMPLETE,     frmQuery::OnScriptComplete)
+	EVT_MENU(EXPORT_COMPLETE,       frmQuery::OnExportComplete)
+	EVT_MENU(FILEEXEC_COMPLETE,     frmQuery::OnFileExecComplete)
+	EVT_MENU(FILTER_COMPLETE,       frmQuery::OnFilterComplete)
+	EVT_TEXT(CTL_RESULTFILTER,      frmQuery::OnFilterText)
 	EVT_AUINOTEBOOK_PAGE_CHANGED(CTL_NTBKCENTER, frmQuery::OnChangeNotebook)
 	EVT_AUINOTEBOOK_PAGE_CHANGED(CTL_SQLQUERYBOOK, frmQuery::OnSqlBookPageChanged)
 	EVT_AUINOTEBOOK_PAGE_CHANGING(CTL_SQLQUERYBOOK, frmQuery::OnSqlBookPageChanging)
@@ -246,6 +267,10 @@ frmQuery::frmQuery(frmMain *form, const wxString &_title, pgConn *_conn, const w
 	RestorePosition(100, 100, 600, 500, 450, 300);
 
 	explainCanvas = NULL;
+	exportThread = NULL;
+	fileExecThread = NULL;
+	fileExecOffset = 0;
+	fileExecLine = 1;
 
 	// notify wxAUI which frame to use
 	manager.SetManagedWindow(this);
@@ -317,10 +342,17 @@ frmQuery::frmQuery(frmMain *form, const wxString &_title, pgConn *_conn, const w
 
 	queryMenu = new wxMenu();
 	queryMenu->Append(MNU_EXECUTE, _("&Execute\tF5"), _("Execute query"));
+	queryMenu->Append(MNU_EXECSTATEMENT, _("Execute &current statement\tCtrl-F5"), _("Execute the statement at the cursor"));
 	queryMenu->Append(MNU_EXECPGS, _("Execute &pgScript\tF6"), _("Execute pgScript"));
 	queryMenu->Append(MNU_EXECFILE, _("Execute to file\tF8"), _("Execute query, write result to file"));
 	queryMenu->Append(MNU_EXPLAIN, _("E&xplain\tF7"), _("Explain query"));
 	queryMenu->Append(MNU_EXPLAINANALYZE, _("Explain analyze\tShift-F7"), _("Explain and analyze query"));
+	queryMenu->Append(MNU_BENCHMARK, _("&Benchmark..."), _("Run the query repeatedly and time it"));
+	queryMenu->Append(MNU_LOADTEST, _("Run with N &clients..."), _("Run the query with a number of concurrent clients"));
+	queryMenu->Append(MNU_EXECSQLFILE, _("Execute S&QL file..."), _("Execute the statements of a file, without opening it"));
+#ifdef __WXDEBUG__
+	queryMenu->Append(MNU_TIMERESULTGRID, wxT("Time result grid"), wxT("Show a made up wide result, and time sizing its columns and scrolling through it"));
+#endif
 
 
 	wxMenu *eo = new wxMenu();
@@ -335,6 +367,7 @@ frmQuery::frmQuery(frmMain *form, const wxString &_title, pgConn *_conn, const w
 	queryMenu->AppendSeparator();
 	queryMenu->Append(MNU_AUTOROLLBACK, _("&Auto-Rollback"), _("Rollback the current transaction if an error is detected"), wxITEM_CHECK);
 	queryMenu->Append(MNU_AUTOCOMMIT, _("&Auto-Commit"), _("Auto commit the cuurent transaction"), wxITEM_CHECK);
+	queryMenu->Append(MNU_TIMESTATEMENTS, _("&Time each statement"), _("Run the statements of a query one at a time, and show how long each took"), wxITEM_CHECK);
 	queryMenu->AppendSeparator();
 	queryMenu->Append(MNU_CANCEL, _("&Cancel\tAlt-Break"), _("Cancel query"));
 	queryMenu->AppendSeparator();
@@ -397,7 +430,7 @@ frmQuery::frmQuery(frmMain *form, const wxString &_title, pgConn *_conn, const w
 
 	UpdateRecentFiles();
 
-	wxAcceleratorEntry entries[16];
+	wxAcceleratorEntry entries[17];
 
 	entries[0].Set(wxACCEL_CTRL,                (int)'E',      MNU_EXECUTE);
 	entries[1].Set(wxACCEL_CTRL,                (int)'O',      MNU_OPEN);
@@ -415,8 +448,9 @@ frmQuery::frmQuery(frmMain *form, const wxString &_title, pgConn *_conn, const w
 	entries[13].Set(wxACCEL_NORMAL,             WXK_F6,        MNU_EXECPGS);
 	entries[14].Set(wxACCEL_NORMAL,             WXK_F8,        MNU_EXECFILE);
 	entries[15].Set(wxACCEL_CTRL,               (int)'T',      MNU_NEWSQLTAB);
+	entries[16].Set(wxACCEL_CTRL,               WXK_F5,        MNU_EXECSTATEMENT);
 
-	wxAcceleratorTable accel(16, entries);
+	wxAcceleratorTable accel(17, entries);
 	SetAcceleratorTable(accel);
 
 	queryMenu->Enable(MNU_CANCEL, false);
@@ -482,9 +516,16 @@ frmQuery::frmQuery(frmMain *form, const wxString &_title, pgConn *_conn, const w
 	wxStaticText *label = new wxStaticText(pnlQuery, 0, _("Previous queries"));
 	boxHistory->Add(label, 0, wxALL | wxALIGN_CENTER_VERTICAL, 1);
 
+	// Filter of the queries listed
+	txtHistoryFilter = new wxTextCtrl(pnlQuery, CTL_HISTORYFILTER, wxT(""), wxDefaultPosition, wxSize(150, -1));
+	txtHistoryFilter->SetToolTip(_("List only the previous queries containing this text; those starting with it come first"));
+	boxHistory->Add(txtHistoryFilter, 0, wxALL | wxALIGN_CENTER_VERTICAL, 1);
+
 	// Query combobox
 	sqlQueries = new wxComboBox(pnlQuery, CTL_SQLQUERYCBOX, wxT(""), wxDefaultPosition, wxDefaultSize, wxArrayString(), wxCB_DROPDOWN | wxCB_READONLY);
 	sqlQueries->SetToolTip(_("Previous queries"));
+	history = new queryHistory(settings->GetHistoryFile(), settings->GetHistoryMaxQueries());
+	historyListed = false;
 	LoadQueries();
 //ABDUL: 30 Aug 2021:BEGIN
 #if wxCHECK_VERSION(3, 1, 0)
@@ -500,7 +541,7 @@ frmQuery::frmQuery(frmMain *form, const wxString &_title, pgConn *_conn, const w
 
 	// Delete All button
 	btnDeleteAll = new wxButton(pnlQuery, CTL_DELETEALLBTN, _("Delete All"));
-	btnDeleteAll->Enable(sqlQueries->GetCount() > 0);
+	btnDeleteAll->Enable(history->GetCount() > 0);
 	boxHistory->Add(btnDeleteAll, 0, wxALL | wxALIGN_CENTER_VERTICAL, 1);
 
 	boxQuery->Add(boxHistory, 0, wxEXPAND | wxALL, 1);
@@ -526,12 +567,30 @@ frmQuery::frmQuery(frmMain *form, const wxString &_title, pgConn *_conn, const w
 
 	// Results pane
 	outputPane = new ctlAuiNotebook(this, CTL_NTBKGQB, wxDefaultPosition, wxSize(500, 300), wxAUI_NB_TOP | wxAUI_NB_TAB_SPLIT | wxAUI_NB_TAB_MOVE | wxAUI_NB_SCROLL_BUTTONS | wxAUI_NB_WINDOWLIST_BUTTON);
-	sqlResult = new ctlSQLResult(outputPane, conn, CTL_SQLRESULT, wxDefaultPosition, wxDefaultSize);
+
+	// The data output has a bar filtering the rows fetched above the grid
+	pnlResult = new wxPanel(outputPane);
+	wxBoxSizer *boxResult = new wxBoxSizer(wxVERTICAL);
+	wxBoxSizer *boxFilter = new wxBoxSizer(wxHORIZONTAL);
+	wxStaticText *lblFilter = new wxStaticText(pnlResult, wxID_ANY, _("Filter"));
+	boxFilter->Add(lblFilter, 0, wxALL | wxALIGN_CENTER_VERTICAL, 1);
+	txtFilter = new wxTextCtrl(pnlResult, CTL_RESULTFILTER, wxT(""));
+	txtFilter->SetToolTip(_("Show only the rows fetched containing this text, or matching a condition such as: column = 'value'"));
+	boxFilter->Add(txtFilter, 1, wxEXPAND | wxALL, 1);
+	stFilterRows = new wxStaticText(pnlResult, wxID_ANY, wxT(""));
+	boxFilter->Add(stFilterRows, 0, wxALL | wxALIGN_CENTER_VERTICAL, 1);
+	boxResult->Add(boxFilter, 0, wxEXPAND | wxALL, 1);
+
+	sqlResult = new ctlSQLResult(pnlResult, conn, CTL_SQLRESULT, wxDefaultPosition, wxDefaultSize);
+	boxResult->Add(sqlResult, 1, wxEXPAND);
+	pnlResult->SetSizer(boxResult);
+
 	explainCanvas = new ExplainCanvas(outputPane);
 	msgResult = new wxTextCtrl(outputPane, CTL_MSGRESULT, wxT(""), wxDefaultPosition, wxDefaultSize, wxTE_MULTILINE | wxTE_READONLY | wxTE_DONTWRAP);
 	msgResult->SetFont(settings->GetSQLFont());
 	msgHistory = new wxTextCtrl(outputPane, CTL_MSGHISTORY, wxT(""), wxDefaultPosition, wxDefaultSize, wxTE_MULTILINE | wxTE_READONLY | wxTE_DONTWRAP);
 	msgHistory->SetFont(settings->GetSQLFont());
+	statementTimings = new ctlStatementTimings(outputPane, CTL_STATEMENTTIMINGS);
 
 	// Graphical Canvas
 	// initialize values
@@ -546,10 +605,11 @@ frmQuery::frmQuery(frmMain *form, const wxString &_title, pgConn *_conn, const w
 	sqlNotebook->AddPage(controller->getViewContainer(), _("Graphical Query Builder"));
 	sqlNotebook->SetSelection(0);
 
-	outputPane->AddPage(sqlResult, _("Data Output"));
+	outputPane->AddPage(pnlResult, _("Data Output"));
 	outputPane->AddPage(explainCanvas, _("Explain"));
 	outputPane->AddPage(msgResult, _("Messages"));
 	outputPane->AddPage(msgHistory, _("History"));
+	outputPane->AddPage(statementTimings, _("Statement timings"));
 
 	sqlResult->Connect(wxID_ANY, wxEVT_SET_FOCUS, wxFocusEventHandler(frmQuery::OnFocus));
 	msgResult->Connect(wxID_ANY, wxEVT_SET_FOCUS, wxFocusEventHandler(frmQuery::OnFocus));
@@ -597,6 +657,9 @@ frmQuery::frmQuery(frmMain *form, const wxString &_title, pgConn *_conn, const w
 	bVal = settings->GetAutoCommit();
 	queryMenu->Check(MNU_AUTOCOMMIT, bVal);
 
+	// Statement timings
+	queryMenu->Check(MNU_TIMESTATEMENTS, settings->GetTimeStatements());
+
 	// Auto indent
 	settings->Read(wxT("frmQuery/AutoIndent"), &bVal, true);
 	editMenu->Check(MNU_AUTOINDENT, bVal);
@@ -691,10 +754,15 @@ frmQuery::~frmQuery()
 		delete adjustSizesTimer;
 		adjustSizesTimer = NULL;
 	}
+	if(history)
+	{
+		delete history;
+		history = NULL;
+	}
 
 	while (cbConnection->GetCount() > 1)
 	{
-		delete (pgConn *)cbConnection->GetClientData(0);
+		pgConnPool::Get()->Release((pgConn *)cbConnection->GetClientData(0));
 		cbConnection->Delete(0);
 	}
 
@@ -856,6 +924,13 @@ void frmQuery::OnAutoCommit(wxCommandEvent &event)
 	settings->WriteBool(wxT("frmQuery/AutoCommit"), queryMenu->IsChecked(MNU_AUTOCOMMIT));
 }
 
+void frmQuery::OnTimeStatements(wxCommandEvent &event)
+{
+	queryMenu->Check(MNU_TIMESTATEMENTS, event.IsChecked());
+
+	settings->SetTimeStatements(queryMenu->IsChecked(MNU_TIMESTATEMENTS));
+}
+
 void frmQuery::OnAutoIndent(wxCommandEvent &event)
 {
 	editMenu->Check(MNU_AUTOINDENT, event.IsChecked());
@@ -1320,6 +1395,10 @@ void frmQuery::OnCopy(wxCommandEvent &ev)
 		msgHistory->Copy();
 	else if (wnd == scratchPad)
 		scratchPad->Copy();
+	else if (wnd == txtFilter)
+		txtFilter->Copy();
+	else if (wnd == txtHistoryFilter)
+		txtHistoryFilter->Copy();
 	else
 	{
 		wxWindow *obj = wnd;
@@ -1344,6 +1423,10 @@ void frmQuery::OnPaste(wxCommandEvent &ev)
 		sqlQuery->Paste();
 	else if (currentControl() == scratchPad)
 		scratchPad->Paste();
+	else if (currentControl() == txtFilter)
+		txtFilter->Paste();
+	else if (currentControl() == txtHistoryFilter)
+		txtHistoryFilter->Paste();
 }
 
 
@@ -1382,6 +1465,10 @@ void frmQuery::OnSelectAll(wxCommandEvent &ev)
 		sqlResult->SelectAll();
 	else if (wnd == scratchPad)
 		scratchPad->SelectAll();
+	else if (wnd == txtFilter)
+		txtFilter->SelectAll();
+	else if (wnd == txtHistoryFilter)
+		txtHistoryFilter->SelectAll();
 	else if (wnd->GetParent() == sqlResult)
 		sqlResult->SelectAll();
 }
@@ -1713,6 +1800,22 @@ void frmQuery::OnClose(wxCloseEvent &event)
 		wxSleep(1);
 	}
 
+	if (exportThread)
+	{
+		exportThread->Cancel();
+		exportThread->Wait();
+		delete exportThread;
+		exportThread = NULL;
+	}
+
+	if (fileExecThread)
+	{
+		fileExecThread->Cancel();
+		fileExecThread->Wait();
+		delete fileExecThread;
+		fileExecThread = NULL;
+	}
+
 	if (m_loadingfile && event.CanVeto())
 	{
 		wxMessageBox(_("The query tool cannot be closed whilst a file is loading."), _("Warning"), wxICON_INFORMATION | wxOK);
@@ -2139,6 +2242,10 @@ void frmQuery::OnCancel(wxCommandEvent &event)
 
 	if (sqlResult->RunStatus() == CTLSQL_RUNNING)
 		sqlResult->Abort();
+	else if (exportThread)
+		exportThread->Cancel();
+	else if (fileExecThread)
+		fileExecThread->Cancel();
 	else if (pgScript->IsRunning())
 		pgScript->Terminate();
 
@@ -2150,6 +2257,144 @@ void frmQuery::OnCancel(wxCommandEvent &event)
 }
 
 
+void frmQuery::OnBenchmark(wxCommandEvent &event)
+{
+	if(sqlNotebook->GetSelection() == 1)
+	{
+		if (!updateFromGqb(true))
+			return;
+	}
+
+	wxString query = sqlQuery->GetSelectedText();
+	if (query.IsNull())
+		query = sqlQuery->GetText();
+
+	if (query.Strip(wxString::both).IsEmpty())
+		return;
+
+	dlgQueryBenchmark dlg(this, conn, query);
+	dlg.ShowModal();
+}
+
+
+void frmQuery::OnLoadTest(wxCommandEvent &event)
+{
+	if(sqlNotebook->GetSelection() == 1)
+	{
+		if (!updateFromGqb(true))
+			return;
+	}
+
+	wxString query = sqlQuery->GetSelectedText();
+	if (query.IsNull())
+		query = sqlQuery->GetText();
+
+	if (query.Strip(wxString::both).IsEmpty())
+		return;
+
+	dlgLoadTest dlg(this, conn, query);
+	dlg.ShowModal();
+}
+
+
+#ifdef __WXDEBUG__
+// Time sizing and scrolling the result grid over a wide result made up on
+// the client, so that the timings don't depend on the server or the network
+void frmQuery::OnTimeResultGrid(wxCommandEvent &event)
+{
+	const long rows = 10000;
+	const int cols = 300;
+	double msPerPage, msPerColumn;
+	long msSized, msMeasured;
+
+	wxBusyCursor wait;
+	outputPane->SetSelection(0);
+
+	sqlResult->DisplayTestData(rows, cols);
+	sqlResult->TimeColumnWidths(msSized, msMeasured);
+	showMessage(wxString::Format(wxT("Sizing %d columns by the first %d rows: %ld ms, measuring the cells with the device context: %ld ms"),
+	                             cols, (int)wxMin(rows, CTLSQLGRID_SIZE_ROWS), msSized, msMeasured));
+
+	sqlResult->TimeScrolling(msPerPage, msPerColumn);
+	showMessage(wxString::Format(wxT("Scrolling %ld rows of %d columns: %.2f ms per page down, %.2f ms per column across"),
+	                             rows, cols, msPerPage, msPerColumn));
+
+	// Once more, to tell the warming up of the first pass from the steady cost
+	sqlResult->TimeScrolling(msPerPage, msPerColumn);
+	showMessage(wxString::Format(wxT("Scrolling again: %.2f ms per page down, %.2f ms per column across"),
+	                             msPerPage, msPerColumn));
+}
+#endif
+
+
+// Run a file which may be too big to open, such as a dump, statement by
+// statement. After a failure, the next run may resume from the statement
+// which failed.
+void frmQuery::OnExecSqlFile(wxCommandEvent &event)
+{
+	if (fileExecOffset > 0 && wxFileExists(fileExecPath))
+	{
+		int answer = wxMessageBox(wxString::Format(_("The last execution of %s stopped at line %ld.\n\nResume from there?"),
+		                          fileExecPath.c_str(), fileExecLine),
+		                          _("Execute SQL file"), wxYES_NO | wxCANCEL | wxICON_QUESTION, this);
+		if (answer == wxCANCEL)
+			return;
+		if (answer == wxYES)
+		{
+			StartFileExec(fileExecPath, fileExecOffset, fileExecLine);
+			return;
+		}
+	}
+
+#ifdef __WXMSW__
+	wxFileDialog dlg(this, _("Execute SQL file"), lastDir, wxT(""),
+	                 _("Query files (*.sql)|*.sql|All files (*.*)|*.*"), wxFD_OPEN);
+#else
+	wxFileDialog dlg(this, _("Execute SQL file"), lastDir, wxT(""),
+	                 _("Query files (*.sql)|*.sql|All files (*)|*"), wxFD_OPEN);
+#endif
+
+	if (dlg.ShowModal() == wxID_OK)
+	{
+		lastDir = dlg.GetDirectory();
+		StartFileExec(dlg.GetPath(), 0, 1);
+	}
+}
+
+
+void frmQuery::StartFileExec(const wxString &path, wxFileOffset offset, long line)
+{
+	fileExecPath = path;
+
+	setTools(true);
+
+	SetStatusText(wxT(""), STATUSPOS_SECS);
+	SetStatusText(_("Executing file."), STATUSPOS_MSGS);
+	SetStatusText(wxT(""), STATUSPOS_ROWS);
+	msgResult->Clear();
+	msgResult->SetFont(settings->GetSQLFont());
+	outputPane->SetSelection(2);
+
+	if (offset > 0)
+		msgHistory->AppendText(wxString::Format(_("-- Executing file %s from line %ld\n"), path.c_str(), line));
+	else
+		msgHistory->AppendText(wxString::Format(_("-- Executing file %s\n"), path.c_str()));
+	Update();
+
+	startTimeQuery = wxGetLocalTimeMillis();
+	timer.Start(10);
+
+	fileExecThread = new pgFileExecThread(conn, path, settings->GetUnicodeFile(), offset, line, this, FILEEXEC_COMPLETE);
+	if (fileExecThread->Create() == wxTHREAD_NO_ERROR && fileExecThread->Run() == wxTHREAD_NO_ERROR)
+		return;
+
+	delete fileExecThread;
+	fileExecThread = NULL;
+	timer.Stop();
+	completeQuery(false, false, false);
+}
+
+
 void frmQuery::OnExplain(wxCommandEvent &event)
 {
 	if(sqlNotebook->GetSelection() == 1)
@@ -2198,6 +2443,11 @@ void frmQuery::OnExplain(wxCommandEvent &event)
 			sql += wxT("BUFFERS on");
 		else
 			sql += wxT("BUFFERS off");
+
+		// The graphical explain builds on the figures of the JSON format,
+		// which Greenplum's are shown in the text format for
+		if (!conn->GetIsGreenplum())
+			sql += wxT(", FORMAT JSON");
 		if (conn->BackendMinimumVersion(9, 2))
 		{
 			if (timing)
@@ -2330,6 +2580,26 @@ void frmQuery::OnExecute(wxCommandEvent &event)
 }
 
 
+void frmQuery::OnExecuteStatement(wxCommandEvent &event)
+{
+	if (sqlNotebook->GetSelection() == 1)
+	{
+		OnExecute(event);
+		return;
+	}
+
+	// The statement is selected, which shows what runs, and has errors
+	// found in it as they would be in any selection
+	int start, end;
+	if (!sqlQuery->GetStatementRange(sqlQuery->GetCurrentPos(), start, end))
+		return;
+
+	sqlQuery->SetSelection(start, end);
+	execQuery(sqlQuery->GetSelectedText());
+	sqlQuery->SetFocus();
+}
+
+
 void frmQuery::OnExecScript(wxCommandEvent &event)
 {
 	// Get the script
@@ -2472,15 +2742,23 @@ void frmQuery::setTools(const bool running)
 	toolBar->EnableTool(MNU_DOCOMMIT, canEndTransaction);
 	toolBar->EnableTool(MNU_DOROLLBACK, canEndTransaction);
 	queryMenu->Enable(MNU_EXECUTE, !running);
+	queryMenu->Enable(MNU_EXECSTATEMENT, !running);
 	queryMenu->Enable(MNU_EXECPGS, !running);
 	queryMenu->Enable(MNU_EXECFILE, !running);
 	queryMenu->Enable(MNU_EXPLAIN, !running);
 	queryMenu->Enable(MNU_EXPLAINANALYZE, !running);
+	queryMenu->Enable(MNU_BENCHMARK, !running);
+	queryMenu->Enable(MNU_LOADTEST, !running);
+#ifdef __WXDEBUG__
+	queryMenu->Enable(MNU_TIMERESULTGRID, !running);
+#endif
+	queryMenu->Enable(MNU_EXECSQLFILE, !running);
 	queryMenu->Enable(MNU_CANCEL, running);
 	queryMenu->Enable(MNU_DOCOMMIT, canEndTransaction);
 	queryMenu->Enable(MNU_DOROLLBACK, canEndTransaction);
 	fileMenu->Enable(MNU_EXPORT, sqlResult->CanExport());
 	fileMenu->Enable(MNU_QUICKREPORT, sqlResult->CanExport());
+	txtFilter->Enable(!running);
 	fileMenu->Enable(MNU_RECENT, (recentFileMenu->GetMenuItemCount() > 0));
 	sqlQuery->EnableAutoComp(running);
 }
@@ -2523,23 +2801,17 @@ void frmQuery::execQuery(const wxString &query, int resultToRetrieve, bool singl
 
 	aborted = false;
 
-	QueryExecInfo *qi = new QueryExecInfo();
-	qi->queryOffset = queryOffset;
-	qi->toFileExportForm = NULL;
-	qi->singleResult = singleResult;
-	qi->explain = explain;
-	qi->verbose = verbose;
-
+	pgExportOptions exportOptions;
 	if (toFile)
 	{
-		qi->toFileExportForm = new frmExport(this);
-		if (qi->toFileExportForm->ShowModal() != wxID_OK)
+		frmExport dlg(this);
+		if (dlg.ShowModal() != wxID_OK)
 		{
-			delete qi;
 			setTools(false);
 			aborted = true;
 			return;
 		}
+		exportOptions = dlg.GetOptions();
 	}
 
 	// Remember the tab from which execute was called. By the time query completes, SQL tab selection may change.
@@ -2556,6 +2828,7 @@ void frmQuery::execQuery(const wxString &query, int resultToRetrieve, bool singl
 	SetStatusText(wxT(""), STATUSPOS_ROWS);
 	msgResult->Clear();
 	msgResult->SetFont(settings->GetSQLFont());
+	statementTimings->ClearTimings();
 
 	msgHistory->AppendText(wxString::Format(_("-- Executing query [%s]:\n"), sqlQueryExec->GetTitle(false).c_str()));
 	msgHistory->AppendText(query);
@@ -2569,7 +2842,46 @@ void frmQuery::execQuery(const wxString &query, int resultToRetrieve, bool singl
 	if (!queryMenu->IsChecked(MNU_AUTOCOMMIT) && conn->GetTxStatus() == PQTRANS_IDLE && !isBeginNotRequired(query))
 		conn->ExecuteVoid(wxT("BEGIN;"));
 
-	if (sqlResult->Execute(query, resultToRetrieve, this, QUERY_COMPLETE, qi) >= 0)
+	if (toFile)
+	{
+		SetStatusText(_("Writing data."), STATUSPOS_MSGS);
+
+		// The rows go straight to the file, and never into the grid
+		exportThread = new pgExportThread(conn, query, exportOptions, this, EXPORT_COMPLETE);
+		if (exportThread->Create() == wxTHREAD_NO_ERROR && exportThread->Run() == wxTHREAD_NO_ERROR)
+			return;
+
+		delete exportThread;
+		exportThread = NULL;
+		timer.Stop();
+		completeQuery(false, false, false);
+		return;
+	}
+
+	QueryExecInfo *qi = new QueryExecInfo();
+	qi->queryOffset = queryOffset;
+	qi->singleResult = singleResult;
+	qi->explain = explain;
+	qi->verbose = verbose;
+
+	// Show the rows, while they are still arriving, unless these are to
+	// go anywhere else than into the grid
+	bool streamRows = !singleResult && !explain && settings->GetStreamResults();
+
+	// Run the statements one at a time, to time each; the server would
+	// only send the results of them all at the end, if sent together
+	wxArrayString statements;
+	wxArrayInt offsets;
+	if (queryMenu->IsChecked(MNU_TIMESTATEMENTS) && !singleResult && !explain)
+		statements = sqlLexer::Split(query, &offsets);
+	qi->timed = statements.GetCount() > 1;
+
+	// A filter of the previous result would hardly fit the new one
+	txtFilter->ChangeValue(wxEmptyString);
+	stFilterRows->SetLabel(wxEmptyString);
+
+	if (sqlResult->Execute(query, resultToRetrieve, this, QUERY_COMPLETE, qi, streamRows,
+	                       qi->timed ? &statements : NULL, &offsets) >= 0)
 	{
 		// Return and wait for the result
 		return;
@@ -2582,7 +2894,21 @@ bool frmQuery::isBeginNotRequired(wxString query)
 {
 	int	wordlen = 0;
 
-	query = query.Trim(false);
+	// Only the first statement matters, from after the comments before it;
+	// the rest of the query, which may be long, is left alone
+	wxCharBuffer buf = query.mb_str(wxConvUTF8);
+	const char *data = buf;
+	if (!data)
+		return false;
+
+	sqlLexer lexer;
+	bool end;
+	size_t used = lexer.Scan(data, strlen(data), end);
+	if (lexer.GetContentStart() < 0)
+		return false;
+
+	size_t start = lexer.GetContentStart();
+	query = wxString(data + start, wxConvUTF8, used - start);
 	size_t queryLen = query.Len();
 
 	/*
@@ -2762,6 +3088,18 @@ bool frmQuery::isBeginNotRequired(wxString query)
 }
 
 // When the query completes, it raises an event which we process here.
+// A batch of rows of the running query has arrived
+void frmQuery::OnQueryRows(pgQueryResultEvent &ev)
+{
+	long rows = sqlResult->AppendRows(ev);
+
+	if (rows && outputPane->GetSelection() != 0)
+		outputPane->SetSelection(0);
+
+	SetStatusText(wxString::Format(wxPLURAL("%ld row.", "%ld rows.", rows), rows), STATUSPOS_ROWS);
+}
+
+
 void frmQuery::OnQueryComplete(pgQueryResultEvent &ev)
 {
 	QueryExecInfo *qi = (QueryExecInfo *)ev.GetClientData();
@@ -2885,10 +3223,18 @@ void frmQuery::OnQueryComplete(pgQueryResultEvent &ev)
 			{
 				int selStart = sqlQueryExec->GetSelectionStart(), selEnd = sqlQueryExec->GetSelectionEnd();
 				if (selStart == selEnd)
+				{
 					selStart = 0;
+					selEnd = sqlQueryExec->GetLength();
+				}
 
 				errPos -= qi->queryOffset;        // do not count EXPLAIN or similar
 
+				// The server counts characters, and the editor bytes
+				wxString executed = sqlQueryExec->GetTextRange(selStart, selEnd);
+				if (errPos > 1 && (size_t)errPos <= executed.Length())
+					errPos = strlen(executed.Left(errPos - 1).mb_str(wxConvUTF8)) + 1;
+
 				// Set an indicator on the error word (break on any kind of bracket, a space or full stop)
 				int sPos = errPos + selStart - 1, wEnd = 1;
 //ABDUL: 30 Aug 2021:BEGIN
@@ -2898,7 +3244,7 @@ void frmQuery::OnQueryComplete(pgQueryResultEvent &ev)
 				sqlQueryExec->StartStyling(sPos, wxSTC_INDICS_MASK);
 #endif
 				int c = sqlQueryExec->GetCharAt(sPos + wEnd);
-				size_t len = sqlQueryExec->GetText().Length();
+				size_t len = sqlQueryExec->GetLength();
 				while(c != ' ' && c != '(' && c != '{' && c != '[' && c != '.' &&
 				        (unsigned int)(sPos + wEnd) < len)
 				{
@@ -2912,9 +3258,7 @@ void frmQuery::OnQueryComplete(pgQueryResultEvent &ev)
 				sqlQueryExec->SetStyling(wEnd, wxSTC_INDIC0_MASK);
 #endif
 
-				int line = 0, maxLine = sqlQueryExec->GetLineCount();
-				while (line < maxLine && sqlQueryExec->GetLineEndPosition(line) < errPos + selStart + 1)
-					line++;
+				int line = sqlQueryExec->LineFromPosition(sPos), maxLine = sqlQueryExec->GetLineCount();
 				if (line < maxLine)
 				{
 					sqlQueryExec->GotoPos(sPos);
@@ -2934,87 +3278,93 @@ void frmQuery::OnQueryComplete(pgQueryResultEvent &ev)
 		outputPane->SetSelection(0);
 		long rowsTotal = sqlResult->NumRows();
 
-		if (qi->toFileExportForm)
+		if (qi->singleResult)
 		{
-			SetStatusText(wxString::Format(wxPLURAL("%d row.", "%d rows.", rowsTotal), rowsTotal), STATUSPOS_ROWS);
-
-			if (rowsTotal)
-			{
-				SetStatusText(_("Writing data."), STATUSPOS_MSGS);
-
-				toolBar->EnableTool(MNU_CANCEL, false);
-				queryMenu->Enable(MNU_CANCEL, false);
-				SetCursor(*wxHOURGLASS_CURSOR);
+			sqlResult->DisplayData(true);
 
-				if (sqlResult->ToFile(qi->toFileExportForm))
-					SetStatusText(_("Data written to file."), STATUSPOS_MSGS);
-				else
-					SetStatusText(_("Data export aborted."), STATUSPOS_MSGS);
-				SetCursor(wxNullCursor);
-			}
-			else
-				SetStatusText(_("No data to export."), STATUSPOS_MSGS);
+			showMessage(wxString::Format(
+			                wxPLURAL("%ld row retrieved.", "%ld rows retrieved.",
+			                         sqlResult->NumRows()), sqlResult->NumRows()),
+			            _("OK."));
 		}
 		else
 		{
-			if (qi->singleResult)
-			{
-				sqlResult->DisplayData(true);
-
-				showMessage(wxString::Format(
-				                wxPLURAL("%ld row retrieved.", "%ld rows retrieved.",
-				                         sqlResult->NumRows()), sqlResult->NumRows()),
-				            _("OK."));
-			}
-			else
-			{
-				SetStatusText(
-				    wxString::Format(
-				        wxPLURAL(
-				            "Retrieving data: %d row.",
-				            "Retrieving data: %d rows.",
-				            (int)rowsTotal), (int)rowsTotal),
-				    STATUSPOS_MSGS);
-				wxTheApp->Yield(true);
+			SetStatusText(
+			    wxString::Format(
+			        wxPLURAL(
+			            "Retrieving data: %d row.",
+			            "Retrieving data: %d rows.",
+			            (int)rowsTotal), (int)rowsTotal),
+			    STATUSPOS_MSGS);
+			wxTheApp->Yield(true);
 
-				sqlResult->DisplayData();
+			sqlResult->DisplayData();
 
-				SetStatusText(
-				    ElapsedTimeToStr(elapsedQuery),
-				    STATUSPOS_SECS
-				);
+			SetStatusText(
+			    ElapsedTimeToStr(elapsedQuery),
+			    STATUSPOS_SECS
+			);
 
-				str = wxString::Format(
-				          _("Total query runtime: %s\n"),
-				          ElapsedTimeToStr(elapsedQuery).c_str()
-				      );
-				msgResult->AppendText(str);
-				msgHistory->AppendText(str);
+			str = wxString::Format(
+			          _("Total query runtime: %s\n"),
+			          ElapsedTimeToStr(elapsedQuery).c_str()
+			      );
+			msgResult->AppendText(str);
+			msgHistory->AppendText(str);
 
-				showMessage(
-				    wxString::Format(
-				        wxPLURAL(
-				            "%d row retrieved.",
-				            "%d rows retrieved.",
-				            (int)sqlResult->NumRows()
-				        ),
-				        (int)sqlResult->NumRows()
-				    ),
-				    _("OK.")
-				);
-			}
-			SetStatusText(
+			showMessage(
 			    wxString::Format(
 			        wxPLURAL(
-			            "%ld row.",
-			            "%ld rows.",
-			            rowsTotal
+			            "%d row retrieved.",
+			            "%d rows retrieved.",
+			            (int)sqlResult->NumRows()
 			        ),
-			        rowsTotal
+			        (int)sqlResult->NumRows()
 			    ),
-			    STATUSPOS_ROWS
+			    _("OK.")
 			);
 		}
+		SetStatusText(
+		    wxString::Format(
+		        wxPLURAL(
+		            "%ld row.",
+		            "%ld rows.",
+		            rowsTotal
+		        ),
+		        rowsTotal
+		    ),
+		    STATUSPOS_ROWS
+		);
+	}
+
+	// How long each statement took, of a query run a statement at a time
+	const pgStatementTimingArray *timings = qi->timed ? sqlResult->GetStatementTimings() : NULL;
+	if (timings && !timings->IsEmpty())
+	{
+		statementTimings->SetTimings(*timings);
+
+		int count = (int)timings->GetCount(), slowest = statementTimings->GetSlowest();
+		str = wxString::Format(wxPLURAL("%d statement run", "%d statements run", count), count) +
+		      wxString::Format(_(", the slowest being #%d in %.3f ms (see Statement timings).\n"),
+		                       slowest + 1, statementTimings->Item(slowest).elapsed);
+		msgResult->AppendText(str);
+		msgHistory->AppendText(str);
+
+		if (done && sqlResult->RunStatus() != PGRES_TUPLES_OK)
+			outputPane->SetSelection(outputPane->GetPageIndex(statementTimings));
+
+		// The statements before the one which failed have been run all the
+		// same
+		if (!done)
+		{
+			wxString run;
+			for (size_t i = 0 ; i < timings->GetCount() ; i++)
+			{
+				if (!timings->Item(i).failed)
+					run += timings->Item(i).statement + wxT(";\n");
+			}
+			CheckCatalogChanges(run);
+		}
 	}
 
 	if (sqlResult->RunStatus() == PGRES_TUPLES_OK || sqlResult->RunStatus() == PGRES_COMMAND_OK)
@@ -3024,54 +3374,59 @@ void frmQuery::OnQueryComplete(pgQueryResultEvent &ev)
 		if (executedQuery.IsNull())
 			executedQuery = sqlQueryExec->GetText();
 
-		// Same query, but without return feeds and carriage returns
-		wxString executedQueryWithoutReturns = executedQuery;
-		executedQueryWithoutReturns.Replace(wxT("\n"), wxT(" "));
-		executedQueryWithoutReturns.Replace(wxT("\r"), wxT(" "));
-		executedQueryWithoutReturns = executedQueryWithoutReturns.Trim();
-
 		if (executedQuery.Len() < (unsigned int)settings->GetHistoryMaxQuerySize())
 		{
-			// We put in the combo box the query without returns...
-			sqlQueries->Append(executedQueryWithoutReturns);
-
-			// .. but we save the query with returns in the array
-			// (so that we have the real query in the file)
-			histoQueries.Add(executedQuery);
+			long rows = sqlResult->RunStatus() == PGRES_TUPLES_OK ? sqlResult->NumRows() : sqlResult->InsertedCount();
+			wxString server = wxString::Format(wxT("%s:%d"), conn->GetHost().c_str(), conn->GetPort());
 
-			// Finally, we save the queries
-			SaveQueries();
+			// An earlier entry of the same query is dropped by the history
+			history->Add(executedQuery, elapsedQuery.ToLong(), rows, server, conn->GetDbname());
+			LoadQueries();
 		}
 
-		// Search a matching old query
-		unsigned int index = 0;
-		bool found = false;
-		while (!found && index < sqlQueries->GetCount())
-		{
-			found = sqlQueries->GetString(index) == executedQueryWithoutReturns;
-			if (!found)
-				index++;
-		}
+		CheckCatalogChanges(executedQuery);
+	}
+
+	completeQuery(done, qi->explain, qi->verbose);
+	delete qi;
+}
+
+
+// Have the names tab completion offers loaded again if the statements run
+// could have changed them, or the search path they are found through
+void frmQuery::CheckCatalogChanges(const wxString &query)
+{
+	wxCharBuffer buf = query.mb_str(wxConvUTF8);
+	const char *data = buf;
+	if (!data)
+		return;
+
+	bool changed = false, searchPath = false;
+	size_t len = strlen(data), start = 0;
+
+	sqlLexer lexer;
+	while (start < len)
+	{
+		bool end;
+		size_t used = lexer.Scan(data + start, len - start, end);
 
-		// If we found one, delete it from the combobox and the array
-		if (found && index < (unsigned int)sqlQueries->GetCount() - 1)
+		wxString word = lexer.GetFirstWord();
+		if (word == wxT("create") || word == wxT("alter") || word == wxT("drop") || word == wxT("import"))
+			changed = true;
+		else if (word == wxT("set") || word == wxT("reset"))
 		{
-			histoQueries.RemoveAt(index);
-			sqlQueries->Delete(index);
+			wxString statement(data + start, wxConvUTF8, used);
+			if (statement.Lower().Find(wxT("search_path")) >= 0)
+				searchPath = true;
 		}
-	}
 
-	// Make sure only the maximum query number is enforced
-	while (sqlQueries->GetCount() > (unsigned int)settings->GetHistoryMaxQueries())
-	{
-		histoQueries.RemoveAt(0);
-		sqlQueries->Delete(0);
+		start += used;
 	}
 
-	SaveQueries();
-
-	completeQuery(done, qi->explain, qi->verbose);
-	delete qi;
+	if (changed)
+		pgCatalogCache::Invalidate(conn);
+	if (searchPath)
+		SqlBookSetDatabase(conn);
 }
 
 
@@ -3108,9 +3463,7 @@ void frmQuery::OnScriptComplete(wxCommandEvent &ev)
 		int selStart = sqlQuery->GetSelectionStart(), selEnd = sqlQuery->GetSelectionEnd();
 		if (selStart == selEnd)
 			selStart = 0;
-		int line = 0, maxLine = sqlQuery->GetLineCount();
-		while (line < maxLine && sqlQuery->GetLineEndPosition(line) < selStart)
-			line++;
+		int line = sqlQuery->LineFromPosition(selStart);
 		line += pgScript->errorLine() - 1;
 
 		// Mark the line where the error occurred
@@ -3121,6 +3474,207 @@ void frmQuery::OnScriptComplete(wxCommandEvent &ev)
 	}
 }
 
+// The rows fetched are filtered in the grid, without running the query again
+void frmQuery::OnFilterText(wxCommandEvent &ev)
+{
+	sqlResult->SetFilter(txtFilter->GetValue());
+	UpdateFilterRows();
+}
+
+
+void frmQuery::OnFilterComplete(wxCommandEvent &ev)
+{
+	UpdateFilterRows();
+}
+
+
+void frmQuery::UpdateFilterRows()
+{
+	if (sqlResult->IsFiltered())
+		stFilterRows->SetLabel(wxString::Format(_("%d of %ld rows"), sqlResult->GetNumberRows(), sqlResult->NumRows()));
+	else
+		stFilterRows->SetLabel(wxEmptyString);
+
+	pnlResult->Layout();
+}
+
+
+// The rows of "Execute to file" have all been written (or not)
+void frmQuery::OnExportComplete(wxCommandEvent &ev)
+{
+	if (!exportThread)
+		return;
+
+	exportThread->Wait();
+	timer.Stop();
+
+	elapsedQuery = wxGetLocalTimeMillis() - startTimeQuery;
+	SetStatusText(ElapsedTimeToStr(elapsedQuery), STATUSPOS_SECS);
+
+	long rows;
+	wxLongLong bytes;
+	exportThread->GetProgress(rows, bytes);
+	SetStatusText(wxString::Format(wxPLURAL("%ld row.", "%ld rows.", rows), rows), STATUSPOS_ROWS);
+
+	bool done = exportThread->Succeeded();
+	if (done)
+	{
+		outputPane->SetSelection(2);
+		showMessage(wxString::Format(
+		                wxPLURAL("%ld row written to file in %s.", "%ld rows written to file in %s.", rows),
+		                rows, ElapsedTimeToStr(elapsedQuery).c_str()),
+		            _("Data written to file."));
+
+		long skipped = exportThread->GetSkipped();
+		if (skipped)
+			wxLogError(wxPLURAL(
+			               "Data export incomplete.\n\n%d row contained characters that could not be converted to the local charset.\n\nPlease correct the data or try using UTF8 instead.",
+			               "Data export incomplete.\n\n%d rows contained characters that could not be converted to the local charset.\n\nPlease correct the data or try using UTF8 instead.",
+			               skipped), skipped);
+	}
+	else
+	{
+		outputPane->SetSelection(2);
+		if (exportThread->Cancelled())
+			showMessage(_("Execution Cancelled!"));
+		else
+		{
+			showMessage(wxString::Format(wxT("********** %s **********\n"), _("Error")));
+			showMessage(exportThread->GetError());
+		}
+		SetStatusText(_("Data export aborted."), STATUSPOS_MSGS);
+	}
+
+	delete exportThread;
+	exportThread = NULL;
+
+	completeQuery(done, false, false);
+}
+
+
+// Rows and bytes written so far, and an estimate of the time left if the
+// planner could tell how many rows to expect
+void frmQuery::ShowExportProgress()
+{
+	long rows;
+	wxLongLong bytes;
+	exportThread->GetProgress(rows, bytes);
+
+	SetStatusText(wxString::Format(wxPLURAL("%ld row.", "%ld rows.", rows), rows), STATUSPOS_ROWS);
+
+	double seconds = elapsedQuery.ToDouble() / 1000.0;
+	double megabytes = bytes.ToDouble() / (1024.0 * 1024.0);
+	if (seconds <= 0)
+		return;
+
+	wxString msg = wxString::Format(_("Writing data: %.1f MB (%.1f MB/s)."), megabytes, megabytes / seconds);
+
+	long estimated = exportThread->GetEstimatedRows();
+	if (rows > 0 && estimated > rows)
+	{
+		wxLongLong left;
+		left.Assign(elapsedQuery.ToDouble() * (estimated - rows) / rows);
+		msg += wxT(" ") + wxString::Format(_("About %s left."), ElapsedTimeToStr(left).c_str());
+	}
+
+	SetStatusText(msg, STATUSPOS_MSGS);
+}
+
+
+// All statements of "Execute SQL file" have run, or one failed
+void frmQuery::OnFileExecComplete(wxCommandEvent &ev)
+{
+	if (!fileExecThread)
+		return;
+
+	fileExecThread->Wait();
+	timer.Stop();
+
+	elapsedQuery = wxGetLocalTimeMillis() - startTimeQuery;
+	SetStatusText(ElapsedTimeToStr(elapsedQuery), STATUSPOS_SECS);
+
+	wxString str = fileExecThread->GetMessagesAndClear();
+	if (!str.IsEmpty())
+	{
+		msgResult->AppendText(str);
+		msgHistory->AppendText(str);
+	}
+
+	wxFileOffset offset;
+	long statements;
+	fileExecThread->GetProgress(offset, statements);
+	SetStatusText(wxString::Format(wxPLURAL("%ld statement.", "%ld statements.", statements), statements), STATUSPOS_ROWS);
+
+	bool done = fileExecThread->Succeeded();
+	outputPane->SetSelection(2);
+	if (done)
+	{
+		fileExecOffset = 0;
+		fileExecLine = 1;
+		showMessage(wxString::Format(
+		                wxPLURAL("%ld statement executed in %s.", "%ld statements executed in %s.", statements),
+		                statements, ElapsedTimeToStr(elapsedQuery).c_str()),
+		            _("File executed."));
+	}
+	else
+	{
+		fileExecOffset = fileExecThread->GetResumeOffset();
+		fileExecLine = fileExecThread->GetResumeLine();
+
+		if (fileExecThread->Cancelled())
+			showMessage(_("Execution Cancelled!"));
+		else
+		{
+			showMessage(wxString::Format(wxT("********** %s **********\n"), _("Error")));
+			showMessage(fileExecThread->GetError());
+			if (!fileExecThread->GetFailedStatement().IsEmpty())
+				showMessage(fileExecThread->GetFailedStatement());
+		}
+		showMessage(wxString::Format(_("Stopped at line %ld, after %ld statements; execute the file again to resume from there."),
+		                             fileExecLine, statements));
+		SetStatusText(_("File execution stopped."), STATUSPOS_MSGS);
+	}
+
+	delete fileExecThread;
+	fileExecThread = NULL;
+
+	// A file run is most likely a dump or a migration
+	if (statements > 0)
+		pgCatalogCache::Invalidate(conn);
+
+	completeQuery(done, false, false);
+}
+
+
+// How much of the file was executed so far
+void frmQuery::ShowFileExecProgress()
+{
+	wxString str = fileExecThread->GetMessagesAndClear();
+	if (!str.IsEmpty())
+	{
+		msgResult->AppendText(str);
+		msgHistory->AppendText(str);
+	}
+
+	wxFileOffset offset;
+	long statements;
+	fileExecThread->GetProgress(offset, statements);
+
+	SetStatusText(wxString::Format(wxPLURAL("%ld statement.", "%ld statements.", statements), statements), STATUSPOS_ROWS);
+
+	double seconds = elapsedQuery.ToDouble() / 1000.0;
+	double megabytes = wxLongLong(offset).ToDouble() / (1024.0 * 1024.0);
+	wxFileOffset length = fileExecThread->GetLength();
+	if (seconds <= 0 || length <= 0)
+		return;
+
+	SetStatusText(wxString::Format(_("Executing file: %.1f of %.1f MB (%d%%), %.0f statements/s."),
+	                               megabytes, wxLongLong(length).ToDouble() / (1024.0 * 1024.0),
+	                               (int)(wxLongLong(offset).ToDouble() * 100.0 / wxLongLong(length).ToDouble()),
+	                               statements / seconds), STATUSPOS_MSGS);
+}
+
+
 void frmQuery::writeScriptOutput()
 {
 	pgScript->LockOutput();
@@ -3240,6 +3794,11 @@ void frmQuery::OnTimer(wxTimerEvent &event)
 		msgHistory->AppendText(str + wxT("\n"));
 	}
 
+	if (exportThread)
+		ShowExportProgress();
+	else if (fileExecThread)
+		ShowFileExecProgress();
+
 	// Increase the granularity for longer running queries
 	if (timer.IsRunning())
 	{
@@ -3407,120 +3966,129 @@ wxColour frmQuery::GetServerColour(pgConn *connection)
 	return tmp;
 }
 
+// Only the index of the history is read; the queries are read when they
+// are chosen. The titles are listed once the list is dropped down.
 void frmQuery::LoadQueries()
 {
-	xmlDocPtr doc;
-	xmlNodePtr cur;
-	xmlChar *key;
+	history->Load();
 
-	if (!wxFile::Access(settings->GetHistoryFile(), wxFile::read))
-		return;
+	sqlQueries->Clear();
+	historyShown.Empty();
+	historyListed = false;
+#if !wxCHECK_VERSION(2, 9, 0)
+	ListQueries();
+#endif
+}
 
-	doc = xmlParseFile((const char *)settings->GetHistoryFile().mb_str(wxConvUTF8));
-	if (doc == NULL)
-	{
-		wxMessageBox(_("Failed to load the history file!"));
-		::wxRemoveFile(settings->GetHistoryFile());
-		return;
-	}
 
-	cur = xmlDocGetRootElement(doc);
-	if (cur == NULL)
-	{
-		xmlFreeDoc(doc);
-		return;
-	}
+// The entries matching the filter, newest first: those whose title starts
+// with its text, then those containing it elsewhere
+void frmQuery::ListQueries()
+{
+	wxString text = txtHistoryFilter->GetValue();
+	size_t i, n;
 
-	if (xmlStrcmp(cur->name, (const xmlChar *) "histoqueries"))
+	historyShown.Empty();
+	if (text.IsEmpty())
 	{
-		wxMessageBox(_("Failed to load the history file!"));
-		xmlFreeDoc(doc);
-		::wxRemoveFile(settings->GetHistoryFile());
-		return;
+		for (n = history->GetCount() ; n-- > 0 ; )
+			historyShown.Add(n);
 	}
-
-	cur = cur->xmlChildrenNode;
-	while (cur != NULL)
+	else
 	{
-		if ((!xmlStrcmp(cur->name, (const xmlChar *)"histoquery")))
-		{
-			key = xmlNodeListGetString(doc, cur->xmlChildrenNode, 1);
+		wxArrayInt found;
+		history->Find(text, true, historyShown);
+		history->Find(text, false, found);
 
-			if (key)
-			{
-				if (WXSTRING_FROM_XML(key) != wxT(""))
-				{
-					wxString query = WXSTRING_FROM_XML(key);
-					wxString tmp = query;
-					tmp.Replace(wxT("\n"), wxT(" "));
-					tmp.Replace(wxT("\r"), wxT(" "));
-					sqlQueries->Append(tmp);
-					histoQueries.Add(query);
-				}
-				xmlFree(key);
-			}
+		// Both are in the same order, and the first are among the others
+		size_t prefixed = historyShown.GetCount();
+		for (i = 0, n = 0 ; i < found.GetCount() ; i++)
+		{
+			if (n < prefixed && found.Item(i) == historyShown.Item(n))
+				n++;
+			else
+				historyShown.Add(found.Item(i));
 		}
-
-		cur = cur->next;
 	}
 
-	xmlFreeDoc(doc);
+	sqlQueries->Freeze();
+	sqlQueries->Clear();
+	for (i = 0 ; i < historyShown.GetCount() ; i++)
+		sqlQueries->Append(history->Item(historyShown.Item(i)).title);
+	sqlQueries->Thaw();
+
+	historyListed = true;
+}
+
+
+void frmQuery::OnDropDownQueries(wxCommandEvent &event)
+{
+	if (!historyListed)
+		ListQueries();
+}
 
-	// Make sure only the maximum query number is enforced
-	if (sqlQueries->GetCount() > (unsigned int)settings->GetHistoryMaxQueries())
-	{
-		while (sqlQueries->GetCount() > (unsigned int)settings->GetHistoryMaxQueries())
-		{
-			histoQueries.RemoveAt(0);
-			sqlQueries->Delete(0);
-		}
-		SaveQueries();
-	}
 
-	return;
+void frmQuery::OnHistoryFilter(wxCommandEvent &event)
+{
+	sqlQueries->Clear();
+	historyShown.Empty();
+	historyListed = false;
+#if !wxCHECK_VERSION(2, 9, 0)
+	ListQueries();
+#endif
+	btnDeleteCurrent->Enable(false);
 }
 
 
-void frmQuery::SaveQueries()
+void frmQuery::OnChangeQuery(wxCommandEvent &event)
 {
-	size_t i;
-	xmlTextWriterPtr writer;
+	int sel = sqlQueries->GetSelection();
+	int n = -1;
 
-	writer = xmlNewTextWriterFilename((const char *)settings->GetHistoryFile().mb_str(wxConvUTF8), 0);
-	if (!writer)
+	// Another window may have changed the history meanwhile; the entry
+	// chosen is looked up again in what it has become
+	if (sel >= 0 && (size_t)sel < historyShown.GetCount())
 	{
-		wxMessageBox(_("Failed to write to history file!"));
-		return;
+		n = historyShown.Item(sel);
+		queryHistoryEntry chosen = history->Item(n);
+		if (history->Load())
+		{
+			n = history->Find(chosen);
+			LoadQueries();
+			if (n >= 0)
+			{
+				ListQueries();
+				sel = historyShown.Index(n);
+				if (sel != wxNOT_FOUND)
+					sqlQueries->SetSelection(sel);
+			}
+		}
 	}
-	xmlTextWriterSetIndent(writer, 1);
 
-	if ((xmlTextWriterStartDocument(writer, NULL, "UTF-8", NULL) < 0) ||
-	        (xmlTextWriterStartElement(writer, XML_STR("histoqueries")) < 0))
+	if (n < 0)
 	{
-		wxMessageBox(_("Failed to write to history file!"));
-		xmlFreeTextWriter(writer);
+		LoadQueries();
+		sqlQueries->SetValue(wxT(""));
+		btnDeleteCurrent->Enable(false);
+		btnDeleteAll->Enable(history->GetCount() > 0);
 		return;
 	}
 
-	for (i = 0; i < histoQueries.GetCount(); i++)
-	{
-		xmlTextWriterStartElement(writer, XML_STR("histoquery"));
-		xmlTextWriterWriteString(writer, XML_FROM_WXSTRING(histoQueries.Item(i)));
-		xmlTextWriterEndElement(writer);
-	}
-
-	if (xmlTextWriterEndDocument(writer) < 0)
+	const queryHistoryEntry &entry = history->Item(n);
+	if (entry.time > 0)
 	{
-		wxMessageBox(_("Failed to write to history file!"));
+		wxString tip = wxString::Format(_("Executed %s on %s, database %s, in %s"),
+		                                wxDateTime(entry.time).Format().c_str(),
+		                                entry.server.c_str(), entry.database.c_str(),
+		                                ElapsedTimeToStr(entry.duration).c_str());
+		if (entry.rows >= 0)
+			tip += wxString::Format(_("; %ld rows"), entry.rows);
+		sqlQueries->SetToolTip(tip);
 	}
+	else
+		sqlQueries->SetToolTip(_("Previous queries"));
 
-	xmlFreeTextWriter(writer);
-}
-
-
-void frmQuery::OnChangeQuery(wxCommandEvent &event)
-{
-	wxString query = histoQueries.Item(sqlQueries->GetSelection());
+	wxString query = history->GetQuery(n);
 	if (query.Length() > 0)
 	{
 		sqlQuery->SetText(query);
@@ -3532,7 +4100,7 @@ void frmQuery::OnChangeQuery(wxCommandEvent &event)
 		SetLineEndingStyle();
 		btnDeleteCurrent->Enable(true);
 	}
-	btnDeleteAll->Enable(sqlQueries->GetCount() > 0);
+	btnDeleteAll->Enable(history->GetCount() > 0);
 }
 
 
@@ -3544,12 +4112,13 @@ void frmQuery::OnDeleteCurrent(wxCommandEvent &event)
 	                     _("Confirm deletion"),
 	                     wxYES_NO | wxNO_DEFAULT | wxICON_EXCLAMATION).ShowModal() == wxID_YES )
 	{
-		histoQueries.RemoveAt(sqlQueries->GetSelection());
-		sqlQueries->Delete(sqlQueries->GetSelection());
+		int sel = sqlQueries->GetSelection();
+		if (sel >= 0 && (size_t)sel < historyShown.GetCount() && !history->Delete(historyShown.Item(sel)))
+			wxMessageBox(_("Failed to write to history file!"));
+		LoadQueries();
 		sqlQueries->SetValue(wxT(""));
 		btnDeleteCurrent->Enable(false);
-		btnDeleteAll->Enable(sqlQueries->GetCount() > 0);
-		SaveQueries();
+		btnDeleteAll->Enable(history->GetCount() > 0);
 	}
 }
 
@@ -3562,12 +4131,12 @@ void frmQuery::OnDeleteAll(wxCommandEvent &event)
 	                     _("Confirm deletion"),
 	                     wxYES_NO | wxNO_DEFAULT | wxICON_EXCLAMATION).ShowModal() == wxID_YES )
 	{
-		histoQueries.Clear();
-		sqlQueries->Clear();
+		if (!history->Clear())
+			wxMessageBox(_("Failed to write to history file!"));
+		LoadQueries();
 		sqlQueries->SetValue(wxT(""));
 		btnDeleteCurrent->Enable(false);
-		btnDeleteAll->Enable(false);
-		SaveQueries();
+		btnDeleteAll->Enable(history->GetCount() > 0);
 	}
 }
 
@@ -3905,7 +4474,7 @@ wxWindow *queryToolBaseFactory::StartDialogSql(frmMain *form, pgObject *obj, con
 {
 	pgDatabase *db = obj->GetDatabase();
 	wxString applicationname = appearanceFactory->GetLongAppName() + _(" - Query Tool");
-	pgConn *conn = db->CreateConn(applicationname);
+	pgConn *conn = db->CreatePooledConn(applicationname);
 	if (conn)
 	{
 		frmQuery *fq = new frmQuery(form, obj->GetDisplayName(), conn, sql);
@@ -927,7 +927,7 @@ void frmReport::XmlAddSectionTableFromGrid(const int section, ctlSQLResult *grid
 	sectionTableHeader[section - 1] = data;
 
 	// Build the rows
-	int rows = grid->NumRows();
+	int rows = grid->GetNumberRows();
 
 	for (int y = 0; y < rows; y++)
 	{
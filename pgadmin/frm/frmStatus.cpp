@@ -28,6 +28,7 @@
 #include "frm/frmHint.h"
 #include "frm/frmMain.h"
 #include "db/pgConn.h"
+#include "db/pgConnPool.h"
 #include "frm/frmQuery.h"
 #include "utils/pgfeatures.h"
 #include "schema/pgServer.h"
@@ -442,12 +443,12 @@ frmStatus::~frmStatus()
 	if (locks_connection && locks_connection != connection)
 	{
 		if (locks_connection->IsAlive())
-			delete locks_connection;
+			pgConnPool::Get()->Release(locks_connection);
 	}
 	if (connection)
 	{
 		if (connection->IsAlive())
-			delete connection;
+			pgConnPool::Get()->Release(connection);
 	}
 }
 
@@ -3183,7 +3184,7 @@ wxWindow *serverStatusFactory::StartDialog(frmMain *form, pgObject *obj)
 	pgServer *server = obj->GetServer();
 	wxString applicationname = appearanceFactory->GetLongAppName() + _(" - Server Status");
 
-	pgConn *conn = server->CreateConn(wxEmptyString, 0, applicationname);
+	pgConn *conn = server->CreatePooledConn(wxEmptyString, 0, applicationname);
 	if (conn)
 	{
 		wxString txt = _("Server Status - ") + server->GetDescription()
@@ -19,6 +19,7 @@
 
 #include "db/pgConn.h"
 #include "dlg/dlgFindReplace.h"
+#include "utils/sqlStatementIndex.h"
 
 // These structs are from Scintilla.h which isn't easily #included :-(
 struct CharacterRange
@@ -35,6 +36,7 @@ struct TextToFind
 };
 
 class sysProcess;
+class pgCatalogCache;
 
 // Class declarations
 class ctlSQLBox : public wxStyledTextCtrl
@@ -49,6 +51,14 @@ public:
 	void Create(wxWindow *parent, wxWindowID id = -1, const wxPoint &pos = wxDefaultPosition, const wxSize &size = wxDefaultSize, long style = 0);
 
 	void SetDatabase(pgConn *db);
+	pgConn *GetDatabase() const
+	{
+		return m_database;
+	}
+	pgCatalogCache *GetCatalog() const
+	{
+		return m_catalog;
+	}
 
 	void OnKeyDown(wxKeyEvent &event);
 	void OnAutoComplete(wxCommandEvent &event);
@@ -67,6 +77,12 @@ public:
 	{
 		m_autocompDisabled = on;
 	}
+	// The statements of the text, as they are now
+	const sqlStatementIndex &GetStatements();
+	// The statement at a position, or the one just ended before it on its
+	// line, without the white space and comments around it; false if
+	// there is none
+	bool GetStatementRange(int pos, int &start, int &end);
 	bool BlockComment(bool uncomment = false);
 	void UpdateLineNumber();
 	wxString ExternalFormat();
@@ -101,9 +117,12 @@ private:
 	//void OnPositionStc2(wxStyledTextEvent &event);
 	void OnPositionStc(wxStyledTextEvent &event);
 	void OnMarginClick(wxStyledTextEvent &event);
+	void OnModified(wxStyledTextEvent &event);
 
 	dlgFindReplace *m_dlgFindReplace;
 	pgConn *m_database;
+	pgCatalogCache *m_catalog;
+	sqlStatementIndex m_statements;
 	bool m_autoIndent, m_autocompDisabled;
 
 	// Variables to track info per SQL box
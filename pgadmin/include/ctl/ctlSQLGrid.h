@@ -15,6 +15,8 @@
 // wxWindows headers
 #include <wx/grid.h>
 
+// Number of rows measured when the columns are sized automatically
+#define CTLSQLGRID_SIZE_ROWS 500
 
 class ctlSQLGrid : public wxGrid
 {
@@ -29,7 +31,7 @@ public:
 	{
 		return false;
 	}
-	int Copy();
+	virtual int Copy();
 
 	virtual bool CheckRowPresent(int row)
 	{
@@ -47,14 +49,19 @@ public:
 	DECLARE_DYNAMIC_CLASS(ctlSQLGrid)
 	DECLARE_EVENT_TABLE()
 
+protected:
+	virtual wxString GetColumnName(int colNum);
+	virtual void MeasureColumns(int rows, wxArrayInt &widths);
+	void WidenColumns(const wxArrayInt &widths);
+	void ShrinkWideColumns();
+	void AppendColumnHeader(wxString &str, int start, int end);
+	void AppendColumnHeader(wxString &str, wxArrayInt columns);
+
 private:
 	void OnCopy(wxCommandEvent &event);
 	void OnMouseWheel(wxMouseEvent &event);
 	void OnGridColSize(wxGridSizeEvent &event);
-	wxString GetColumnName(int colNum);
 	wxString GetColKeyValue(int col);
-	void AppendColumnHeader(wxString &str, int start, int end);
-	void AppendColumnHeader(wxString &str, wxArrayInt columns);
 
 	// Stores sizes of colums explicitly resized by user
 	ColKeySizeHashMap colSizes;
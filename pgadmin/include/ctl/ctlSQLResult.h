@@ -17,11 +17,19 @@
 
 #include "db/pgSet.h"
 #include "db/pgConn.h"
+#include "db/pgQueryThread.h"
 #include "ctlSQLGrid.h"
 #include "frm/frmExport.h"
 
 #define CTLSQL_RUNNING 100  // must be greater than ExecStatusType PGRES_xxx values
 
+// Number of rows the grid is extended by at once, while a result is streamed
+#define CTLSQL_STREAM_BATCH_ROWS 10000
+
+class pgQueryResultEvent;
+class sqlResultFilter;
+class sqlResultWidthThread;
+
 class ctlSQLResult : public ctlSQLGrid
 {
 public:
@@ -29,7 +37,11 @@ public:
 	~ctlSQLResult();
 
 
-	int Execute(const wxString &query, int resultToDisplay = 0, wxWindow *caller = 0, long eventId = 0, void *data = 0); // > 0: resultset to display, <=0: last result
+	int Execute(const wxString &query, int resultToDisplay = 0, wxWindow *caller = 0, long eventId = 0, void *data = 0, bool streamRows = false,
+	            const wxArrayString *statements = NULL, const wxArrayInt *offsets = NULL); // > 0: resultset to display, <=0: last result
+	// Of a query run a statement at a time (see pgQueryThread::SetStatements)
+	const pgStatementTimingArray *GetStatementTimings() const;
+	long AppendRows(pgQueryResultEvent &ev);
 	void SetConnection(pgConn *conn);
 	long NumRows() const;
 	long InsertedCount() const;
@@ -39,10 +51,10 @@ public:
 
 	bool Export();
 	bool ToFile();
-	bool ToFile(frmExport *frm);
+	// The set is exported by another thread, so it must be complete
 	bool CanExport()
 	{
-		return NumRows() > 0 && colNames.GetCount() > 0;
+		return NumRows() > 0 && colNames.GetCount() > 0 && RunStatus() != CTLSQL_RUNNING;
 	}
 
 	wxString OnGetItemText(long item, long col) const;
@@ -67,21 +79,93 @@ public:
 	void SetMaxRows(int rows);
 	void ResultsFinished();
 	void OnGridSelect(wxGridRangeSelectEvent &event);
+	void OnLabelRightClick(wxGridEvent &event);
+	void OnSort(wxCommandEvent &event);
+	int Copy();
+
+	// Show only the rows fetched matching the text, see sqlResultFilter;
+	// an empty text shows all rows again
+	void SetFilter(const wxString &text);
+	void CancelFilter();
+	bool IsFiltered();
+	void OnFilterComplete(wxCommandEvent &event);
+	void OnColumnWidths(wxCommandEvent &event);
+
+#ifdef __WXDEBUG__
+	// For timing the grid over a wide result, see frmQuery::OnTimeResultGrid
+	void DisplayTestData(long rows, int cols);
+	void TimeScrolling(double &msPerPage, double &msPerColumn);
+	void TimeColumnWidths(long &msSized, long &msMeasured);
+#endif
 
 	wxArrayString colNames;
 	wxArrayString colTypes;
 	wxArrayLong colTypClasses;
 
+protected:
+	wxString GetColumnName(int colNum);
+	void MeasureColumns(int rows, wxArrayInt &widths);
+
 private:
+	void ClearResult();
+	void ResizeGrid(long rows, long cols);
+	void SetColumns(pgSet *set);
+	void UpdateRows();
+	void StartColumnWidths();
+	void CancelColumnWidths();
+
 	pgQueryThread *thread;
 	pgConn *conn;
 	bool rowcountSuppressed;
+	// The result set shown while it was streamed in
+	pgSet *streamedSet;
+	// Column of the label menu
+	int sortMenuCol;
+	// The filter running, and the number of the latest one started
+	sqlResultFilter *filter;
+	int filterSeq;
+	// Measuring the rows beyond those the columns were sized by at first
+	sqlResultWidthThread *widthThread;
+	int widthSeq;
+};
+
+// Number of rendered cells sqlResultTable keeps
+#define SQLRESULT_CELL_CACHE_SIZE 4096
+
+WX_DECLARE_HASH_MAP(wxLongLong_t, int, wxIntegerHash, wxIntegerEqual, sqlResultCellIndex);
+
+// Least recently used cache of the strings shown in the grid cells
+class sqlResultCellCache
+{
+public:
+	sqlResultCellCache(int size);
+	~sqlResultCellCache();
+
+	bool Lookup(wxLongLong_t key, wxString &value);
+	void Store(wxLongLong_t key, const wxString &value);
+	void Clear();
+
+private:
+	void Unlink(int slot);
+	void LinkFirst(int slot);
+
+	typedef struct
+	{
+		wxLongLong_t key;
+		wxString value;
+		int prev, next;
+	} sqlResultCell;
+
+	sqlResultCell *cells;
+	int size, used, first, last;
+	sqlResultCellIndex index;
 };
 
 class sqlResultTable : public wxGridTableBase
 {
 public:
 	sqlResultTable();
+	~sqlResultTable();
 	wxString GetValue(int row, int col);
 	int GetNumberRows();
 	int GetNumberCols();
@@ -97,7 +181,13 @@ public:
 	void SetThread(pgQueryThread *t)
 	{
 		thread = t;
+		formatValid = false;
+		cache.Clear();
+		ClearFilter();
+		ClearSort();
 	}
+	// Freeze the display settings and column types of the current result
+	void TakeFormatSnapshot();
 	bool DeleteRows(size_t pos = 0, size_t numRows = 1)
 	{
 		return true;
@@ -107,8 +197,65 @@ public:
 		return true;
 	}
 
+	// Show the rows ordered by a column, or in the order of the result
+	void SortRows(int col, bool ascending);
+	void ClearSort();
+	int GetSortColumn() const
+	{
+		return sortIndex ? sortCol : -1;
+	}
+
+	// Show only the rows flagged in matches (new[] allocated, one flag for
+	// each row of the set), which the table takes over
+	void SetFilter(char *matches);
+	void ClearFilter();
+	bool IsFiltered() const
+	{
+		return filterMatches != NULL;
+	}
+
+	// The rows of the set shown, in the order shown; NULL if all rows are
+	// shown in the order of the result
+	const long *GetViewRows() const
+	{
+		return filterMatches ? filterRows : sortIndex;
+	}
+	long GetViewCount();
+
+	// Row of the result set shown in a row of the grid
+	long DataRow(long row) const
+	{
+		if (filterMatches)
+			return row < filterCount ? filterRows[row] : row;
+		return (sortIndex && row < sortRows) ? sortIndex[row] : row;
+	}
+
 private:
+	wxString FormatValue(pgSet *set, int col);
+	void BuildFilterRows();
+
 	pgQueryThread *thread;
+
+	// Formatting snapshot, see TakeFormatSnapshot()
+	bool formatValid;
+	bool indicateNull;
+	wxString decimalMark, thousandsSeparator;
+	size_t maxColSize;
+	wxArrayLong colTypClasses;
+
+	// Cached by row of the result, so it stays valid when sorting
+	sqlResultCellCache cache;
+
+	// Permutation of the rows, see sqlResultSort
+	long *sortIndex;
+	long sortRows;
+	int sortCol;
+	bool sortAscending;
+
+	// Rows matching the filter, in the order of the sort
+	char *filterMatches;
+	long *filterRows;
+	long filterCount;
 };
 
 #endif
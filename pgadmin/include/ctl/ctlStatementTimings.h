@@ -0,0 +1,68 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// ctlStatementTimings.h - Timings of the statements of a query
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef CTLSTATEMENTTIMINGS_H
+#define CTLSTATEMENTTIMINGS_H
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/listctrl.h>
+
+// App headers
+#include "ctl/ctlListView.h"
+#include "db/pgQueryThread.h"
+
+// Longest part of a statement shown
+#define CTLSTATEMENTTIMINGS_STATEMENT_LENGTH 200
+
+class wxImageList;
+
+// The statements of a query run a statement at a time, with how long each
+// took, the rows it returned or affected and the plan used by an EXECUTE.
+// They are listed in the order they were run, or sorted by the column
+// clicked on.
+class ctlStatementTimings : public ctlListView
+{
+public:
+	ctlStatementTimings(wxWindow *parent, wxWindowID id);
+	~ctlStatementTimings();
+
+	void SetTimings(const pgStatementTimingArray &timings);
+	void ClearTimings();
+
+	size_t GetCount() const
+	{
+		return timings.GetCount();
+	}
+	// The statement which took the longest, or -1
+	int GetSlowest() const;
+	// The statement shown in a row, or -1
+	int GetStatement(long row) const;
+	const pgStatementTiming &Item(size_t index) const
+	{
+		return timings[index];
+	}
+
+private:
+	void OnColumnClick(wxListEvent &event);
+	void Fill();
+
+	pgStatementTimingArray timings;
+	// The statements in the order shown
+	wxArrayInt order;
+	int sortColumn;
+	bool sortAscending;
+	wxImageList *images;
+
+	DECLARE_EVENT_TABLE()
+};
+
+#endif
@@ -24,6 +24,8 @@
 
 #include <ogl/ogl.h>
 
+#include "ctl/explainPlan.h"
+
 
 #if wxUSE_DEPRECATED
 #error wxUSE_DEPRECATED should be 0!
@@ -47,10 +49,16 @@ public:
 
 private:
 	void OnMouseMotion(wxMouseEvent &ev);
+	void SetExplainPlan();
+	ExplainShape *AddPlanShapes(ExplainPlanNode *node, ExplainShape *upper, long level, int &maxLevel);
+	void LayoutShapes(int maxLevel);
 
 	ExplainShape *rootShape;
 	ExplainPopup *popup;
 
+	// Of EXPLAIN (FORMAT JSON), which the shapes refer to
+	ExplainPlan plan;
+
 	DECLARE_EVENT_TABLE()
 };
 
@@ -61,6 +69,10 @@ public:
 	ExplainShape(const wxImage &bmp, const wxString &description, long tokenNo = -1, long detailNo = -1);
 	static ExplainShape *Create(long level, ExplainShape *last, const wxString &str);
 
+	// Takes the figures of a node of a JSON plan, which are shown rather
+	// than those parsed from its text
+	void SetPlanNode(const ExplainPlanNode *node, const ExplainPlan &plan);
+
 	void SetCondition(const wxString &str)
 	{
 		if (condition.Length() == 0) condition = str;
@@ -104,6 +116,17 @@ protected:
 	int usedShapes;
 	bool m_rootShape;
 
+	// Of JSON plans only: the lines the popup shows below the figures, the
+	// labels drawn below the node, its time (or cost) relative to the
+	// heaviest node, and whether it's one of the hottest nodes or its rows
+	// were badly misestimated
+	const ExplainPlanNode *planNode;
+	wxArrayString stats;
+	wxString timeLabel, rowsLabel;
+	double heat;
+	bool hot;
+	bool misestimated;
+
 	friend class ExplainCanvas;
 	friend class ExplainText;
 };
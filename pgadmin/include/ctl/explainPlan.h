@@ -0,0 +1,189 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// explainPlan.h - Plans of EXPLAIN (FORMAT JSON)
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef EXPLAINPLAN_H
+#define EXPLAINPLAN_H
+
+#include <wx/wx.h>
+#include <wx/dynarray.h>
+
+class ExplainPlanNode;
+class jsonValue;
+
+WX_DEFINE_ARRAY_PTR(ExplainPlanNode *, ExplainPlanNodeArray);
+
+
+// Blocks hit and read, see the BUFFERS option of EXPLAIN
+class ExplainBuffers
+{
+public:
+	ExplainBuffers();
+
+	void Add(const ExplainBuffers &buffers);
+	// Blocks that had to be read rather than found in the buffer cache
+	double GetReads() const
+	{
+		return sharedRead + localRead + tempRead;
+	}
+	bool IsEmpty() const;
+	wxString ToString() const;
+
+	double sharedHit, sharedRead, sharedDirtied, sharedWritten;
+	double localHit, localRead, localDirtied, localWritten;
+	double tempRead, tempWritten;
+	// Milliseconds, with track_io_timing only
+	double ioReadTime, ioWriteTime;
+};
+
+
+// What a parallel worker did of a node
+class ExplainWorker
+{
+public:
+	ExplainWorker();
+
+	long number;
+	double actualStartup, actualTotal, actualRows, actualLoops;
+	ExplainBuffers buffers;
+};
+
+WX_DECLARE_OBJARRAY(ExplainWorker, ExplainWorkerArray);
+
+
+class ExplainPlanNode
+{
+public:
+	ExplainPlanNode(ExplainPlanNode *parent);
+	~ExplainPlanNode();
+
+	// The first line of the node in the text format of EXPLAIN, such as
+	// "Index Scan Backward using idx on tab t  (cost=...) (actual ...)"
+	wxString GetTextLine() const;
+	// The detail lines of the text format: conditions, sort keys and such
+	const wxArrayString &GetConditions() const
+	{
+		return conditions;
+	}
+
+	// Milliseconds spent in the node over all its loops, with and without
+	// its children; parallel workers are taken to run side by side
+	double GetInclusiveTime() const
+	{
+		return inclusiveTime;
+	}
+	double GetExclusiveTime() const
+	{
+		return exclusiveTime;
+	}
+	// Cost of the node, and blocks it read, without its children
+	double GetExclusiveCost() const;
+	double GetExclusiveReads() const;
+	// Factor by which the number of rows was over- (> 1) or
+	// underestimated (< 1); 1 if not analyzed
+	double GetRowsEstimateFactor() const;
+
+	ExplainPlanNode *GetParent() const
+	{
+		return parent;
+	}
+	const ExplainPlanNodeArray &GetChildren() const
+	{
+		return children;
+	}
+
+	wxString nodeType, name;
+	wxString parentRelationship, subplanName;
+	double startupCost, totalCost, planRows, planWidth;
+
+	// Only with ANALYZE
+	bool analyzed, executed;
+	double actualStartup, actualTotal, actualRows, actualLoops;
+
+	ExplainBuffers buffers;
+	long workersPlanned, workersLaunched;
+	ExplainWorkerArray workers;
+
+private:
+	void Parse(const jsonValue &plan, int processes);
+	void AddCondition(const jsonValue &plan, const char *key);
+
+	ExplainPlanNode *parent;
+	ExplainPlanNodeArray children;
+	wxArrayString conditions;
+	double inclusiveTime, exclusiveTime;
+
+	friend class ExplainPlan;
+};
+
+
+// A plan as returned by EXPLAIN (FORMAT JSON), which may hold the plans of
+// several statements, with the nodes in depth first order
+class ExplainPlan
+{
+public:
+	ExplainPlan();
+	~ExplainPlan();
+
+	// EXPLAIN output in the JSON format starts with a bracket
+	static bool IsJson(const wxString &str);
+	bool Parse(const wxString &str);
+	void Clear();
+
+	size_t GetPlanCount() const
+	{
+		return roots.GetCount();
+	}
+	ExplainPlanNode *GetRoot(size_t n) const
+	{
+		return roots.Item(n);
+	}
+	// Planning and execution time of a statement, in milliseconds; -1 if
+	// not reported
+	double GetPlanningTime(size_t n) const
+	{
+		return planningTimes.Item(n);
+	}
+	double GetExecutionTime(size_t n) const
+	{
+		return executionTimes.Item(n);
+	}
+
+	const ExplainPlanNodeArray &GetNodes() const
+	{
+		return nodes;
+	}
+	bool IsAnalyzed() const
+	{
+		return analyzed;
+	}
+
+	// What the nodes are compared by: the time spent in them if the plan
+	// was analyzed, otherwise their cost
+	double GetWeight(const ExplainPlanNode *node) const;
+	// Weight of a node relative to the heaviest one, and to all of them
+	double GetHeat(const ExplainPlanNode *node) const;
+	double GetShare(const ExplainPlanNode *node) const;
+	// The few nodes most of the time (or cost) goes to
+	bool IsHot(const ExplainPlanNode *node) const;
+
+	// Blocks read by a node relative to the node reading the most
+	double GetReadShare(const ExplainPlanNode *node) const;
+
+private:
+	void AddNodes(ExplainPlanNode *node);
+
+	ExplainPlanNodeArray roots, nodes;
+	wxArrayDouble planningTimes, executionTimes;
+	bool analyzed;
+	double maxWeight, totalWeight, hotWeight, maxReads;
+};
+
+#endif
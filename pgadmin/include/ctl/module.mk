@@ -23,9 +23,15 @@ pgadmin3_SOURCES += \
 	include/ctl/ctlSQLBox.h \
 	include/ctl/ctlSQLGrid.h \
 	include/ctl/ctlSQLResult.h \
+	include/ctl/ctlStatementTimings.h \
 	include/ctl/ctlProgressStatusBar.h \
 	include/ctl/ctlTree.h \
 	include/ctl/explainCanvas.h \
+	include/ctl/explainPlan.h \
+	include/ctl/sqlResultCopy.h \
+	include/ctl/sqlResultFilter.h \
+	include/ctl/sqlResultSort.h \
+	include/ctl/sqlResultWidths.h \
 	include/ctl/timespin.h \
 	include/ctl/wxgridsel.h \
 	include/ctl/xh_calb.h \
@@ -0,0 +1,96 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// sqlResultCopy.h - Copying query results to the clipboard
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef SQLRESULTCOPY_H
+#define SQLRESULTCOPY_H
+
+#include <wx/wx.h>
+#include <wx/thread.h>
+
+class pgSet;
+
+// Number of rows copied between updates of the progress
+#define SQLRESULT_COPY_CHECK_ROWS       4096
+
+// How often the progress is looked at (ms), and how long a copy may take
+// before the progress is shown
+#define SQLRESULT_COPY_PROGRESS_INTERVAL    100
+#define SQLRESULT_COPY_PROGRESS_DELAY       500
+
+
+// Builds the clipboard text of cells of a result set. The raw values are
+// taken from the set, rather than the (formatted, and possibly truncated)
+// text of the grid cells. The lengths of the values are summed up first,
+// so the text is built in a buffer of its final size, and converted from
+// the client encoding in one go. The set must not be changed until the
+// thread has finished.
+class sqlResultCopy : public wxThread
+{
+public:
+	// viewRows maps the rows of the grid to those of the set, see
+	// sqlResultTable::GetViewRows()
+	sqlResultCopy(pgSet *set, const long *viewRows);
+
+	// Rows of the grid to copy: a list, or else a range
+	void SetRows(const wxArrayInt &rows);
+	void SetRows(long first, long last);
+	// Columns to copy, and whether each of them is quoted
+	void SetColumns(const wxArrayInt &cols, const wxArrayInt &quoteCols);
+	// The header is copied as it is, including its line end
+	void SetFormat(const wxString &header, const wxString &colSeparator,
+	               const wxString &quoteChar, const wxString &rowSeparator);
+
+	void *Entry();
+	void Cancel();
+
+	void GetProgress(long &done, long &total);
+	long GetRowCount() const
+	{
+		return rowList.IsEmpty() ? lastRow - firstRow + 1 : (long)rowList.GetCount();
+	}
+
+	// Only valid after the thread has finished
+	const wxString &GetText() const
+	{
+		return text;
+	}
+	bool Cancelled()
+	{
+		return cancelled;
+	}
+
+private:
+	bool CheckCancel();
+	long DataRow(long n) const;
+	size_t RowLength(long row) const;
+	char *AppendRow(char *p, long row) const;
+	void ConvertRows(const char *data);
+
+	pgSet *set;
+	const long *viewRows;
+
+	wxArrayInt rowList;
+	long firstRow, lastRow;
+	wxArrayInt cols, quoteCols;
+
+	wxCharBuffer header, colSeparator, quoteChar, rowSeparator;
+	size_t headerLen, colSeparatorLen, quoteCharLen, rowSeparatorLen;
+	// Only several rows end with a separator
+	bool endRows;
+
+	wxString text;
+
+	wxCriticalSection progressLock;
+	long done;
+	bool cancelled;
+};
+
+#endif
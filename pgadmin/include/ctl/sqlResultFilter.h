@@ -0,0 +1,98 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// sqlResultFilter.h - Client side filtering of query results
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef SQLRESULTFILTER_H
+#define SQLRESULTFILTER_H
+
+#include <wx/wx.h>
+#include <wx/thread.h>
+
+class pgSet;
+
+// Number of rows scanned between looks for a cancel request
+#define SQLRESULT_FILTER_CHECK_ROWS     65536
+
+// Operators of a filter condition
+enum
+{
+	SQLFILTER_TEXT = 0,     // substring in any column
+	SQLFILTER_EQ,
+	SQLFILTER_NE,
+	SQLFILTER_LT,
+	SQLFILTER_LE,
+	SQLFILTER_GT,
+	SQLFILTER_GE,
+	SQLFILTER_CONTAINS,     // column ~ 'text'
+	SQLFILTER_ISNULL,
+	SQLFILTER_NOTNULL
+};
+
+
+// Finds the rows of a result set matching the text of the filter bar,
+// without asking the server. The text is either a condition on a column
+//     column = 'value'    (also <>, !=, <, <=, >, >=)
+//     column ~ 'text'     (contains, ignoring the case)
+//     column IS [NOT] NULL
+// or else a text to look for in all columns, ignoring the case. Numbers,
+// booleans and dates/times are compared by value, everything else
+// bytewise. The columns are scanned one by one, straight from the results
+// holding the rows.
+class sqlResultFilter : public wxThread
+{
+public:
+	sqlResultFilter(pgSet *set, wxEvtHandler *caller, long eventId, int seq);
+	~sqlResultFilter();
+
+	// Parse the text of the filter; to be called before the thread runs
+	void Parse(const wxString &text);
+
+	void *Entry();
+	void Cancel();
+
+	// Only valid after the thread has finished: a flag for each row of the
+	// set (to be deleted by the caller), and the number of rows matching
+	char *TakeMatches();
+	long GetMatchCount()
+	{
+		return matchCount;
+	}
+	bool Cancelled()
+	{
+		return cancelled;
+	}
+
+private:
+	bool CheckCancel();
+	bool ScanColumn(int col);
+	bool MatchValue(const char *value) const;
+	bool ContainsText(const char *value) const;
+	bool ParseCondition(const wxString &text);
+
+	pgSet *set;
+	wxEvtHandler *caller;
+	long eventId;
+	int seq;
+
+	// The condition parsed
+	int op, col, typClass;
+	wxCharBuffer literal;
+	size_t literalLen;
+	double literalKey;
+	bool literalKeyValid;
+
+	char *matches;
+	long matchCount;
+
+	wxCriticalSection cancelLock;
+	bool cancelled;
+};
+
+#endif
@@ -0,0 +1,44 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// sqlResultSort.h - Client side sorting of query results
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef SQLRESULTSORT_H
+#define SQLRESULTSORT_H
+
+#include <wx/wx.h>
+
+class pgSet;
+
+// Number of rows from which a result is sorted by several threads, and the
+// largest number of threads used
+#define SQLRESULT_PARALLEL_SORT_ROWS    100000
+#define SQLRESULT_SORT_MAX_THREADS      8
+
+
+// Orders the rows of a result set by one of its columns, without asking the
+// server. The values are parsed into keys of their type class once:
+// numbers, booleans and dates/times (in the ISO style) are compared by
+// value, everything else bytewise (like COLLATE "C"). If a value can't be
+// parsed, the whole column is compared as text. NULLs sort last when
+// ascending, as in PostgreSQL, and equal values keep the order of the
+// result.
+class sqlResultSort
+{
+public:
+	// Returns the permutation of the rows (new[] allocated): element n is
+	// the row of the set to be shown at position n
+	static long *Sort(pgSet *set, int col, int typClass, bool ascending);
+
+	// The key of a value of the type class; fails for text, and for values
+	// not in the format of the class
+	static bool ParseKey(int typClass, const char *value, double &key);
+};
+
+#endif
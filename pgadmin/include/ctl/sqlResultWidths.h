@@ -0,0 +1,106 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// sqlResultWidths.h - Estimating the widths of query result columns
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef SQLRESULTWIDTHS_H
+#define SQLRESULTWIDTHS_H
+
+#include <wx/wx.h>
+#include <wx/thread.h>
+
+class pgSet;
+
+// The largest number of rows measured after the columns have been sized,
+// and the number of rows between updates of the column widths meanwhile
+#define SQLRESULT_WIDTH_MAX_ROWS        200000
+#define SQLRESULT_WIDTH_BATCH_ROWS      20000
+
+
+// The advances of the characters of a font, measured once per font
+class sqlResultGlyphWidths
+{
+public:
+	sqlResultGlyphWidths();
+
+	static const sqlResultGlyphWidths &Get(wxWindow *wnd, const wxFont &font);
+
+	// Any character beyond ASCII is taken to be as wide as an 'M'
+	int Advance(unsigned int c) const
+	{
+		return c < 128 ? advances[c] : otherAdvance;
+	}
+	int TextWidth(const wxString &text) const;
+
+private:
+	int advances[128];
+	int otherAdvance;
+};
+
+
+// Estimates the width of the text of cells of a result set, as formatted by
+// sqlResultTable, by adding up the advances of the characters of the raw
+// values. Kerning is ignored, so this is close to, but not exactly, what
+// the device context would measure.
+class sqlResultWidths
+{
+public:
+	sqlResultWidths(pgSet *set, const sqlResultGlyphWidths &glyphs, const wxArrayLong &typClasses);
+
+	int CellWidth(long row, int col) const;
+	// Widest cell of the rows from up to (not including) to
+	int ColumnWidth(int col, long from, long to) const;
+
+private:
+	int TextWidth(const char *value, bool numeric) const;
+
+	pgSet *set;
+	sqlResultGlyphWidths glyphs;
+	wxArrayLong typClasses;
+	bool utf8;
+
+	// Formatting settings, see sqlResultTable::TakeFormatSnapshot()
+	bool indicateNull;
+	size_t maxColSize;
+	int nullWidth, separatorWidth, ellipsisWidth;
+};
+
+
+// Measures the cells of a result set beyond those sized at first, so the
+// columns can be widened; an event is sent to the caller every batch of
+// rows, with the number given to the thread as its int and 1 as its extra
+// long when done. The set must not be changed until the thread has finished.
+class sqlResultWidthThread : public wxThread
+{
+public:
+	sqlResultWidthThread(const sqlResultWidths &widths, int nCols, long from, long to,
+	                     wxEvtHandler *caller, long eventId, int seq);
+
+	void *Entry();
+	void Cancel();
+
+	// The widest cell found so far of each column
+	void GetWidths(wxArrayInt &widths);
+
+private:
+	bool CheckCancel();
+	void Notify(bool done);
+
+	sqlResultWidths estimate;
+	long firstRow, lastRow;
+	wxEvtHandler *caller;
+	long eventId;
+	int seq;
+
+	wxCriticalSection widthsLock;
+	wxArrayInt columnWidths;
+	bool cancelled;
+};
+
+#endif
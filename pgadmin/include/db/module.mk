@@ -10,7 +10,15 @@
 #######################################################################
 
 pgadmin3_SOURCES += \
+	  include/db/pgBenchmark.h \
+	  include/db/pgCatalogCache.h \
 	  include/db/pgConn.h \
+	  include/db/pgConnPool.h \
+	  include/db/pgExportThread.h \
+	  include/db/pgExportWriter.h \
+	  include/db/pgFileExecThread.h \
+	  include/db/pgLoadTest.h \
+	  include/db/pgQueryStats.h \
 	  include/db/pgQueryThread.h \
 	  include/db/pgQueryResultEvent.h \
 	  include/db/pgSet.h
@@ -0,0 +1,101 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgBenchmark.h - Repeated runs of queries, timed
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef PGBENCHMARK_H
+#define PGBENCHMARK_H
+
+#include <wx/wx.h>
+#include <wx/thread.h>
+#include <wx/dynarray.h>
+
+class pgConn;
+
+// Least interval between progress events of a benchmark (ms)
+#define PGBENCHMARK_PROGRESS_INTERVAL   250
+
+
+// The timings of the runs of one query, in milliseconds
+class pgBenchmarkResult
+{
+public:
+	pgBenchmarkResult()
+	{
+		errors = 0;
+	}
+
+	wxString query;
+	// Of the runs timed, in the order they were run
+	wxArrayDouble latencies;
+	// As reported by EXPLAIN ANALYZE, if asked for: one per timed run, or
+	// -1 where not known
+	wxArrayDouble planningTimes, executionTimes;
+	long errors;
+	wxString lastError;
+};
+
+WX_DECLARE_OBJARRAY(pgBenchmarkResult, pgBenchmarkResultArray);
+
+
+// Distribution of a set of timings; negative ones, which are not known,
+// are left out
+class pgBenchmarkSummary
+{
+public:
+	pgBenchmarkSummary(const wxArrayDouble &timings);
+
+	size_t count;
+	double min, median, p95, max, mean;
+};
+
+
+// Runs each of the queries a number of times on a connection, the queries
+// taking turns, and times them. The first runs warm up caches and aren't
+// timed. An event is sent to the caller now and then, with the number
+// given to the thread as its int and 1 as its extra long when done. The
+// connection must not be used otherwise until the thread has finished.
+class pgBenchmarkThread : public wxThread
+{
+public:
+	pgBenchmarkThread(pgConn *conn, const wxArrayString &queries, long runs, long warmups, bool serverTimings,
+	                  wxEvtHandler *caller, long eventId, int seq);
+
+	void *Entry();
+	// Stops after the current run, which is cancelled on the server
+	void Cancel();
+
+	// All runs, including the warmups, of all queries
+	long GetRunsTotal() const
+	{
+		return (runs + warmups) * queries.GetCount();
+	}
+	long GetRunsDone();
+	void GetResults(pgBenchmarkResultArray &results);
+
+private:
+	bool CheckCancel();
+	void Notify(bool done);
+	bool ServerTimings(const wxString &query, double &planning, double &execution);
+
+	pgConn *conn;
+	wxArrayString queries;
+	long runs, warmups;
+	bool serverTimings;
+	wxEvtHandler *caller;
+	long eventId;
+	int seq;
+
+	wxCriticalSection resultsLock;
+	pgBenchmarkResultArray results;
+	long runsDone;
+	bool cancelled;
+};
+
+#endif
@@ -0,0 +1,178 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgCatalogCache.h - Names of a database's objects, for tab completion
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef PGCATALOGCACHE_H
+#define PGCATALOGCACHE_H
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/hashmap.h>
+
+// App headers
+#include "utils/misc.h"
+
+class pgConn;
+class pgCatalogLoader;
+
+// Kinds of names besides the relkinds of pg_class; tabcomplete.c uses the
+// same letters
+#define PGCATALOG_SCHEMA        'n'
+#define PGCATALOG_FUNCTION      'F'
+#define PGCATALOG_AGGREGATE     'A'
+#define PGCATALOG_TYPE          'T'
+#define PGCATALOG_DOMAIN        'D'
+
+// Caches no longer used by any query tool which are kept for the next one
+#define PGCATALOGCACHE_MAX_IDLE 4
+
+
+// A name as tab completion offers it: quoted if need be, and for types as
+// format_type() shows it
+typedef struct pgCatalogName
+{
+	const char *name;       // without the schema, UTF-8
+	const char *qualName;   // after the schema; only differs for types
+	const char *schema;
+	OID oid;
+	char kind;
+	bool visible;           // found through the search path
+} pgCatalogName;
+
+
+// The names of a database at one time; never changed once built, so it can
+// be read without locking. The strings are kept in blocks which never move,
+// the names sorted by name, and by schema and qualified name.
+class pgCatalogNames
+{
+public:
+	pgCatalogNames();
+	~pgCatalogNames();
+
+	void Add(const char *name, const char *qualName, const char *schema, OID oid, char kind, bool visible);
+	// Sorts the names; nothing may be added afterwards
+	void Finish();
+
+	size_t GetCount() const
+	{
+		return count;
+	}
+	const pgCatalogName &Item(size_t index) const
+	{
+		return names[index];
+	}
+
+	// The names (by name) starting with a prefix; returns the first index
+	size_t FindPrefix(const char *prefix, size_t &end) const;
+	// The names in a schema (by qualified name) starting with a prefix
+	size_t FindQualifiedPrefix(const char *schema, const char *prefix, size_t &end) const;
+	const pgCatalogName &QualifiedItem(size_t index) const
+	{
+		return *qualified[index];
+	}
+
+	size_t GetSchemaCount() const
+	{
+		return schemaCount;
+	}
+	const pgCatalogName &SchemaItem(size_t index) const
+	{
+		return *schemas[index];
+	}
+
+	// The visible relation of a name, or NULL
+	const pgCatalogName *FindRelation(const char *name) const;
+
+private:
+	const char *Store(const char *str);
+
+	pgCatalogName *names;
+	size_t count, allocated;
+	const pgCatalogName **qualified;
+	const pgCatalogName **schemas;
+	size_t schemaCount;
+
+	wxArrayPtrVoid blocks;
+	size_t blockUsed;
+};
+
+WX_DECLARE_HASH_MAP(OID, wxArrayString, wxIntegerHash, wxIntegerEqual, pgCatalogColumnHash);
+
+
+// The names of the schemas, relations, functions and types of a database,
+// answering the tab completion of the query tool without asking the
+// server. They are loaded in the background, on a connection of their own,
+// when a query tool first connects to the database, and loaded again when
+// the query tool runs DDL or the browser is refreshed; until then, the
+// names loaded before keep being used. A schema refreshed in the browser
+// is loaded on its own. The columns of a relation are asked for when they
+// are first completed, and kept.
+//
+// There is a cache for each database, user and search path, shared by the
+// query tools using it. It is only used from the main thread.
+class pgCatalogCache : public wxEvtHandler
+{
+public:
+	// Returns the cache for a connection, which starts loading if it's new;
+	// each call must be balanced with Detach()
+	static pgCatalogCache *Attach(pgConn *conn);
+	void Detach();
+
+	// The names of a database (of a schema only, if given) changed
+	static void Invalidate(pgConn *conn, const wxString &schema = wxEmptyString);
+	static void Cleanup();
+
+	// Whether there are names to complete from; starts loading them again
+	// if they are out of date
+	bool IsReady(pgConn *conn);
+
+	// The completions of text among the names of the given kinds, as
+	// tab-complete's schema queries find them on the server: visible names,
+	// schema names if several schemas match and names qualified with the
+	// schema if only one does. Names in pg_catalog are left out unless
+	// asked for, or the text starts with pg_.
+	void Complete(const char *text, const char *kinds, bool systemNames, wxArrayString &result) const;
+	void CompleteSchemas(const char *text, wxArrayString &result) const;
+
+	// The visible relation of a name, or 0
+	OID FindRelation(const char *name) const;
+	bool GetColumns(OID relation, wxArrayString &columns) const;
+	void SetColumns(OID relation, const wxArrayString &columns);
+
+private:
+	pgCatalogCache(const wxString &key, const wxString &databaseKey, const wxString &searchPath);
+	~pgCatalogCache();
+
+	static wxString GetDatabaseKey(pgConn *conn);
+
+	void Load(pgConn *conn);
+	void StopLoading();
+	void OnLoaded(wxCommandEvent &ev);
+
+	wxString key, databaseKey, searchPath;
+	int references;
+	wxDateTime lastUsed;
+
+	pgCatalogNames *names;
+	pgCatalogColumnHash columns;
+
+	// Out of date: everything, or only some schemas
+	bool stale;
+	wxArrayString staleSchemas;
+	// Not tried again until something changes
+	bool loadFailed;
+
+	pgCatalogLoader *loader;
+	pgConn *loaderConn;
+
+	DECLARE_EVENT_TABLE()
+};
+
+#endif
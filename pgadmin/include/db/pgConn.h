@@ -30,7 +30,8 @@ enum
 	PGCONN_DNSERR,
 	PGCONN_ABORTED,     // connect user aborted
 	PGCONN_BROKEN,       // tcp/pipe broken
-	PGCONN_SSHTUNNEL_ERROR
+	PGCONN_SSHTUNNEL_ERROR,
+	PGCONN_CONNECTING    // asynchronous connect in progress
 };
 
 enum
@@ -54,6 +55,13 @@ enum
 	PGCONN_TXSTATUS_UNKNOWN = PQTRANS_UNKNOWN
 };
 
+// Interval, in milliseconds, at which threads waiting for the results of a
+// query look for a cancel request
+#define PGCONN_CANCEL_CHECK_INTERVAL    100
+
+// Asked by pgConn::WaitForResult() whether to cancel the query
+typedef bool (*pgCancelCheck)(void *arg);
+
 // Our version of a pgNotify
 typedef struct pgNotification
 {
@@ -79,9 +87,35 @@ typedef struct pgError
 	wxString source_function;
 	wxString formatted_msg;
 
-	void SetError(PGresult *_res = NULL, wxMBConv *_conv = NULL);
+	// The offset (in characters) is added to the position of the error, for
+	// a statement sent on its own out of a longer text
+	void SetError(PGresult *_res = NULL, wxMBConv *_conv = NULL, long _posOffset = 0);
 } pgError;
 
+// Cached pg_type information, shared by all result sets of a connection
+typedef struct pgTypeInfo
+{
+	OID baseType;
+	wxString typeName;
+	wxString fullTypeName;
+} pgTypeInfo;
+
+WX_DECLARE_STRING_HASH_MAP(pgTypeInfo, pgTypeInfoHash);
+
+// A statement in the prepared statement cache (an empty name marks a query
+// which could not be prepared)
+typedef struct pgCachedStatement
+{
+	wxString name;
+	// All result columns can be fetched in binary format
+	bool binary;
+	// Some of them are timestamps, formatted according to the DateStyle
+	bool hasTimestamp;
+} pgCachedStatement;
+
+// Prepared statements, keyed by the normalized query text
+WX_DECLARE_STRING_HASH_MAP(pgCachedStatement, pgStatementCacheHash);
+
 class pgConn
 {
 public:
@@ -90,7 +124,7 @@ public:
 	       int port = 5432, const wxString &rolename = wxT(""), int sslmode = 0, OID oid = 0,
 	       const wxString &applicationname = wxT("pgAdmin"),
 	       const wxString &sslcert = wxT(""), const wxString &sslkey = wxT(""), const wxString &sslrootcert = wxT(""), const wxString &sslcrl = wxT(""),
-	       const bool sslcompression = true);
+	       const bool sslcompression = true, const bool async = false);
 	~pgConn();
 
 	bool IsSuperuser();
@@ -128,7 +162,32 @@ public:
 
 	void Close();
 	bool Reconnect();
-	bool ExecuteVoid(const wxString &sql, bool reportError = true);
+
+	// Asynchronous connect, for connections created with async = true:
+	// call PollConnect() whenever WaitForConnect() reports the socket is
+	// ready, until it returns something other than PGCONN_CONNECTING. The
+	// first call resolves the host name, which blocks, and the last one runs
+	// the setup queries; so they are for a worker thread (see
+	// pgServerConnectThread).
+	bool IsConnecting() const
+	{
+		return connecting;
+	}
+	bool WaitForConnect(long timeout);
+	int PollConnect();
+
+	// For threads running a query sent with PQsendQuery(): the next result,
+	// or NULL when there are no more or the connection broke (failed is
+	// set then). Every PGCONN_CANCEL_CHECK_INTERVAL ms, cancelCheck(arg)
+	// tells whether to send a cancel request.
+	PGresult *WaitForResult(pgCancelCheck cancelCheck, void *arg, bool &failed);
+	// Block until the server sent more data, or until timeout (ms) has
+	// passed; false if the connection is broken
+	bool WaitForInput(long timeout);
+
+	// elapsed, if given, is set to the time (ms) the server round trip took,
+	// without the bookkeeping around it
+	bool ExecuteVoid(const wxString &sql, bool reportError = true, double *elapsed = NULL);
 	wxString ExecuteScalar(const wxString &sql, bool reportError = true);
 	pgSet *ExecuteSet(const wxString &sql, bool reportError = true);
 	void CancelExecution(void);
@@ -254,6 +313,11 @@ public:
 
 	void Reset();
 
+	// Return the session to the state of a new connection, so that it can
+	// be handed out again by pgConnPool
+	bool ResetSession();
+	void SetApplicationName(const wxString &applicationname);
+
 	bool StartCopy(const wxString query);
 	bool PutCopyData(const char *data, long count);
 	bool EndPutCopy(const wxString errormsg);
@@ -261,10 +325,57 @@ public:
 
 	bool TableHasColumn(wxString schemaname, wxString tblname, const wxString &colname);
 
+	// A thread running queries on the connection (pgQueryThread and the
+	// like) owns it until they are done; other threads only query through
+	// it, for themselves, when it isn't owned
+	void LockExecution()
+	{
+		executionLock.Lock();
+	}
+	void UnlockExecution()
+	{
+		executionLock.Unlock();
+	}
+	bool TryLockExecution()
+	{
+		return executionLock.TryLock() == wxMUTEX_NO_ERROR;
+	}
+
+	// Type metadata cache for result set columns
+	bool LoadTypeInfo(const pgSet *set);
+	bool LookupTypeInfo(OID typoid, long typmod, pgTypeInfo &info);
+	void InvalidateTypeCache();
+	void CheckCacheInvalidation(PGresult *res);
+
+	// Prepared statement cache for repeated (catalog) queries run through
+	// ExecuteSet() and ExecuteScalar()
+	void EnableStatementCache(bool enable);
+	bool IsStatementCacheEnabled() const
+	{
+		return stmtCacheEnabled;
+	}
+	long GetStatementCacheHits() const
+	{
+		return stmtCacheHits;
+	}
+	long GetStatementCacheMisses() const
+	{
+		return stmtCacheMisses;
+	}
+	void InvalidateStatementCache();
+
+	// Fetch the results of cached statements in binary format, where all
+	// result columns are of types pgSet can decode natively
+	void EnableBinaryResults(bool enable)
+	{
+		binaryResults = enable;
+	}
+
 protected:
 	PGconn   *conn;
 	PGcancel *m_cancelConn;
 	wxMutex   m_cancelConnMutex;
+	wxMutex   executionLock;
 	int lastResultStatus;
 
 	int connStatus;
@@ -284,14 +395,30 @@ protected:
 	PQnoticeProcessor noticeProc;
 	static double libpqVersion;
 
+	pgTypeInfoHash typeCache;
+	wxCriticalSection typeCacheLock;
+
+	PGresult *ExecuteCached(const wxString &sql, bool allowBinary);
+
+	pgStatementCacheHash stmtCache;
+	wxCriticalSection stmtCacheLock;
+	bool stmtCacheEnabled, binaryResults;
+	long stmtCacheHits, stmtCacheMisses, stmtCounter;
+
 	friend class pgQueryThread;
+	friend class pgExportThread;
+	friend class pgFileExecThread;
+	friend class pgConnPool;
 
 private:
 	bool DoConnect();
+	bool StartConnect(bool useLibcConnStr);
 	bool Initialize();
 
 	wxString qtString(const wxString &value);
 
+	bool connecting, connectWrite, connectLibc;
+
 	bool features[32];
 	int minorVersion, majorVersion, patchVersion;
 	bool isEdb;
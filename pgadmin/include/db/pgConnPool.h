@@ -0,0 +1,86 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgConnPool.h - Pool of idle connections shared by the tool windows
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef PGCONNPOOL_H
+#define PGCONNPOOL_H
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/timer.h>
+
+// App headers
+#include "db/pgConn.h"
+
+// Usage counters of the connections to one server
+typedef struct pgConnPoolStats
+{
+	long acquired;      // connections requested from the pool
+	long reused;        // ... which were served by an idle connection
+	long released;      // connections kept for reuse
+	long discarded;     // connections closed instead of being (re)used
+} pgConnPoolStats;
+
+WX_DECLARE_STRING_HASH_MAP(pgConnPoolStats, pgConnPoolStatsHash);
+
+// An idle connection
+typedef struct pgConnPoolEntry
+{
+	pgConn *conn;
+	wxString serverKey, database;
+	wxDateTime idleSince;
+} pgConnPoolEntry;
+
+WX_DEFINE_ARRAY_PTR(pgConnPoolEntry *, pgConnPoolEntryArray);
+
+// Connections of closed tool windows are reset and kept open, keyed by
+// server, database, user and role, so that the next window opened on the
+// same database doesn't have to wait for a new connection to be set up.
+// The pool is only used from the main thread.
+class pgConnPool : public wxTimer
+{
+public:
+	static pgConnPool *Get();
+	static void Cleanup();
+
+	static wxString MakeServerKey(const wxString &server, const wxString &service, const wxString &hostaddr,
+	                              int port, const wxString &username, const wxString &rolename, int sslmode);
+	static wxString MakeServerKey(pgConn *conn);
+
+	// Returns an idle connection which passed the health check, or NULL
+	// if the caller has to open a new one
+	pgConn *Acquire(const wxString &serverKey, const wxString &database, const wxString &applicationname);
+
+	// Hand a connection back instead of deleting it; it is closed if it
+	// can't be reset, or too many connections are idle already
+	void Release(pgConn *conn);
+
+	// Close the idle connections to a server (or all of them)
+	void Clear(const wxString &serverKey = wxEmptyString);
+
+	pgConnPoolStats GetStats(const wxString &serverKey);
+	int GetIdleCount(const wxString &serverKey);
+
+	void Notify();
+
+private:
+	pgConnPool();
+	~pgConnPool();
+
+	void Discard(pgConnPoolEntry *entry);
+	void ExpireIdle();
+
+	pgConnPoolEntryArray idle;
+	pgConnPoolStatsHash stats;
+
+	static pgConnPool *instance;
+};
+
+#endif
@@ -0,0 +1,109 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgExportThread.h - Write the result of a query to a file
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef PGEXPORTTHREAD_H
+#define PGEXPORTTHREAD_H
+
+#include <wx/wx.h>
+#include "db/pgConn.h"
+#include "db/pgExportWriter.h"
+
+class pgSet;
+
+
+// Runs a query on its own and writes the rows to a file as they arrive,
+// so the memory used doesn't depend on the size of the result. Plain
+// queries are wrapped into COPY ... TO STDOUT where the export options
+// can be expressed in CSV terms; all others are fetched row by row.
+// Of several statements, the last one returning rows is written.
+// Result sets already fetched can be written as well, optionally only the
+// rows listed, in that order; the set must not be changed until the thread
+// has finished.
+class pgExportThread : public wxThread
+{
+public:
+	pgExportThread(pgConn *conn, const wxString &query, const pgExportOptions &options,
+	               wxEvtHandler *caller, long eventId);
+	pgExportThread(pgSet *set, const pgExportOptions &options, const long *rowOrder = NULL, long rowCount = -1);
+	~pgExportThread();
+
+	void *Entry();
+	void Cancel();
+
+	// Progress; may be called while the thread is running
+	void GetProgress(long &rows, wxLongLong &bytes);
+	long GetEstimatedRows()
+	{
+		return estimatedRows;
+	}
+
+	// Results; only valid after the thread has finished
+	bool Succeeded()
+	{
+		return succeeded;
+	}
+	bool Cancelled()
+	{
+		return cancelled;
+	}
+	bool UsedCopy()
+	{
+		return usedCopy;
+	}
+	long GetSkipped()
+	{
+		return skipped;
+	}
+	wxString GetError()
+	{
+		return error;
+	}
+
+private:
+	bool ExportQuery();
+	bool CanUseCopy(PGresult *desc);
+	bool ExportCopy(PGresult *desc);
+	bool ExportRows();
+	bool ExportSet();
+	void EstimateRows();
+
+	PGresult *NextResult();
+	bool CheckCancel();
+	static bool CancelCheck(void *arg);
+
+	bool WriteHeader(PGresult *res);
+	bool RowWritten();
+
+	pgConn *conn;
+	wxString query;
+	pgExportOptions options;
+	wxEvtHandler *caller;
+	long eventId;
+
+	pgSet *set;
+	const long *rowOrder;
+	wxArrayString setNames;
+	wxArrayInt setClasses;
+
+	pgExportWriter *writer;
+
+	wxCriticalSection progressLock;
+	long rows;
+	wxLongLong bytes;
+	long estimatedRows;
+
+	bool cancelled;
+	bool succeeded, usedCopy;
+	long skipped;
+	wxString error;
+};
+
+#endif
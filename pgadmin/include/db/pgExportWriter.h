@@ -0,0 +1,117 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgExportWriter.h - Buffered writer of export files
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef PGEXPORTWRITER_H
+#define PGEXPORTWRITER_H
+
+#include <wx/wx.h>
+#include <wx/wfstream.h>
+#include <wx/zstream.h>
+
+// Size at which the formatted rows are written to the export file
+#define PGEXPORT_BUFFER_SIZE    (1024 * 1024)
+
+// How the data is to be written, as chosen in frmExport
+typedef struct pgExportOptions
+{
+	wxString filename;
+	wxString colSeparator;
+	wxString quoteChar;
+	wxString rowSeparator;
+	int quoting;            // 0=none 1=string 2=all
+	bool unicode;           // else the local charset
+	bool colNames;
+	bool compress;          // gzip the file
+} pgExportOptions;
+
+
+// Formats rows into a reusable byte buffer, and writes it to the export file
+// in large blocks. The values are handed in the encoding of the data (the
+// client encoding of the connection), so that quoting works on the bytes as
+// they are; the buffer is converted to the charset of the file as a whole.
+// Rows which can't be converted are skipped.
+class pgExportWriter
+{
+public:
+	pgExportWriter(const pgExportOptions &options, wxMBConv &conv);
+	~pgExportWriter();
+
+	// Open (or truncate) and close the file
+	bool Open();
+	bool Close();
+
+	// Type classes of the columns of the rows to follow, for quoting
+	void SetColumns(const wxArrayInt &typClasses);
+
+	bool WriteHeader(const wxArrayString &names);
+
+	// Add a value to the current row, and finish the row
+	void AddValue(int col, const char *value, size_t len)
+	{
+		AddField(col, value, len, quoteCols.Item(col) != 0);
+	}
+	bool EndRow();
+
+	// A row formatted already, without the row separator
+	bool WriteRow(const char *data, size_t len);
+
+	wxLongLong GetBytes() const
+	{
+		return bytes;
+	}
+	long GetSkipped() const
+	{
+		return skipped;
+	}
+	wxString GetError() const
+	{
+		return error;
+	}
+
+private:
+	void AddField(int col, const char *value, size_t len, bool quote);
+	const char *FindQuote(const char *data, const char *end) const;
+	void Append(const char *data, size_t len)
+	{
+		if (buffered + len > bufferSize)
+			Grow(len);
+		memcpy(buffer + buffered, data, len);
+		buffered += len;
+	}
+	void Grow(size_t len);
+
+	bool Flush();
+	bool FlushRows();
+	bool WriteFile(const char *data, size_t len);
+
+	pgExportOptions options;
+	wxMBConv &conv;
+	wxMBConv &fileConv;
+	bool convert;
+
+	wxCharBuffer colSeparator, quoteChar, rowSeparator;
+	size_t colSeparatorLen, quoteCharLen, rowSeparatorLen;
+	wxArrayInt quoteCols;
+
+	char *buffer;
+	size_t buffered, bufferSize;
+	// Where the rows in the buffer end, if it needs to be converted
+	wxArrayLong rowEnds;
+
+	wxFileOutputStream *file;
+	wxZlibOutputStream *zip;
+
+	wxLongLong bytes;
+	long skipped;
+	wxString error;
+};
+
+#endif
@@ -0,0 +1,124 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgFileExecThread.h - Run the statements of a SQL file as it is read
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef PGFILEEXECTHREAD_H
+#define PGFILEEXECTHREAD_H
+
+#include <wx/wx.h>
+#include <wx/file.h>
+#include "db/pgConn.h"
+#include "utils/sqlLexer.h"
+
+// Bytes read from the file at a time
+#define PGFILEEXEC_BUFFER_SIZE  262144
+
+// Characters of a failed statement kept to be shown
+#define PGFILEEXEC_STATEMENT_LENGTH 1000
+
+
+// Runs the statements of a SQL file, such as a plain dump or a migration,
+// one after the other, in autocommit mode as psql does. The file is read a
+// buffer at a time, and only the statement being run is kept in memory, so
+// the size of the file doesn't matter. The data of COPY ... FROM stdin
+// following its statement is sent to the server as it is read. psql
+// commands are skipped, except for \connect, which stops the run.
+//
+// The run stops at the first error; it can be resumed from the start of
+// the failed statement by starting another thread at its offset.
+class pgFileExecThread : public wxThread
+{
+public:
+	pgFileExecThread(pgConn *conn, const wxString &fileName, bool utf8, wxFileOffset startOffset, long startLine,
+	                 wxEvtHandler *caller, long eventId);
+	~pgFileExecThread();
+
+	void *Entry();
+	void Cancel();
+
+	// Progress; may be called while the thread is running
+	void GetProgress(wxFileOffset &offset, long &statements);
+	wxString GetMessagesAndClear();
+	wxFileOffset GetLength() const
+	{
+		return length;
+	}
+
+	// Results; only valid after the thread has finished
+	bool Succeeded() const
+	{
+		return succeeded;
+	}
+	bool Cancelled() const
+	{
+		return cancelled;
+	}
+	wxString GetError() const
+	{
+		return error;
+	}
+	// The statement which failed (or was running when cancelled), and
+	// where it starts in the file, to resume from
+	wxString GetFailedStatement() const
+	{
+		return failedStatement;
+	}
+	wxFileOffset GetResumeOffset() const
+	{
+		return resumeOffset;
+	}
+	long GetResumeLine() const
+	{
+		return resumeLine;
+	}
+
+private:
+	bool Fill();
+	void Consumed(size_t count);
+	bool RunStatement();
+	bool CopyIn();
+	void Fail(const wxString &msg);
+
+	PGresult *NextResult();
+	bool CheckCancel();
+
+	static bool CancelCheck(void *arg);
+	static void NoticeProcessor(void *arg, const char *message);
+
+	pgConn *conn;
+	wxString fileName;
+	wxMBConv *fileConv;
+	wxEvtHandler *caller;
+	long eventId;
+
+	wxFile file;
+	wxFileOffset length;
+	char *buffer;
+	size_t bufferLength, bufferPos;
+	bool eof;
+
+	sqlLexer lexer;
+	wxMemoryBuffer statement;
+	// Of the byte after the last one consumed, and of the statement start
+	wxFileOffset offset, statementOffset;
+	long line, statementLine;
+
+	wxCriticalSection progressLock;
+	long statements;
+	wxString messages;
+
+	bool cancelled;
+	bool succeeded;
+	wxString error, failedStatement;
+	wxFileOffset resumeOffset;
+	long resumeLine;
+};
+
+#endif
@@ -0,0 +1,138 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgLoadTest.h - Concurrent clients running a script in a loop
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef PGLOADTEST_H
+#define PGLOADTEST_H
+
+#include <wx/wx.h>
+#include <wx/dynarray.h>
+
+#include "db/pgQueryStats.h"
+
+class pgConn;
+class pgQueryThread;
+class pgQueryResultEvent;
+
+// Most clients a load test may have
+#define PGLOADTEST_MAX_CLIENTS  100
+
+
+// One of the clients: a connection of its own, and a thread running the
+// statements on it
+class pgLoadTestClient
+{
+public:
+	pgLoadTestClient(int number);
+
+	int number;
+	pgConn *conn;
+	pgQueryThread *thread;
+
+	// Statement of the script running now
+	size_t statement;
+	// Milliseconds spent on the statements of the current iteration
+	double iterationTime;
+	// A failed iteration left a transaction open, which is rolled back
+	// before the script is run again
+	bool rollingBack;
+
+	long transactions, errors;
+	bool finished;
+};
+
+WX_DEFINE_ARRAY_PTR(pgLoadTestClient *, pgLoadTestClientArray);
+
+
+// Runs a script of statements on a number of duplicates of a connection at
+// once, each client running it over and over (a closed loop, as pgbench
+// does) until a number of iterations is done or some time has passed. An
+// iteration of the script is counted as a transaction; its latency is the
+// time its statements took to execute, as measured by the client threads.
+//
+// The clients are driven from the events of their threads, on the UI
+// thread, which is where the figures must be read. The caller is sent an
+// event with the given id once all clients have finished.
+class pgLoadTest : public wxEvtHandler
+{
+public:
+	pgLoadTest(pgConn *conn, const wxString &script, int clients, long seconds, long iterations,
+	           wxEvtHandler *caller, long eventId);
+	~pgLoadTest();
+
+	// Opens the connections, and starts the clients
+	bool Start();
+	// Cancels the running statements, and closes the connections
+	void Stop();
+
+	bool IsRunning() const
+	{
+		return running;
+	}
+	// Why the test couldn't start, or the last statement error
+	const wxString &GetLastError() const
+	{
+		return lastError;
+	}
+
+	// Seconds since the start, up to the end
+	double GetElapsed() const;
+	long GetTransactions() const
+	{
+		return transactions;
+	}
+	long GetErrors() const
+	{
+		return errors;
+	}
+	double GetTps() const;
+	double GetAverageLatency() const;
+	// Transactions by latency; see pgQueryStats::GetBucketLabel()
+	long GetHistogram(int bucket) const
+	{
+		return histogram[bucket];
+	}
+
+	const pgLoadTestClientArray &GetClients() const
+	{
+		return clients;
+	}
+	// Jain's index of the transactions done by the clients: 1 if all did
+	// the same, down to 1/clients if one did all
+	double GetFairness() const;
+
+private:
+	void RunNext(pgLoadTestClient *client);
+	void Finish();
+	bool TimeIsUp() const;
+
+	void OnResult(pgQueryResultEvent &ev);
+
+	pgConn *conn;
+	wxArrayString statements;
+	int clientCount;
+	long seconds, iterations;
+	wxEvtHandler *caller;
+	long eventId;
+
+	pgLoadTestClientArray clients;
+	bool running;
+	wxStopWatch stopwatch;
+	long elapsed;
+
+	long transactions, errors;
+	double totalLatency;
+	long histogram[PGQUERYSTATS_BUCKETS];
+	wxString lastError;
+
+	DECLARE_EVENT_TABLE()
+};
+
+#endif
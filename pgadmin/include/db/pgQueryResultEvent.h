@@ -18,12 +18,15 @@
 class pgBatchQuery;
 
 extern const wxEventType PGQueryResultEvent;
+// Raised for every batch of rows, while a query result is being streamed
+extern const wxEventType PGQueryRowsEvent;
 
 
 class pgQueryResultEvent : public wxCommandEvent
 {
 public:
-	pgQueryResultEvent(unsigned long _thrdId, pgBatchQuery *_qry, int _id = 0);
+	pgQueryResultEvent(unsigned long _thrdId, pgBatchQuery *_qry, int _id = 0,
+	                   wxEventType _type = PGQueryResultEvent);
 	pgQueryResultEvent(const pgQueryResultEvent &_ev);
 
 	// Required for sending with wxPostEvent()
@@ -76,4 +79,8 @@ typedef void (wxEvtHandler::*pgQueryResultEventFunc)(pgQueryResultEvent &);
 	DECLARE_EVENT_TABLE_ENTRY(PGQueryResultEvent, id1, id2, \
 	pgQueryResultEventHandler(fn), (wxObject*) NULL),
 
+#define EVT_PGQUERYROWS(id, fn)                                  \
+	DECLARE_EVENT_TABLE_ENTRY(PGQueryRowsEvent, id, wxID_ANY,    \
+	pgQueryResultEventHandler(fn), (wxObject*) NULL),
+
 #endif // PGQUERYRESULTEVENT_H
@@ -0,0 +1,107 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgQueryStats.h - Client side statistics of the queries sent
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef PGQUERYSTATS_H
+#define PGQUERYSTATS_H
+
+// wxWindows headers
+#include <wx/wx.h>
+
+// PostgreSQL headers
+#include <libpq-fe.h>
+
+// Number of latency buckets; see pgQueryStats::GetBucketLabel()
+#define PGQUERYSTATS_BUCKETS    12
+
+// Longest fingerprint kept, in characters
+#define PGQUERYSTATS_FINGERPRINT_LEN    1000
+
+// Aggregated statistics of one query fingerprint sent from one caller
+typedef struct pgQueryStatsEntry
+{
+	wxString fingerprint;
+	wxString caller;
+	long calls;
+	long uiCalls;           // calls which blocked the UI thread
+	long rows;
+	wxLongLong bytes;       // size of the values received
+	wxLongLong totalTime;   // wall time, in milliseconds
+	long maxTime;
+	long histogram[PGQUERYSTATS_BUCKETS];
+} pgQueryStatsEntry;
+
+WX_DECLARE_STRING_HASH_MAP(pgQueryStatsEntry, pgQueryStatsHash);
+WX_DECLARE_OBJARRAY(pgQueryStatsEntry, pgQueryStatsArray);
+
+// Collects timings, row counts and result sizes of the queries sent by
+// pgConn and pgQueryThread, by query fingerprint (the text with literals
+// replaced) and caller. Safe to use from any thread.
+class pgQueryStats
+{
+public:
+	// Init() is called on the main thread at startup, once the settings
+	// are loaded; Get() may be called from any thread after that
+	static void Init();
+	static pgQueryStats *Get();
+	static void Cleanup();
+
+	static wxString Fingerprint(const wxString &sql);
+	static wxLongLong ResultBytes(const PGresult *res);
+	static int GetBucket(long elapsed);
+	static wxString GetBucketLabel(int bucket);
+
+	bool IsEnabled() const
+	{
+		return enabled;
+	}
+	void Enable(bool enable)
+	{
+		enabled = enable;
+	}
+
+	// entryPoint names the function which sent the query; the caller is
+	// taken from the current pgQueryStatsCaller on the UI thread
+	void Record(const wxString &sql, const wxString &entryPoint, long elapsed, long rows, wxLongLong bytes);
+	void Record(const wxString &sql, const wxString &entryPoint, long elapsed, const PGresult *res);
+
+	void GetEntries(pgQueryStatsArray &result);
+	void Clear();
+
+	bool ExportCSV(const wxString &filename);
+	bool ExportJSON(const wxString &filename);
+
+private:
+	pgQueryStats();
+
+	wxCriticalSection lock;
+	pgQueryStatsHash entries;
+	bool enabled;
+
+	static pgQueryStats *instance;
+	static wxString currentCaller;
+
+	friend class pgQueryStatsCaller;
+};
+
+// Names the UI code sending queries while it is in scope, for example
+//     pgQueryStatsCaller caller(wxT("Table properties"));
+class pgQueryStatsCaller
+{
+public:
+	pgQueryStatsCaller(const wxString &caller);
+	~pgQueryStatsCaller();
+
+private:
+	wxString previous;
+	bool active;
+};
+
+#endif
@@ -14,12 +14,14 @@
 
 #include "wx/wx.h"
 #include "wx/event.h"
+#include "wx/stopwatch.h"
 #include "db/pgConn.h"
 
 // Forward declaration
 class pgSet;
 class pgQueryThread;
 class pgBatchQuery;
+class pgQueryResultEvent;
 
 // Support for the IN & INOUT parameters type
 class pgParam : public wxObject
@@ -89,6 +91,34 @@ protected:
 
 WX_DEFINE_ARRAY_PTR(pgParam *, pgParamsArray);
 
+// Plans an EXECUTE of a prepared statement may have used
+enum
+{
+	PGPLAN_NONE,        // not an EXECUTE
+	PGPLAN_PREPARED,    // not known (before PostgreSQL 14)
+	PGPLAN_GENERIC,     // the cached generic plan
+	PGPLAN_CUSTOM       // one made for the parameter values
+};
+
+// How a statement went, of a query run a statement at a time
+class pgStatementTiming
+{
+public:
+	pgStatementTiming()
+		: offset(0), rows(-1), elapsed(0), plan(PGPLAN_NONE), failed(false)
+	{
+	}
+
+	wxString statement;
+	long     offset;        // of the statement in the query (characters)
+	wxString command;       // the command tag, such as "UPDATE 12"
+	long     rows;          // rows returned or affected, or -1
+	double   elapsed;       // milliseconds
+	int      plan;
+	bool     failed;
+};
+WX_DECLARE_OBJARRAY(pgStatementTiming, pgStatementTimingArray);
+
 class pgBatchQuery : public wxObject
 {
 public:
@@ -97,7 +127,8 @@ public:
 	             int _resultToRetrieve = 0)
 		: m_query(_query), m_params(_params), m_eventID(_eventId), m_data(_data),
 		  m_useCallable(_useCallable), m_resToRetrieve(_resultToRetrieve),
-		  m_returnCode(-1), m_resultSet(NULL), m_rowsInserted(-1), m_insertedOid(-1)
+		  m_returnCode(-1), m_resultSet(NULL), m_rowsInserted(-1), m_insertedOid(-1),
+		  m_elapsed(-1)
 	{
 		// Do not honour the empty query string
 		wxASSERT(!_query.IsEmpty());
@@ -126,8 +157,19 @@ public:
 		return m_rowsInserted;
 	}
 
+	// Milliseconds from sending the query until its result was complete
+	double          Elapsed()
+	{
+		return m_elapsed;
+	}
+
 	const wxString &GetErrorMessage();
 
+	const pgStatementTimingArray &GetStatementTimings()
+	{
+		return m_timings;
+	}
+
 protected:
 	wxString           m_query;         // Query
 	pgParamsArray     *m_params;        // parameters
@@ -140,7 +182,11 @@ protected:
 	long               m_rowsInserted;  // No of rows inserted
 	Oid                m_insertedOid;   // Inserted Oid
 	wxString           m_message;       // Message generated during query execution
+	double             m_elapsed;       // Execution time (ms)
 	pgError            m_err;           // Error
+	wxArrayString      m_statements;    // Run one at a time, if any
+	wxArrayInt         m_offsets;       // Of the statements in the query
+	pgStatementTimingArray m_timings;   // Of the statements run so far
 
 private:
 	// Do not allow copy construction and '=' operator (shadow copying)
@@ -186,6 +232,37 @@ public:
 
 	void SetEventOnCancellation(bool eventOnCancelled);
 
+	// Send the queued queries to the server at once in pipeline mode,
+	// when the server (PostgreSQL 14+) and libpq support it. Only for
+	// queries with a single statement each.
+	void EnablePipelining(bool enable);
+	bool IsPipelining() const
+	{
+		return m_pipelining;
+	}
+
+	// Hand the rows of the result over to the caller in batches (as
+	// PGQueryRowsEvent), while they are still arriving from the server
+	void SetStreaming(long batchRows, wxLongLong memoryLimit = 0);
+	bool IsStreaming() const
+	{
+		return m_streamBatchRows > 0;
+	}
+	// To be called by the receiver of a PGQueryRowsEvent
+	pgSet *AppendStreamedRows(pgQueryResultEvent &ev, bool &newSet);
+
+	// Run the last query queued as these statements of it, one after the
+	// other, timing each; the offsets are those of the statements in the
+	// query, in characters. Not for queries with parameters.
+	void SetStatements(const wxArrayString &statements, const wxArrayInt &offsets);
+	// To be read once the query is complete
+	const pgStatementTimingArray &GetStatementTimings(int _idx = -1) const
+	{
+		if (_idx == -1)
+			_idx = m_currIndex;
+		return m_queries[_idx < 0 ? 0 : _idx]->m_timings;
+	}
+
 	void AddQuery(
 	    const wxString &_qry, pgParamsArray *_params = NULL,
 	    long _eventId = 0, void *_data = NULL, bool _useCallable = false,
@@ -211,6 +288,12 @@ public:
 		return (_idx >= 0 && _idx > m_currIndex ? NULL : m_queries[_idx]->m_resultSet);
 	}
 
+#ifdef __WXDEBUG__
+	// Hold a set made up by the caller as the result of a query, without
+	// running the thread; for timing the result grid without a server
+	void SetTestResult(const wxString &_qry, pgSet *_set);
+#endif
+
 	int ReturnCode(int _idx = -1) const
 	{
 		if (_idx == -1)
@@ -232,10 +315,7 @@ public:
 		return (_idx >= 0 && _idx > m_currIndex ? -1L : m_queries[_idx]->m_insertedOid);
 	}
 
-	inline void CancelExecution()
-	{
-		m_cancelled = true;
-	}
+	void CancelExecution();
 
 	inline size_t GetNumberQueries()
 	{
@@ -251,12 +331,32 @@ public:
 	void AppendMessage(const wxString &_str);
 
 	int DeleteReleasedQueries();
+	// Forgets the queries executed before the current one, for callers
+	// queueing queries on the thread for long. The events of those queries
+	// must have been handled.
+	int DeleteExecutedQueries();
 
 	pgError GetResultError(int idx = -1);
 
 private:
 	int Execute();
+	int StoreResult(PGresult *result, bool streamed);
 	int RaiseEvent(int _retval = 0);
+	bool WaitForServer(bool write = false);
+
+	bool ExecutePipeline();
+	bool WaitForPipeline(bool &cancelSent);
+
+	bool SendStatement(size_t index);
+	void StatementResult(PGresult *res);
+	void FinishStatement();
+	bool GetPlanCounts(const wxString &name, long &generic, long &custom);
+
+	void StreamRow(PGresult *res);
+	void PostStreamedRows(bool force);
+	void FinishStreamedSet(PGresult *res);
+	void DiscardStreamedRows();
+	void RaiseRowsEvent(PGresult *rows);
 
 	// Queries to be executed
 	pgBatchQueryArray  m_queries;
@@ -272,10 +372,16 @@ private:
 	bool               m_multiQueries;
 	// Use EDB callable statement (if available and require)
 	bool               m_useCallable;
+	// Send the queued queries in pipeline mode
+	bool               m_pipelining;
 	// Is executing a query
 	bool               m_executing;
 	// Queries are being accessed at this time
 	wxMutex            m_queriesLock;
+	// Protects queueing of new queries and the cancellation flag
+	wxMutex            m_queueLock;
+	// Signalled when a new query is queued or the execution is cancelled
+	wxCondition        m_queueCondition;
 	// When one thread is accesing messages, other should not be able to access it
 	wxCriticalSection  m_criticalSection;
 	// Event Handler
@@ -285,6 +391,40 @@ private:
 	// Notice Handler
 	void              *m_noticeHandler;
 
+	// Streaming of result rows (disabled, if the batch size is 0)
+	long               m_streamBatchRows;
+	wxLongLong         m_streamMemoryLimit;
+	// Rows received, but not yet handed over
+	PGresult          *m_streamBatch;
+	// Result set being streamed, and its rows/memory used so far
+	int                m_streamSeq;
+	long               m_streamRows;
+	long               m_streamPrevRows;
+	wxLongLong         m_streamBytes;
+	bool               m_streamLimitReached;
+	bool               m_streamPosted;
+	wxLongLong         m_streamLastPost;
+	// Result set the receiver is building (only used by the receiver)
+	int                m_streamSetSeq;
+
+	// Started when the current query is sent
+	wxStopWatch        m_queryWatch;
+
+	// Of a query run a statement at a time: the statement being run, and
+	// when it was sent; the prepared statement it executes, with the plans
+	// made for that before
+	size_t             m_statement;
+	wxStopWatch        m_statementWatch;
+	wxString           m_preparedName;
+	long               m_genericPlans;
+	long               m_customPlans;
+	// Added to the positions of the errors in the statement sent
+	long               m_posOffset;
+
+	// Rows and bytes received for the current query (see pgQueryStats)
+	long               m_statsRows;
+	wxLongLong         m_statsBytes;
+
 };
 
 #endif
@@ -32,6 +32,9 @@ typedef enum
 
 class pgConn;
 
+WX_DECLARE_STRING_HASH_MAP(int, pgSetColumnHash);
+WX_DECLARE_HASH_MAP(wxLongLong_t, char *, wxIntegerHash, wxIntegerEqual, pgSetTextHash);
+
 // Class declarations
 class pgSet
 {
@@ -99,7 +102,9 @@ public:
 	}
 	bool IsNull(const int col) const
 	{
-		return (PQgetisnull(res, pos - 1, col) != 0);
+		int row;
+		PGresult *r = RowResult(pos - 1, row);
+		return (PQgetisnull(r, row, col) != 0);
 	}
 	int ColScale(const int col) const;
 	int ColNumber(const wxString &colName) const;
@@ -126,11 +131,35 @@ public:
 	char *GetCharPtr(const int col) const;
 	char *GetCharPtr(const wxString &col) const;
 
+	// Text of a value of any row, leaving the current row alone
+	char *GetValueAt(long row, const int col) const;
+	bool IsNullAt(long row, const int col) const;
+	int GetLengthAt(long row, const int col) const;
+
+	// The results holding the rows, for scanning many rows at once; firstRow
+	// is set to the number of the first row in the result
+	size_t GetResultCount() const
+	{
+		return chunks.GetCount() + 1;
+	}
+	PGresult *GetResult(size_t n, long &firstRow) const;
+
 	wxMBConv &GetConversion() const
 	{
 		return conv;
 	}
 
+	// Append further rows of a streamed result (takes ownership of the chunk)
+	void AppendChunk(PGresult *chunk);
+
+	// Can columns of this type be fetched in binary format? These are
+	// decoded to native values directly, and only formatted as text when
+	// asked for.
+	static bool CanFetchBinary(OID typoid);
+
+	// Type class of a column type, as used for quoting and alignment
+	static pgTypClass TypClassFromOid(OID typoid);
+
 	wxString GetCommandStatus() const
 	{
 		if (res)
@@ -144,11 +173,48 @@ protected:
 	pgConn *conn;
 	PGresult *res;
 	long pos, nRows, nCols;
-	wxString ExecuteScalar(const wxString &sql) const;
 	wxMBConv &conv;
 	bool needColQuoting;
+	// Result fetched in binary format
+	bool binary;
+	// Text of the binary values returned by GetCharPtr(), by row and column
+	mutable pgSetTextHash binaryTexts;
+	mutable bool colTypesResolved;
 	mutable wxArrayString colTypes, colFullTypes;
-	wxArrayInt colClasses;
+	mutable wxArrayInt colClasses;
+
+	// Column name to column number lookup, built once per result
+	pgSetColumnHash colNumbers;
+
+	// Rows of streamed results arriving after the first result, and the
+	// row number each of these chunks starts with
+	wxArrayPtrVoid chunks;
+	wxArrayLong chunkStarts;
+	long firstChunkRows;
+	mutable size_t lastChunk;
+
+	PGresult *RowResult(long row, int &chunkRow) const
+	{
+		if (row < firstChunkRows || chunks.IsEmpty())
+		{
+			chunkRow = row;
+			return res;
+		}
+		return ChunkForRow(row, chunkRow);
+	}
+	PGresult *ChunkForRow(long row, int &chunkRow) const;
+	size_t FindChunk(long row) const;
+	char *ValuePtr(const int col) const;
+
+	bool IsBinaryNative(const int col) const;
+	wxInt64 BinaryInt(const int col) const;
+	double BinaryDouble(const int col) const;
+	wxDateTime BinaryDateTime(const int col) const;
+	wxString FormatBinary(const int col) const;
+
+	void BuildColNumbers();
+	int LookupColNumber(const wxString &colname) const;
+	void ResolveColTypes() const;
 };
 
 
@@ -0,0 +1,53 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// dlgLoadTest.h - Run a script with a number of concurrent clients
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef DLGLOADTEST_H
+#define DLGLOADTEST_H
+
+#include <wx/timer.h>
+
+#include "dlg/dlgClasses.h"
+
+class pgConn;
+class pgLoadTest;
+
+
+// Runs the query of the query tool with a number of clients at once, and
+// shows how it went while it runs, pgbench style
+class dlgLoadTest : public pgDialog
+{
+public:
+	dlgLoadTest(wxWindow *parent, pgConn *conn, const wxString &script);
+	~dlgLoadTest();
+
+private:
+	void Start();
+	void Stop();
+	void EnableControls();
+	void ShowResults();
+
+	void OnStart(wxCommandEvent &ev);
+	void OnStop(wxCommandEvent &ev);
+	void OnLimit(wxCommandEvent &ev);
+	void OnComplete(wxCommandEvent &ev);
+	void OnTimer(wxTimerEvent &ev);
+	void OnClose(wxCommandEvent &ev);
+	void OnCloseWindow(wxCloseEvent &ev);
+
+	pgConn *conn;
+	wxString script;
+	pgLoadTest *loadTest;
+	wxTimer timer;
+
+	DECLARE_EVENT_TABLE()
+};
+
+#endif
@@ -0,0 +1,57 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// dlgQueryBenchmark.h - Repeated, timed runs of a query
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef DLGQUERYBENCHMARK_H
+#define DLGQUERYBENCHMARK_H
+
+#include "dlg/dlgClasses.h"
+#include "db/pgBenchmark.h"
+
+class pgConn;
+
+
+// Runs a query of the query tool a number of times, optionally next to a
+// variant of it, and shows how long the runs took
+class dlgQueryBenchmark : public pgDialog
+{
+public:
+	dlgQueryBenchmark(wxWindow *parent, pgConn *conn, const wxString &query);
+	~dlgQueryBenchmark();
+
+private:
+	void Start();
+	void Stop();
+	void EnableControls();
+	void ShowResults();
+	void ShowHistogram();
+	void Export();
+
+	void OnStart(wxCommandEvent &ev);
+	void OnStop(wxCommandEvent &ev);
+	void OnCompare(wxCommandEvent &ev);
+	void OnExport(wxCommandEvent &ev);
+	void OnProgress(wxCommandEvent &ev);
+	void OnClose(wxCommandEvent &ev);
+	void OnCloseWindow(wxCloseEvent &ev);
+
+	pgConn *conn;
+	// Of the benchmark, if run on a connection of its own
+	pgConn *benchConn;
+	wxString query;
+
+	pgBenchmarkThread *thread;
+	int seq;
+	pgBenchmarkResultArray results;
+
+	DECLARE_EVENT_TABLE()
+};
+
+#endif
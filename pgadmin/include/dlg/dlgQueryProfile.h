@@ -0,0 +1,57 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// dlgQueryProfile.h - Client query profile
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef DLGQUERYPROFILE_H
+#define DLGQUERYPROFILE_H
+
+#include <wx/wx.h>
+
+#include "db/pgQueryStats.h"
+#include "frm/menu.h"
+
+class ctlListView;
+
+
+// Shows the statistics collected by pgQueryStats
+class dlgQueryProfile : public wxDialog
+{
+public:
+	dlgQueryProfile(wxWindow *parent);
+
+private:
+	void Populate();
+	void ShowHistogram(long item);
+	void Export(bool json);
+
+	void OnSelect(wxListEvent &ev);
+	void OnEnable(wxCommandEvent &ev);
+	void OnRefresh(wxCommandEvent &ev);
+	void OnReset(wxCommandEvent &ev);
+	void OnExportCSV(wxCommandEvent &ev);
+	void OnExportJSON(wxCommandEvent &ev);
+	void OnClose(wxCommandEvent &ev);
+
+	ctlListView *lstQueries, *lstHistogram;
+	wxCheckBox *chkEnabled;
+	pgQueryStatsArray entries;
+
+	DECLARE_EVENT_TABLE()
+};
+
+
+class queryProfileFactory : public actionFactory
+{
+public:
+	queryProfileFactory(menuFactoryList *list, wxMenu *mnu, ctlMenuToolbar *toolbar);
+	wxWindow *StartDialog(frmMain *form, pgObject *obj);
+};
+
+#endif
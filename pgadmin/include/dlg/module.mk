@@ -35,6 +35,7 @@ pgadmin3_SOURCES += \
 	include/dlg/dlgIndex.h \
 	include/dlg/dlgIndexConstraint.h \
 	include/dlg/dlgLanguage.h \
+	include/dlg/dlgLoadTest.h \
 	include/dlg/dlgMainConfig.h \
 	include/dlg/dlgManageFavourites.h \
 	include/dlg/dlgMoveTablespace.h \
@@ -42,6 +43,8 @@ pgadmin3_SOURCES += \
 	include/dlg/dlgPackage.h \
 	include/dlg/dlgPgpassConfig.h \
 	include/dlg/dlgProperty.h \
+	include/dlg/dlgQueryBenchmark.h \
+	include/dlg/dlgQueryProfile.h \
 	include/dlg/dlgReassignDropOwned.h \
 	include/dlg/dlgRole.h \
 	include/dlg/dlgRule.h \
@@ -17,6 +17,7 @@ class ctlSQLResult;
 class pgSet;
 
 #include "dlg/dlgClasses.h"
+#include "db/pgExportThread.h"
 
 // Class declarations
 class frmExport : public pgDialog
@@ -25,7 +26,8 @@ public:
 	frmExport(wxWindow *parent);
 	~frmExport();
 
-	bool Export(pgSet *set);
+	bool Export(pgSet *set, const long *rowOrder = NULL, long rowCount = -1);
+	pgExportOptions GetOptions();
 
 private:
 	void OnChange(wxCommandEvent &ev);
@@ -51,6 +51,8 @@ class propertyFactory;
 class pluginUtilityFactory;
 class ctlMenuButton;
 
+WX_DEFINE_ARRAY_PTR(pgServer *, pgServerArray);
+
 // A plugin utility
 typedef struct PluginUtility
 {
@@ -138,6 +140,9 @@ public:
 	};
 	void StoreServers();
 	int ReconnectServer(pgServer *server, bool restore = true);
+	bool StartConnectServer(pgServer *server);
+	void ForgetConnectingServer(pgServer *server);
+	void ConnectAllServers();
 	void ReportConnError(pgServer *server);
 	pgServerCollection *GetServerCollection()
 	{
@@ -204,6 +209,11 @@ private:
 
 	bool m_refreshing;
 
+	// Servers connecting in the background, and when they started
+	pgServerArray connectingServers;
+	wxArrayLong connectStarted;
+	wxTimer connectTimer;
+
 	wxTreeItemId denyCollapseItem;
 	pgObject *currentObject;
 	wxControl *currentControl;
@@ -243,6 +253,8 @@ private:
 	void OnCopy(wxCommandEvent &ev);
 
 	void OnCheckAlive(wxCommandEvent &event);
+	void OnConnectTimer(wxTimerEvent &event);
+	void ShowConnectProgress();
 
 	void OnPositionStc(wxStyledTextEvent &event);
 
@@ -277,7 +289,8 @@ enum
 	CTL_STATVIEW,
 	CTL_DEPVIEW,
 	CTL_REFVIEW,
-	CTL_SQLPANE
+	CTL_SQLPANE,
+	TIMER_CONNECT_ID
 };
 
 class contentsFactory : public actionFactory
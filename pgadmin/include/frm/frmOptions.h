@@ -42,6 +42,7 @@ private:
 	void OnResetHints(wxCommandEvent &ev);
 	void OnChangeCopyQuote(wxCommandEvent &ev);
 	void OnChangeSQLUseCustomColour(wxCommandEvent &ev);
+	void OnChangePrepareCatalogQueries(wxCommandEvent &ev);
 	void OnTreeSelChanged(wxTreeEvent &event);
 	wxString CheckColour(wxString colour);
 	void UpdateColourControls();
@@ -48,27 +48,21 @@
 
 class ExplainCanvas;
 class ctlSQLResult;
+class ctlStatementTimings;
 class pgsApplication;
 class pgScriptTimer;
+class queryHistory;
+class pgFileExecThread;
 
 class QueryExecInfo
 {
 public:
-	QueryExecInfo()
-	{
-		toFileExportForm = NULL;
-	}
-	~QueryExecInfo()
-	{
-		if (toFileExportForm)
-			delete toFileExportForm;
-	}
-
 	int queryOffset;
-	frmExport *toFileExportForm;
 	bool singleResult;
 	bool explain;
 	bool verbose;
+	// Run a statement at a time
+	bool timed;
 };
 
 enum
@@ -126,14 +120,23 @@ private:
 	ctlSQLBox *sqlQuery;
 	ctlAuiNotebook *outputPane;
 	ctlSQLResult *sqlResult;
+	wxPanel *pnlResult;
+	wxTextCtrl *txtFilter;
+	wxStaticText *stFilterRows;
 	ExplainCanvas *explainCanvas;
 	wxTextCtrl *msgResult, *msgHistory;
+	ctlStatementTimings *statementTimings;
 	wxBitmapComboBox *cbConnection;
 	wxTextCtrl *scratchPad;
+	wxTextCtrl *txtHistoryFilter;
 	wxComboBox *sqlQueries;
 	wxButton *btnDeleteCurrent;
 	wxButton *btnDeleteAll;
-	wxArrayString histoQueries;
+	queryHistory *history;
+	// The entries of the history listed in sqlQueries, and whether the list
+	// is up to date (it's filled when it's dropped down)
+	wxArrayInt historyShown;
+	bool historyListed;
 
 	ctlAuiNotebook *sqlQueryBook;  //container for all SQL tabs
 	size_t sqlQueryCounter;  //for initial tab names
@@ -144,6 +147,16 @@ private:
 	wxTimer timer;
 	wxLongLong elapsedQuery, startTimeQuery;
 
+	// "Execute to file" writes the rows as they arrive
+	pgExportThread *exportThread;
+
+	// "Execute SQL file" runs a file without loading it into the editor, and
+	// remembers where it stopped to resume from
+	pgFileExecThread *fileExecThread;
+	wxString fileExecPath;
+	wxFileOffset fileExecOffset;
+	long fileExecLine;
+
 	// pgScript interface
 	pgsApplication *pgScript;
 	wxString pgsOutputString;
@@ -185,9 +198,16 @@ private:
 	void OnHelp(wxCommandEvent &event);
 	void OnCancel(wxCommandEvent &event);
 	void OnExecute(wxCommandEvent &event);
+	void OnExecuteStatement(wxCommandEvent &event);
 	void OnExecScript(wxCommandEvent &event);
 	void OnExecFile(wxCommandEvent &event);
+	void OnExecSqlFile(wxCommandEvent &event);
 	void OnExplain(wxCommandEvent &event);
+	void OnBenchmark(wxCommandEvent &event);
+	void OnLoadTest(wxCommandEvent &event);
+#ifdef __WXDEBUG__
+	void OnTimeResultGrid(wxCommandEvent &event);
+#endif
 	void OnCommit(wxCommandEvent &event);
 	void OnRollback(wxCommandEvent &event);
 	void OnBuffers(wxCommandEvent &event);
@@ -209,6 +229,7 @@ private:
 	void OnSaveHistory(wxCommandEvent &event);
 	void OnAutoRollback(wxCommandEvent &event);
 	void OnAutoCommit(wxCommandEvent &event);
+	void OnTimeStatements(wxCommandEvent &event);
 	void OnChangeConnection(wxCommandEvent &ev);
 	void OnClearHistory(wxCommandEvent &event);
 	void OnActivate(wxActivateEvent &event);
@@ -249,9 +270,19 @@ private:
 	void updateMenu(bool allowUpdateModelSize = true);
 	void execQuery(const wxString &query, int resultToRetrieve = 0, bool singleResult = false, const int queryOffset = 0, bool toFile = false, bool explain = false, bool verbose = false);
 	void OnQueryComplete(pgQueryResultEvent &ev);
+	void OnQueryRows(pgQueryResultEvent &ev);
 	void completeQuery(bool done, bool explain, bool verbose);
 	bool isBeginNotRequired(wxString query);
+	void CheckCatalogChanges(const wxString &query);
 	void OnScriptComplete(wxCommandEvent &ev);
+	void OnExportComplete(wxCommandEvent &ev);
+	void OnFileExecComplete(wxCommandEvent &ev);
+	void OnFilterText(wxCommandEvent &ev);
+	void OnFilterComplete(wxCommandEvent &ev);
+	void UpdateFilterRows();
+	void ShowExportProgress();
+	void StartFileExec(const wxString &path, wxFileOffset offset, long line);
+	void ShowFileExecProgress();
 	void setTools(const bool running);
 	void showMessage(const wxString &msg, const wxString &msgShort = wxT(""));
 	int GetLineEndingStyle();
@@ -261,8 +292,10 @@ private:
 	void OnMacroManage(wxCommandEvent &event);
 
 	void LoadQueries();
-	void SaveQueries();
+	void ListQueries();
 	void OnChangeQuery(wxCommandEvent &event);
+	void OnDropDownQueries(wxCommandEvent &event);
+	void OnHistoryFilter(wxCommandEvent &event);
 
 	wxBitmap CreateBitmap(const wxColour &colour);
 	wxColour GetServerColour(pgConn *connection);
@@ -341,9 +374,12 @@ enum
 	CTL_TIMERFRM,
 	CTL_NTBKGQB,
 	CTL_SQLQUERYCBOX,
+	CTL_HISTORYFILTER,
 	CTL_DELETECURRENTBTN,
 	CTL_DELETEALLBTN,
-	CTL_SCRATCHPAD
+	CTL_SCRATCHPAD,
+	CTL_RESULTFILTER,
+	CTL_STATEMENTTIMINGS
 };
 
 ///////////////////////////////////////////////////////
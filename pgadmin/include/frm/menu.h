@@ -80,6 +80,12 @@ enum
 	MNU_CHECKALIVE,
 	MNU_SELECTALL,
 	MNU_EXECPGS,
+	MNU_BENCHMARK,
+	MNU_LOADTEST,
+	MNU_TIMERESULTGRID,
+	MNU_EXECSQLFILE,
+	MNU_EXECSTATEMENT,
+	MNU_TIMESTATEMENTS,
 
 	MNU_CONTENTS,
 	MNU_HELP,
@@ -98,6 +104,9 @@ enum
 	MNU_SHOWLINENUMBER,
 	MNU_SHOWINDENTGUIDES,
 	MNU_QUICKREPORT,
+	MNU_SORT_ASCENDING,
+	MNU_SORT_DESCENDING,
+	MNU_SORT_NONE,
 
 	MNU_UPPER_CASE,
 	MNU_LOWER_CASE,
@@ -142,6 +151,12 @@ enum
 	// This is used by the Query Tool - the event is fired when the query completes
 	QUERY_COMPLETE = MNU_MACROS_MANAGE + 100,
 	PGSCRIPT_COMPLETE,
+	EXPORT_COMPLETE,
+	FILTER_COMPLETE,
+	COLUMN_WIDTHS,
+	BENCHMARK_PROGRESS,
+	LOADTEST_COMPLETE,
+	FILEEXEC_COMPLETE,
 
 	// This is a dummy menu item
 	MNU_DUMMY = QUERY_COMPLETE + 1000,
@@ -70,6 +70,10 @@ public:
 	{
 		return server->CreateConn(GetName(), GetOid(), applicationname);
 	}
+	pgConn *CreatePooledConn(const wxString &applicationname)
+	{
+		return server->CreatePooledConn(GetName(), GetOid(), applicationname);
+	}
 
 	wxString GetPrettyOption() const
 	{
@@ -12,6 +12,9 @@
 #ifndef PGSERVER_H
 #define PGSERVER_H
 
+// wxWindows headers
+#include <wx/thread.h>
+
 #include "db/pgConn.h"
 #include "pgCollection.h"
 
@@ -41,6 +44,27 @@ extern pgServerFactory serverFactory;
 class CSSHTunnelThread;
 #endif
 
+// Makes the browser connection of a server started with async, and reads
+// what the browser shows of the server; see pgServer::StartConnect()
+class pgServerConnectThread : public wxThread
+{
+public:
+	pgServerConnectThread(pgServer *_server)
+		: wxThread(wxTHREAD_JOINABLE), server(_server), cancelled(false)
+	{
+	}
+
+	void *Entry();
+	void Cancel();
+	bool CheckCancel();
+
+private:
+	pgServer *server;
+
+	wxCriticalSection cancelLock;
+	bool cancelled;
+};
+
 class pgServer : public pgObject
 {
 public:
@@ -60,6 +84,16 @@ public:
 	}
 	wxString GetTranslatedMessage(int kindOfMessage) const;
 	int Connect(frmMain *form, bool askPassword = true, const wxString &pwd = wxEmptyString, bool forceStorePassword = false, bool askTunnelPassword = false);
+	int StartConnect(frmMain *form, bool askPassword, const wxString &pwd, bool forceStorePassword, bool askTunnelPassword, bool async);
+	bool IsConnecting() const
+	{
+		return connectThread != NULL;
+	}
+	bool IsConnectDone()
+	{
+		return connectThread && !connectThread->IsAlive();
+	}
+	int EndConnect(frmMain *form);
 	bool Disconnect(frmMain *form);
 	void StorePassword();
 	bool GetPasswordIsStored();
@@ -215,6 +249,8 @@ public:
 	}
 
 	pgConn *CreateConn(wxString dbName = wxEmptyString, OID oid = 0, wxString applicationname = wxEmptyString);
+	pgConn *CreatePooledConn(wxString dbName = wxEmptyString, OID oid = 0, wxString applicationname = wxEmptyString);
+	wxString GetConnPoolKey();
 
 	wxString GetLastDatabase() const
 	{
@@ -534,6 +570,18 @@ private:
 	pgConn *conn;
 	long serverIndex;
 	bool connected, passwordValid, autovacuumRunning;
+	bool connectStorePassword, connectForceStorePassword, connectDefaultDb;
+
+	pgServerConnectThread *connectThread;
+
+	void RunConnect(pgServerConnectThread *thread);
+	void CancelConnect();
+	void ReadServerDetails();
+	int FinishConnect(frmMain *form, bool async);
+	pgConn *OpenBrowserConn(const wxString &dbName, bool async);
+	bool IsMissingDefaultDb();
+
+	friend class pgServerConnectThread;
 	wxString service, hostaddr, database, username, password, rolename, ver, error;
 	wxString lastDatabase, lastSchema, description, serviceId, discoveryId;
 	wxDateTime upSince;
@@ -666,6 +714,13 @@ public:
 };
 
 
+class connectAllServersFactory : public actionFactory
+{
+public:
+	connectAllServersFactory(menuFactoryList *list, wxMenu *mnu, ctlMenuToolbar *toolbar);
+	wxWindow *StartDialog(frmMain *form, pgObject *obj);
+};
+
 class disconnectServerFactory : public contextActionFactory
 {
 public:
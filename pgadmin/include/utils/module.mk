@@ -22,7 +22,10 @@ pgadmin3_SOURCES += \
 	include/utils/sysProcess.h \
 	include/utils/sysSettings.h \
 	include/utils/utffile.h \
-	include/utils/macros.h
+	include/utils/macros.h \
+	include/utils/queryHistory.h \
+	include/utils/sqlLexer.h \
+	include/utils/sqlStatementIndex.h
 
 if BUILD_SSH_TUNNEL
 pgadmin3_SOURCES += \
@@ -0,0 +1,119 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// queryHistory.h - History of the queries executed in the Query Tool
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef QUERYHISTORY_H
+#define QUERYHISTORY_H
+
+#include <wx/wx.h>
+#include <wx/dynarray.h>
+#include <wx/ffile.h>
+
+// Number of characters of a query kept in the index, to be shown
+#define QUERYHISTORY_TITLE_LENGTH   256
+
+// Size the log may grow by with entries no longer in the history before it
+// is rewritten (bytes)
+#define QUERYHISTORY_COMPACT_SIZE   262144
+
+
+class queryHistoryEntry
+{
+public:
+	// The start of the query on one line
+	wxString title;
+
+	// When the query was executed (ms since the epoch), how long it ran
+	// (ms) and the number of rows it returned or affected
+	wxLongLong time;
+	long duration;
+	long rows;
+	wxString server, database;
+
+	// Position of the entry in the log, and of the query within it
+	wxFileOffset offset, queryOffset;
+	size_t queryLength;
+};
+
+WX_DECLARE_OBJARRAY(queryHistoryEntry, queryHistoryEntryArray);
+
+
+// The history is kept in a log, which is only ever appended to: an entry
+// for every query executed, and records dropping entries again. Each
+// record starts with its length, so the index of the entries is built
+// without reading the (possibly huge) queries themselves, which are read
+// when they are needed only. The log is rewritten with the entries left
+// once enough of it has been dropped. The history of pgAdmin versions
+// keeping it in an XML file is taken over once.
+//
+// Several Query Tool windows may use the log at the same time; the index
+// is read again when another one has written to the log meanwhile.
+class queryHistory
+{
+public:
+	queryHistory(const wxString &xmlFile, size_t maxEntries);
+
+	// Read the index of the log; returns true if it changed
+	bool Load();
+
+	// Oldest entries first
+	size_t GetCount() const
+	{
+		return entries.GetCount();
+	}
+	const queryHistoryEntry &Item(size_t n) const
+	{
+		return entries.Item(n);
+	}
+	wxString GetQuery(size_t n);
+
+	// An earlier entry of the same query is dropped
+	bool Add(const wxString &query, long duration, long rows, const wxString &server, const wxString &database);
+	bool Delete(size_t n);
+	bool Clear();
+
+	// Entries whose title starts with, or contains, the text (ignoring the
+	// case), newest first
+	void Find(const wxString &text, bool prefix, wxArrayInt &found) const;
+	// An entry taken from the index before it was read again, by when it
+	// was executed and its title; -1 if it's gone
+	int Find(const queryHistoryEntry &entry) const;
+
+	static wxString MakeTitle(const wxString &query);
+
+private:
+	bool ReadLog(bool all);
+	bool ReadEntry(wxFFile &file, wxFileOffset offset, size_t length, queryHistoryEntry &entry);
+	bool ImportXml();
+	bool Append(const wxMemoryBuffer &records);
+	bool Compact();
+	void Trim();
+	int FindEntry(wxFileOffset offset) const;
+
+	static void AddEntryRecord(wxMemoryBuffer &buf, const queryHistoryEntry &entry, const wxString &query);
+	static void AddRecord(wxMemoryBuffer &buf, int type, const wxMemoryBuffer &payload);
+
+	wxString xmlFile, logFile;
+	size_t maxEntries;
+
+	queryHistoryEntryArray entries;
+	// Lower case titles, for searching
+	wxArrayString searchTitles;
+
+	// Size of the log as last read or written, and of the entries in it
+	// dropped meanwhile
+	wxFileOffset logLength, droppedLength;
+	// When the log read was written anew, and whether it ends with a record
+	// cut short
+	wxLongLong logStamp;
+	bool damaged;
+};
+
+#endif
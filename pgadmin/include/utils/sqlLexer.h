@@ -0,0 +1,151 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// sqlLexer.h - Incremental splitting of SQL text into statements
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef SQLLEXER_H
+#define SQLLEXER_H
+
+#include <wx/wx.h>
+
+// Longest word remembered, for the keywords the lexer looks for
+#define SQLLEXER_WORD_LENGTH    16
+// Longest tag of a dollar quote, as long as an identifier may be
+#define SQLLEXER_TAG_LENGTH     63
+
+
+// Finds the ends of the statements in SQL text, the way psql does: a
+// semicolon ends a statement unless it's inside a string, a quoted
+// identifier, a dollar quoted string, a comment, parentheses or the
+// BEGIN ... END body of a function. Lines starting with a backslash at the
+// start of a statement are psql commands, which end at the end of the line.
+//
+// The text is given a chunk at a time, of any size, and may be split
+// anywhere. The lexer works on bytes, of UTF-8 or any other encoding
+// keeping ASCII characters as single bytes, so all positions are byte
+// offsets. The state is small, and can be copied to resume from later.
+class sqlLexer
+{
+public:
+	enum
+	{
+		LEX_NORMAL,
+		LEX_QUOTE,              // '...'
+		LEX_EXTENDED_QUOTE,     // E'...', with backslash escapes
+		LEX_IDENTIFIER,         // "..."
+		LEX_LINE_COMMENT,       // -- ...
+		LEX_BLOCK_COMMENT,      // /* ... */, which nest
+		LEX_DOLLAR_TAG,         // $tag of an opening $tag$
+		LEX_DOLLAR,             // $tag$ ... $tag$
+		LEX_META                // \command ...
+	};
+
+	sqlLexer();
+
+	// Forgets everything, for a new text
+	void Reset();
+
+	// Scans up to len bytes, and returns how many were consumed: all of them,
+	// or those up to and including the semicolon (or newline) which ended a
+	// statement (or psql command), in which case end is set. The lexer is
+	// then ready for the next statement.
+	size_t Scan(const char *data, size_t len, bool &end);
+	// The text ended without ending the statement; finishes its last word
+	void Finish()
+	{
+		EndWord();
+	}
+
+	// Splits a whole text into its statements, without the terminating
+	// semicolons, the psql commands and what's only white space and comments;
+	// the offsets of the statements in the text (in characters) are added to
+	// offsets, if given
+	static wxArrayString Split(const wxString &text, wxArrayInt *offsets = NULL);
+
+	// Whether the statement scanned so far has anything but white space and
+	// comments, that is whether it's a statement at all
+	bool HasContent() const
+	{
+		return content || pendingContent;
+	}
+	// Whether the statement which just ended was a psql command
+	bool IsMetaCommand() const
+	{
+		return meta;
+	}
+	// The first word of the statement, in lower case, such as "copy"
+	wxString GetFirstWord() const;
+	// Where the statement starts after the white space and comments before
+	// it, counted from the end of the previous one, or -1 if it hasn't yet
+	long GetContentStart() const
+	{
+		return contentStart;
+	}
+
+	// Whether the position after the bytes scanned is in the middle of a
+	// string, quoted identifier or comment
+	int GetState() const
+	{
+		return state;
+	}
+	bool IsInLiteral() const
+	{
+		return state != LEX_NORMAL && state != LEX_META;
+	}
+	int GetParenDepth() const
+	{
+		return parenDepth;
+	}
+
+private:
+	void StartStatement();
+	void EndWord();
+	bool IsFunctionStatement() const;
+
+	static bool IsIdentStart(unsigned char c)
+	{
+		return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c >= 0x80;
+	}
+	static bool IsIdentChar(unsigned char c)
+	{
+		return IsIdentStart(c) || (c >= '0' && c <= '9') || c == '$';
+	}
+
+	int state;
+	// The byte before the current one, where it matters
+	unsigned char prev;
+
+	int commentDepth;
+	// Of dollar quotes: the tag including both dollar signs, and how much of
+	// it was matched so far at the end of the string
+	char tag[SQLLEXER_TAG_LENGTH + 2];
+	size_t tagLength, tagMatched;
+	bool escaped;
+
+	int parenDepth, beginDepth;
+	bool content, pendingContent, meta;
+	// The statement has ended; the next byte starts a new one
+	bool ended;
+	// Bytes of the statement scanned by the calls to Scan() before
+	long scanned, contentStart;
+	// Of the quote just closed, which a doubled quote reopens
+	int lastQuote;
+
+	// The word being scanned, if it's an identifier or keyword, and the
+	// initials of the first few words (as psql has it, to tell a CREATE
+	// FUNCTION with a BEGIN ATOMIC body)
+	char word[SQLLEXER_WORD_LENGTH + 1];
+	size_t wordLength;
+	bool inWord, wordIsIdent;
+	char firstWord[SQLLEXER_WORD_LENGTH + 1];
+	char initials[4];
+	int wordCount;
+};
+
+#endif
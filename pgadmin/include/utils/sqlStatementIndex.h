@@ -0,0 +1,88 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// sqlStatementIndex.h - Statements of an editor, kept up to date as it is edited
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef SQLSTATEMENTINDEX_H
+#define SQLSTATEMENTINDEX_H
+
+#include <wx/wx.h>
+#include "utils/sqlLexer.h"
+
+class wxStyledTextCtrl;
+
+// Bytes of the text read at a time
+#define SQLSTATEMENTINDEX_CHUNK 65536
+
+
+typedef struct sqlStatementInfo
+{
+	// Right after the end of the previous statement
+	int start;
+	// After the white space and comments before it, or -1 if there is only
+	// white space and comments
+	int contentStart;
+	// By a semicolon, or the newline of a psql command; only the last
+	// statement may not be
+	bool terminated;
+	bool meta;
+	// Parentheses were left open
+	bool unbalanced;
+	char firstWord[SQLLEXER_WORD_LENGTH + 1];
+} sqlStatementInfo;
+
+
+// Where the statements of the text of an editor start and end, as sqlLexer
+// splits it. The editor reports each change, which only moves the
+// statements after it; the statements the changes touched are lexed again
+// when the index is next used, up to the first statement which ends where
+// one ended before, since the lexer starts each statement afresh.
+//
+// Positions are those of the editor, in bytes.
+class sqlStatementIndex
+{
+public:
+	sqlStatementIndex();
+	~sqlStatementIndex();
+
+	// Text was inserted (a positive length) or deleted at a position
+	void Changed(int pos, int length);
+	// Lexes what changed since the last time
+	void Update(wxStyledTextCtrl *text);
+
+	size_t GetCount() const
+	{
+		return count;
+	}
+	const sqlStatementInfo &Item(size_t index) const
+	{
+		return items[index];
+	}
+	// The start of the next statement, or the end of the text
+	int GetEnd(size_t index) const
+	{
+		return index + 1 < count ? items[index + 1].start : length;
+	}
+
+	// The statement holding a position, or -1 if the text is empty
+	int FindStatement(int pos) const;
+
+private:
+	int FindStart(int pos, size_t from) const;
+
+	sqlStatementInfo *items;
+	size_t count, allocated;
+	int length;
+
+	// The changed range, in the positions of the text as it is now
+	bool dirty;
+	int dirtyFrom, dirtyTo;
+};
+
+#endif
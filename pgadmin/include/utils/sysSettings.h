@@ -239,6 +239,16 @@ public:
 	{
 		WriteBool(wxT("Export/Unicode"), newval);
 	}
+	bool GetExportCompress() const
+	{
+		bool b;
+		Read(wxT("Export/Compress"), &b, false);
+		return b;
+	}
+	void SetExportCompress(const bool newval)
+	{
+		WriteBool(wxT("Export/Compress"), newval);
+	}
 	bool GetWriteBOM() const
 	{
 		bool b;
@@ -323,6 +333,70 @@ public:
 	{
 		WriteBool(wxT("ShowSystemObjects"), newval);
 	}
+	bool GetPrepareCatalogQueries() const
+	{
+		bool b;
+		Read(wxT("PrepareCatalogQueries"), &b, false);
+		return b;
+	}
+	void SetPrepareCatalogQueries(const bool newval)
+	{
+		WriteBool(wxT("PrepareCatalogQueries"), newval);
+	}
+	bool GetBinaryCatalogResults() const
+	{
+		bool b;
+		Read(wxT("BinaryCatalogResults"), &b, false);
+		return b;
+	}
+	void SetBinaryCatalogResults(const bool newval)
+	{
+		WriteBool(wxT("BinaryCatalogResults"), newval);
+	}
+	// Keep the connections of closed tool windows open for reuse
+	bool GetConnPoolEnabled() const
+	{
+		bool b;
+		Read(wxT("ConnPool/Enabled"), &b, true);
+		return b;
+	}
+	void SetConnPoolEnabled(const bool newval)
+	{
+		WriteBool(wxT("ConnPool/Enabled"), newval);
+	}
+	// Idle connections kept per server
+	long GetConnPoolMaxIdle() const
+	{
+		long l;
+		Read(wxT("ConnPool/MaxIdle"), &l, 2L);
+		return l;
+	}
+	void SetConnPoolMaxIdle(const long newval)
+	{
+		WriteLong(wxT("ConnPool/MaxIdle"), newval);
+	}
+	// Seconds before an idle connection is closed
+	long GetConnPoolIdleTimeout() const
+	{
+		long l;
+		Read(wxT("ConnPool/IdleTimeout"), &l, 300L);
+		return l;
+	}
+	void SetConnPoolIdleTimeout(const long newval)
+	{
+		WriteLong(wxT("ConnPool/IdleTimeout"), newval);
+	}
+	// Client side query statistics (see pgQueryStats)
+	bool GetQueryStatsEnabled() const
+	{
+		bool b;
+		Read(wxT("QueryStats/Enabled"), &b, false);
+		return b;
+	}
+	void SetQueryStatsEnabled(const bool newval)
+	{
+		WriteBool(wxT("QueryStats/Enabled"), newval);
+	}
 
 	// Editor options
 	bool GetSpacesForTabs() const
@@ -385,6 +459,16 @@ public:
 	{
 		WriteBool(wxT("frmQuery/AutoCommit"), newval);
 	}
+	bool GetTimeStatements() const
+	{
+		bool b;
+		Read(wxT("frmQuery/TimeStatements"), &b, false);
+		return b;
+	}
+	void SetTimeStatements(const bool newval)
+	{
+		WriteBool(wxT("frmQuery/TimeStatements"), newval);
+	}
 	wxString GetDecimalMark() const
 	{
 		wxString s;
@@ -714,6 +798,27 @@ public:
 	{
 		WriteLong(wxT("frmQuery/MaxColSize"), newval);
 	}
+	bool GetStreamResults() const
+	{
+		bool b;
+		Read(wxT("frmQuery/StreamResults"), &b, true);
+		return b;
+	}
+	void SetStreamResults(const bool newval)
+	{
+		WriteBool(wxT("frmQuery/StreamResults"), newval);
+	}
+	// Memory ceiling (in MB) for a streamed query result
+	long GetStreamMemoryLimit() const
+	{
+		long l;
+		Read(wxT("frmQuery/StreamMemoryLimit"), &l, 1024L);
+		return l;
+	}
+	void SetStreamMemoryLimit(const long newval)
+	{
+		WriteLong(wxT("frmQuery/StreamMemoryLimit"), newval);
+	}
 	bool GetAskSaveConfirmation() const
 	{
 		bool b;
@@ -62,6 +62,9 @@
 #include "frm/frmSplash.h"
 #include "dlg/dlgSelectConnection.h"
 #include "db/pgConn.h"
+#include "db/pgCatalogCache.h"
+#include "db/pgConnPool.h"
+#include "db/pgQueryStats.h"
 #include "utils/sysLogger.h"
 #include "utils/registry.h"
 #include "frm/frmHint.h"
@@ -222,6 +225,9 @@ bool pgAdmin3::OnInit()
 	// Setup additional helper paths etc. Requires settings!
 	InitXtraPaths();
 
+	// Before any query is sent, by any thread. Requires settings!
+	pgQueryStats::Init();
+
 	locale = new wxLocale();
 	locale->AddCatalogLookupPathPrefix(i18nPath);
 
@@ -838,6 +844,11 @@ int pgAdmin3::OnExit()
 		delete updateThread;
 	}
 
+	// Close the connections left idle by the tool windows
+	pgCatalogCache::Cleanup();
+	pgConnPool::Cleanup();
+	pgQueryStats::Cleanup();
+
 	// Delete the settings object to ensure settings are saved.
 	delete settings;
 
@@ -182,6 +182,9 @@ int pgDatabase::Connect()
 				connected = false;
 				return PGCONN_BAD;
 			}
+
+			conn->EnableStatementCache(settings->GetPrepareCatalogQueries());
+			conn->EnableBinaryResults(settings->GetBinaryCatalogResults());
 		}
 
 		// Now we're connected.
@@ -759,6 +762,11 @@ void pgDatabase::ShowTreeDetail(ctlTree *browser, frmMain *form, ctlListView *pr
 			properties->AppendItem(_("Connection limit"), strConnLimit);
 		}
 		properties->AppendYesNoItem(_("System database?"), GetSystemObject());
+		if (GetConnection() && GetConnection()->IsStatementCacheEnabled())
+			properties->AppendItem(_("Statement cache"),
+			                       wxString::Format(_("%ld hits, %ld misses"),
+			                                        GetConnection()->GetStatementCacheHits(),
+			                                        GetConnection()->GetStatementCacheMisses()));
 		if (GetMissingFKs())
 			properties->AppendItem(_("Old style FKs"), GetMissingFKs());
 		if (!GetSchemaRestriction().IsEmpty())
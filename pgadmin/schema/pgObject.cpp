@@ -15,6 +15,7 @@
 // App headers
 #include "pgAdmin3.h"
 #include "utils/misc.h"
+#include "db/pgQueryStats.h"
 #include "schema/pgObject.h"
 #include "schema/pgServer.h"
 #include "frm/frmMain.h"
@@ -849,6 +850,8 @@ void pgObject::ShowTree(frmMain *form, ctlTree *browser, ctlListView *properties
 
 	wxLogInfo(wxT("Displaying properties for %s %s"), GetTypeName().c_str(), GetIdentifier().c_str());
 
+	pgQueryStatsCaller caller(GetTypeName() + wxT(" properties"));
+
 	if (form)
 	{
 		form->StartMsg(GetTranslatedMessage(RETRIEVINGDETAILS));
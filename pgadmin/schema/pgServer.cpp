@@ -23,6 +23,7 @@
 #include "ctl/ctlMenuToolbar.h"
 #include "frm/menu.h"
 #include "utils/misc.h"
+#include "db/pgConnPool.h"
 #include "frm/frmMain.h"
 #include "frm/frmHint.h"
 #include "dlg/dlgConnect.h"
@@ -68,7 +69,11 @@ pgServer::pgServer(const wxString &newName, const wxString &newHostAddr, const w
 	lastSystemOID = 0;
 
 	conn = NULL;
+	connectThread = NULL;
 	passwordValid = true;
+	connectStorePassword = false;
+	connectForceStorePassword = false;
+	connectDefaultDb = false;
 	storePwd = _storePwd;
 	rolename = newRolename;
 	restore = _restore;
@@ -96,6 +101,11 @@ pgServer::pgServer(const wxString &newName, const wxString &newHostAddr, const w
 
 pgServer::~pgServer()
 {
+	// Dropping a server while it connects leaves nothing for frmMain to poll
+	if (winMain)
+		winMain->ForgetConnectingServer(this);
+	CancelConnect();
+
 	if (conn)
 		delete conn;
 
@@ -251,6 +261,33 @@ pgConn *pgServer::CreateConn(wxString dbName, OID oid, wxString applicationname)
 }
 
 
+// A connection of a tool window, which gives it back to pgConnPool when it
+// is closed; an idle one of the pool is taken if there is any
+pgConn *pgServer::CreatePooledConn(wxString dbName, OID oid, wxString applicationname)
+{
+	if (!connected)
+		return 0;
+
+	pgConn *conn = pgConnPool::Get()->Acquire(GetConnPoolKey(), dbName.IsEmpty() ? GetDatabaseName() : dbName, applicationname);
+	if (conn)
+		return conn;
+
+	return CreateConn(dbName, oid, applicationname);
+}
+
+
+// The key of this server's connections in the pool; they are opened to
+// the local end of the SSH tunnel, if there is one
+wxString pgServer::GetConnPoolKey()
+{
+#if defined(HAVE_OPENSSL_CRYPTO) || defined(HAVE_GCRYPT)
+	if(sshTunnel)
+		return pgConnPool::MakeServerKey(local_listenhost, service, hostaddr, local_listenport, username, rolename, ssl);
+#endif
+	return pgConnPool::MakeServerKey(GetName(), service, hostaddr, port, username, rolename, ssl);
+}
+
+
 wxString pgServer::GetFullName()
 {
 	if (GetDescription().Length() > 0)
@@ -266,6 +303,8 @@ wxString pgServer::GetFullIdentifier()
 
 bool pgServer::Disconnect(frmMain *form)
 {
+	CancelConnect();
+
 #if defined(HAVE_OPENSSL_CRYPTO) || defined(HAVE_GCRYPT)
 	if(tunnelObj)
 	{
@@ -279,6 +318,8 @@ bool pgServer::Disconnect(frmMain *form)
 
 	if (conn)
 	{
+		pgConnPool::Get()->Clear(GetConnPoolKey());
+
 		delete conn;
 		conn = 0;
 		connected = false;
@@ -680,10 +721,25 @@ void pgServer::StorePassword()
 
 
 int pgServer::Connect(frmMain *form, bool askPassword, const wxString &pwd, bool forceStorePassword, bool askTunnelPassword)
+{
+	int status = StartConnect(form, askPassword, pwd, forceStorePassword, askTunnelPassword, false);
+	if (!conn)
+		return status;
+
+	return FinishConnect(form, false);
+}
+
+
+// Open the browser connection of the server; with async, the connection is
+// made by a pgServerConnectThread, and EndConnect() has to be called once
+// IsConnectDone().
+int pgServer::StartConnect(frmMain *form, bool askPassword, const wxString &pwd, bool forceStorePassword, bool askTunnelPassword, bool async)
 {
 	wxLogInfo(wxT("Attempting to create a connection object..."));
 
-	bool storePassword = false;
+	connectStorePassword = false;
+	connectForceStorePassword = forceStorePassword;
+	connectDefaultDb = false;
 
 	if (!conn || conn->GetStatus() != PGCONN_OK)
 	{
@@ -733,7 +789,7 @@ int pgServer::Connect(frmMain *form, bool askPassword, const wxString &pwd, bool
 
 				iSetStorePwd(dlg->GetStorePwd());
 				password = dlg->GetPassword();
-				storePassword = true;
+				connectStorePassword = true;
 				if(dlg)
 				{
 					delete dlg;
@@ -744,10 +800,9 @@ int pgServer::Connect(frmMain *form, bool askPassword, const wxString &pwd, bool
 		else
 			iSetPassword(pwd);
 
-		form->StartMsg(_("Connecting to database"));
+		if (!async)
+			form->StartMsg(_("Connecting to database"));
 
-		wxString host;
-		int iPort;
 #if defined(HAVE_OPENSSL_CRYPTO) || defined(HAVE_GCRYPT)
 		if(sshTunnel)
 		{
@@ -781,7 +836,8 @@ int pgServer::Connect(frmMain *form, bool askPassword, const wxString &pwd, bool
 						wxSafeYield();
 						wxMilliSleep(100);
 						wxSafeYield();
-						form->EndMsg(false);
+						if (!async)
+							form->EndMsg(false);
 						return PGCONN_ABORTED;
 				}
 			}
@@ -790,51 +846,257 @@ int pgServer::Connect(frmMain *form, bool askPassword, const wxString &pwd, bool
 			{
 				if(!createSSHTunnel())
 				{
-					form->EndMsg(false);
+					if (!async)
+						form->EndMsg(false);
 					return PGCONN_SSHTUNNEL_ERROR;
 				}
 			}
-
-			host = local_listenhost;
-			iPort = local_listenport;
 		}
-		else
 #endif
-		{
-			host = GetName();
-			iPort = port;
-		}
 
 		if (database.IsEmpty())
 		{
-			conn = new pgConn(host, service, hostaddr, DEFAULT_PG_DATABASE, username, password, iPort, rolename, ssl, 0, appearanceFactory->GetLongAppName() + _(" - Browser"), sslcert, sslkey, sslrootcert, sslcrl, sslcompression);
-			if (conn->GetStatus() == PGCONN_OK)
-				database = DEFAULT_PG_DATABASE;
-			else if (conn->GetStatus() == PGCONN_BAD && conn->GetLastError().Find(
-			             wxT("database \"") DEFAULT_PG_DATABASE wxT("\" does not exist")) >= 0)
+			connectDefaultDb = true;
+			conn = OpenBrowserConn(DEFAULT_PG_DATABASE, async);
+			if (!async && IsMissingDefaultDb())
 			{
 				delete conn;
-				conn = new pgConn(host, service, hostaddr, wxT("template1"), username, password, iPort, rolename, ssl, 0, appearanceFactory->GetLongAppName() + _(" - Browser"), sslcert, sslkey, sslrootcert, sslcrl, sslcompression);
-				if (conn && conn->GetStatus() == PGCONN_OK)
-					database = wxT("template1");
+				conn = OpenBrowserConn(wxT("template1"), false);
 			}
 		}
 		else
+			conn = OpenBrowserConn(database, async);
+
+		if (!conn)
 		{
-			conn = new pgConn(host, service, hostaddr, database, username, password, iPort, rolename, ssl, 0, appearanceFactory->GetLongAppName() + _(" - Browser"), sslcert, sslkey, sslrootcert, sslcrl, sslcompression);
-			if (!conn)
-			{
+			if (!async)
 				form->EndMsg(false);
-				wxLogError(__("Couldn't create a connection object!"));
+			wxLogError(__("Couldn't create a connection object!"));
+			return PGCONN_BAD;
+		}
+
+		if (async && conn->GetStatus() == PGCONN_CONNECTING)
+		{
+			connectThread = new pgServerConnectThread(this);
+			if (connectThread->Create() != wxTHREAD_NO_ERROR || connectThread->Run() != wxTHREAD_NO_ERROR)
+			{
+				delete connectThread;
+				connectThread = NULL;
+				wxLogError(__("Couldn't start connecting to the server!"));
 				return PGCONN_BAD;
 			}
+			return PGCONN_CONNECTING;
+		}
+	}
+
+	return conn->GetStatus();
+}
+
+
+pgConn *pgServer::OpenBrowserConn(const wxString &dbName, bool async)
+{
+	wxString host = GetName();
+	int iPort = port;
+
+#if defined(HAVE_OPENSSL_CRYPTO) || defined(HAVE_GCRYPT)
+	if(sshTunnel)
+	{
+		host = local_listenhost;
+		iPort = local_listenport;
+	}
+#endif
+
+	return new pgConn(host, service, hostaddr, dbName, username, password, iPort, rolename, ssl, 0, appearanceFactory->GetLongAppName() + _(" - Browser"), sslcert, sslkey, sslrootcert, sslcrl, sslcompression, async);
+}
+
+
+// Without a maintenance database configured, we fall back to template1
+// if the default database doesn't exist
+bool pgServer::IsMissingDefaultDb()
+{
+	return connectDefaultDb && conn->GetStatus() == PGCONN_BAD && conn->GetLastError().Find(
+	           wxT("database \"") DEFAULT_PG_DATABASE wxT("\" does not exist")) >= 0;
+}
+
+
+// Notices can't be shown by the connect thread, so they are only logged
+static void pgServerConnectNotice(void *arg, const char *message)
+{
+	wxLogNotice(wxT("%s"), wxString(message, wxConvUTF8).Trim().c_str());
+}
+
+
+void *pgServerConnectThread::Entry()
+{
+	server->RunConnect(this);
+	return NULL;
+}
+
+
+void pgServerConnectThread::Cancel()
+{
+	wxCriticalSectionLocker lock(cancelLock);
+	cancelled = true;
+}
+
+
+bool pgServerConnectThread::CheckCancel()
+{
+	wxCriticalSectionLocker lock(cancelLock);
+	return cancelled;
+}
+
+
+/*
+ * Run by the connect thread: everything that may wait for the network,
+ * from looking up the host name to the queries after connecting. The
+ * connection is polled, so that a cancel is noticed while the server is
+ * waited for.
+ */
+void pgServer::RunConnect(pgServerConnectThread *thread)
+{
+	conn->RegisterNoticeProcessor(pgServerConnectNotice, this);
+
+	while (!thread->CheckCancel())
+	{
+		if (conn->PollConnect() == PGCONN_CONNECTING)
+		{
+			conn->WaitForConnect(100);
+			continue;
 		}
+
+		if (!IsMissingDefaultDb())
+			break;
+
+		delete conn;
+		conn = OpenBrowserConn(wxT("template1"), true);
+		conn->RegisterNoticeProcessor(pgServerConnectNotice, this);
+		connectDefaultDb = false;
 	}
+
+	if (!thread->CheckCancel() && conn->GetStatus() == PGCONN_OK)
+		ReadServerDetails();
+}
+
+
+void pgServer::CancelConnect()
+{
+	if (!connectThread)
+		return;
+
+	connectThread->Cancel();
+	connectThread->Wait();
+	delete connectThread;
+	connectThread = NULL;
+}
+
+
+int pgServer::EndConnect(frmMain *form)
+{
+	connectThread->Wait();
+	delete connectThread;
+	connectThread = NULL;
+
+	conn->RegisterNoticeProcessor(0, 0);
+	return FinishConnect(form, true);
+}
+
+
+// The privileges of the user and the state of the server
+void pgServer::ReadServerDetails()
+{
+	bool hasUptime = false;
+
+	wxString sql = wxT("SELECT usecreatedb, usesuper");
+	if (conn->BackendMinimumVersion(8, 1))
+	{
+		hasUptime = true;
+		sql += wxT(", CASE WHEN usesuper THEN pg_postmaster_start_time() ELSE NULL END as upsince");
+	}
+	else if (conn->HasFeature(FEATURE_POSTMASTER_STARTTIME))
+	{
+		hasUptime = true;
+		sql += wxT(", CASE WHEN usesuper THEN pg_postmaster_starttime() ELSE NULL END as upsince");
+	}
+	if (conn->BackendMinimumVersion(8, 4))
+	{
+		sql += wxT(", CASE WHEN usesuper THEN pg_conf_load_time() ELSE NULL END as confloadedsince");
+	}
+	if (conn->BackendMinimumVersion(8, 5))
+	{
+		sql += wxT(", CASE WHEN usesuper THEN pg_is_in_recovery() ELSE NULL END as inrecovery");
+		if (conn->BackendMinimumVersion(10, 0))
+		{
+			sql += wxT(", CASE WHEN usesuper THEN pg_last_wal_receive_lsn() ELSE NULL END as receiveloc");
+			sql += wxT(", CASE WHEN usesuper THEN pg_last_wal_replay_lsn() ELSE NULL END as replayloc");
+		}
+		else
+		{
+			sql += wxT(", CASE WHEN usesuper THEN pg_last_xlog_receive_location() ELSE NULL END as receiveloc");
+			sql += wxT(", CASE WHEN usesuper THEN pg_last_xlog_replay_location() ELSE NULL END as replayloc");
+		}
+	}
+	if (conn->BackendMinimumVersion(9, 1))
+	{
+		sql += wxT(", CASE WHEN usesuper THEN pg_last_xact_replay_timestamp() ELSE NULL END as replay_timestamp");
+		if (conn->BackendMinimumVersion(10, 0))
+			sql += wxT(", CASE WHEN usesuper AND pg_is_in_recovery() THEN pg_is_wal_replay_paused() ELSE NULL END as isreplaypaused");
+		else
+			sql += wxT(", CASE WHEN usesuper AND pg_is_in_recovery() THEN pg_is_xlog_replay_paused() ELSE NULL END as isreplaypaused");
+	}
+
+	pgSet *set = ExecuteSet(sql + wxT("\n  FROM pg_user WHERE usename=current_user"));
+	if (set)
+	{
+		iSetCreatePrivilege(set->GetBool(wxT("usecreatedb")));
+		iSetSuperUser(set->GetBool(wxT("usesuper")));
+		if (hasUptime)
+			iSetUpSince(set->GetDateTime(wxT("upsince")));
+		if (conn->BackendMinimumVersion(8, 4))
+			iSetConfLoadedSince(set->GetDateTime(wxT("confloadedsince")));
+		if (conn->BackendMinimumVersion(8, 5))
+		{
+			iSetInRecovery(set->GetBool(wxT("inrecovery")));
+			iSetReplayLoc(set->GetVal(wxT("replayloc")));
+			iSetReceiveLoc(set->GetVal(wxT("receiveloc")));
+		}
+		if (conn->BackendMinimumVersion(9, 1))
+		{
+			iSetReplayTimestamp(set->GetVal(wxT("replay_timestamp")));
+			SetReplayPaused(set->GetBool(wxT("isreplaypaused")));
+		}
+		delete set;
+	}
+
+	if (conn->BackendMinimumVersion(8, 1))
+	{
+		set = ExecuteSet(wxT("SELECT rolcreaterole, rolcreatedb FROM pg_roles WHERE rolname = current_user;"));
+
+		if (set)
+		{
+			iSetCreatePrivilege(set->GetBool(wxT("rolcreatedb")));
+			iSetCreateRole(set->GetBool(wxT("rolcreaterole")));
+			delete set;
+		}
+	}
+	else
+		iSetCreateRole(false);
+}
+
+
+int pgServer::FinishConnect(frmMain *form, bool async)
+{
 	int status = conn->GetStatus();
 	if (status == PGCONN_OK)
 	{
+		if (database.IsEmpty())
+			database = conn->GetDbname();
+
 		dbOid = conn->GetDbOid();
 
+		conn->EnableStatementCache(settings->GetPrepareCatalogQueries());
+		conn->EnableBinaryResults(settings->GetBinaryCatalogResults());
+
 		// Check the server version
 		if (conn->GetIsGreenplum())
 		{
@@ -886,82 +1148,10 @@ int pgServer::Connect(frmMain *form, bool askPassword, const wxString &pwd, bool
 		}
 
 		connected = true;
-		bool hasUptime = false;
 
-		wxString sql = wxT("SELECT usecreatedb, usesuper");
-		if (conn->BackendMinimumVersion(8, 1))
-		{
-			hasUptime = true;
-			sql += wxT(", CASE WHEN usesuper THEN pg_postmaster_start_time() ELSE NULL END as upsince");
-		}
-		else if (conn->HasFeature(FEATURE_POSTMASTER_STARTTIME))
-		{
-			hasUptime = true;
-			sql += wxT(", CASE WHEN usesuper THEN pg_postmaster_starttime() ELSE NULL END as upsince");
-		}
-		if (conn->BackendMinimumVersion(8, 4))
-		{
-			sql += wxT(", CASE WHEN usesuper THEN pg_conf_load_time() ELSE NULL END as confloadedsince");
-		}
-		if (conn->BackendMinimumVersion(8, 5))
-		{
-			sql += wxT(", CASE WHEN usesuper THEN pg_is_in_recovery() ELSE NULL END as inrecovery");
-			if (conn->BackendMinimumVersion(10, 0))
-			{
-				sql += wxT(", CASE WHEN usesuper THEN pg_last_wal_receive_lsn() ELSE NULL END as receiveloc");
-				sql += wxT(", CASE WHEN usesuper THEN pg_last_wal_replay_lsn() ELSE NULL END as replayloc");
-			}
-			else
-			{
-				sql += wxT(", CASE WHEN usesuper THEN pg_last_xlog_receive_location() ELSE NULL END as receiveloc");
-				sql += wxT(", CASE WHEN usesuper THEN pg_last_xlog_replay_location() ELSE NULL END as replayloc");
-			}
-		}
-		if (conn->BackendMinimumVersion(9, 1))
-		{
-			sql += wxT(", CASE WHEN usesuper THEN pg_last_xact_replay_timestamp() ELSE NULL END as replay_timestamp");
-			if (conn->BackendMinimumVersion(10, 0))
-				sql += wxT(", CASE WHEN usesuper AND pg_is_in_recovery() THEN pg_is_wal_replay_paused() ELSE NULL END as isreplaypaused");
-			else
-				sql += wxT(", CASE WHEN usesuper AND pg_is_in_recovery() THEN pg_is_xlog_replay_paused() ELSE NULL END as isreplaypaused");
-		}
-
-		pgSet *set = ExecuteSet(sql + wxT("\n  FROM pg_user WHERE usename=current_user"));
-		if (set)
-		{
-			iSetCreatePrivilege(set->GetBool(wxT("usecreatedb")));
-			iSetSuperUser(set->GetBool(wxT("usesuper")));
-			if (hasUptime)
-				iSetUpSince(set->GetDateTime(wxT("upsince")));
-			if (conn->BackendMinimumVersion(8, 4))
-				iSetConfLoadedSince(set->GetDateTime(wxT("confloadedsince")));
-			if (conn->BackendMinimumVersion(8, 5))
-			{
-				iSetInRecovery(set->GetBool(wxT("inrecovery")));
-				iSetReplayLoc(set->GetVal(wxT("replayloc")));
-				iSetReceiveLoc(set->GetVal(wxT("receiveloc")));
-			}
-			if (conn->BackendMinimumVersion(9, 1))
-			{
-				iSetReplayTimestamp(set->GetVal(wxT("replay_timestamp")));
-				SetReplayPaused(set->GetBool(wxT("isreplaypaused")));
-			}
-			delete set;
-		}
-
-		if (conn->BackendMinimumVersion(8, 1))
-		{
-			set = ExecuteSet(wxT("SELECT rolcreaterole, rolcreatedb FROM pg_roles WHERE rolname = current_user;"));
-
-			if (set)
-			{
-				iSetCreatePrivilege(set->GetBool(wxT("rolcreatedb")));
-				iSetCreateRole(set->GetBool(wxT("rolcreaterole")));
-				delete set;
-			}
-		}
-		else
-			iSetCreateRole(false);
+		// Read by the connect thread already, when connecting with async
+		if (!async)
+			ReadServerDetails();
 
 		wxString version, allVersions;
 		version.Printf(wxT("%d.%d"), conn->GetMajorVersion(), conn->GetMinorVersion());
@@ -977,7 +1167,7 @@ int pgServer::Connect(frmMain *form, bool askPassword, const wxString &pwd, bool
 			settings->WriteBool(wxT("Updates/UseSSL"), true);
 
 		UpdateIcon(form->GetBrowser());
-		if (storePassword || forceStorePassword)
+		if (connectStorePassword || connectForceStorePassword)
 			StorePassword();
 	}
 	else
@@ -985,7 +1175,8 @@ int pgServer::Connect(frmMain *form, bool askPassword, const wxString &pwd, bool
 		connected = false;
 	}
 
-	form->EndMsg(connected && status == PGCONN_OK);
+	if (!async)
+		form->EndMsg(connected && status == PGCONN_OK);
 
 	passwordValid = connected;
 	return status;
@@ -1285,6 +1476,13 @@ void pgServer::ShowTreeDetail(ctlTree *browser, frmMain *form, ctlListView *prop
 				else
 					properties->AppendItem(_("Replay paused"), wxEmptyString);
 			}
+
+			pgConnPoolStats poolStats = pgConnPool::Get()->GetStats(GetConnPoolKey());
+			properties->AppendItem(_("Pooled connections"),
+			                       wxString::Format(_("%d idle, %ld of %ld reused, %ld released, %ld closed"),
+			                                        pgConnPool::Get()->GetIdleCount(GetConnPoolKey()),
+			                                        poolStats.reused, poolStats.acquired,
+			                                        poolStats.released, poolStats.discarded));
 		}
 		if (GetServerControllable())
 			properties->AppendYesNoItem(_("Running?"), GetServerRunning());
@@ -2115,12 +2313,25 @@ wxWindow *connectServerFactory::StartDialog(frmMain *form, pgObject *obj)
 bool connectServerFactory::CheckEnable(pgObject *obj)
 {
 	if (obj && obj->IsCreatedBy(serverFactory))
-		return !((pgServer *)obj)->GetConnected();
+		return !((pgServer *)obj)->GetConnected() && !((pgServer *)obj)->IsConnecting();
 
 	return false;
 }
 
 
+connectAllServersFactory::connectAllServersFactory(menuFactoryList *list, wxMenu *mnu, ctlMenuToolbar *toolbar) : actionFactory(list)
+{
+	mnu->Append(id, _("Connect &all servers"), _("Connect to all registered servers in the background."));
+}
+
+
+wxWindow *connectAllServersFactory::StartDialog(frmMain *form, pgObject *obj)
+{
+	form->ConnectAllServers();
+	return 0;
+}
+
+
 disconnectServerFactory::disconnectServerFactory(menuFactoryList *list, wxMenu *mnu, ctlMenuToolbar *toolbar) : contextActionFactory(list)
 {
 	mnu->Append(id, _("Disconnec&t server"), _("Disconnect from the selected server."));
@@ -2149,8 +2360,9 @@ wxWindow *disconnectServerFactory::StartDialog(frmMain *form, pgObject *obj)
 
 bool disconnectServerFactory::CheckEnable(pgObject *obj)
 {
+	// Also cancels a connect in progress
 	if (obj && obj->IsCreatedBy(serverFactory))
-		return ((pgServer *)obj)->GetConnected();
+		return ((pgServer *)obj)->GetConnected() || ((pgServer *)obj)->IsConnecting();
 
 	return false;
 }
@@ -42,6 +42,7 @@ TMP_ui += \
 	ui/dlgIndexConstraint.xrc \
 	ui/dlgJob.xrc \
 	ui/dlgLanguage.xrc \
+	ui/dlgLoadTest.xrc \
 	ui/dlgMainConfig.xrc \
 	ui/dlgManageFavourites.xrc \
 	ui/dlgManageMacros.xrc \
@@ -49,6 +50,7 @@ TMP_ui += \
 	ui/dlgOperator.xrc \
 	ui/dlgPackage.xrc \
 	ui/dlgPgpassConfig.xrc \
+	ui/dlgQueryBenchmark.xrc \
 	ui/dlgReassignDropOwned.xrc \
 	ui/dlgRepCluster.xrc \
 	ui/dlgRepClusterUpgrade.xrc \
@@ -12964,12 +12964,221 @@ static unsigned char xml_res_file_28[] = {
 99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,
 111,117,114,99,101,62,10};
 
-static size_t xml_res_size_29 = 4728;
+static size_t xml_res_size_29 = 4447;
 static unsigned char xml_res_file_29[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
 32,99,108,97,115,115,61,34,119,120,68,105,97,108,111,103,34,32,110,97,109,
+101,61,34,100,108,103,76,111,97,100,84,101,115,116,34,62,10,32,32,32,32,
+60,116,105,116,108,101,62,76,111,97,100,32,116,101,115,116,60,47,116,105,
+116,108,101,62,10,32,32,32,32,60,115,105,122,101,62,52,55,48,44,51,55,48,
+100,60,47,115,105,122,101,62,10,32,32,32,32,60,115,116,121,108,101,62,119,
+120,68,69,70,65,85,76,84,95,68,73,65,76,79,71,95,83,84,89,76,69,124,119,
+120,67,65,80,84,73,79,78,124,119,120,83,89,83,84,69,77,95,77,69,78,85,124,
+119,120,82,69,83,73,90,69,95,66,79,82,68,69,82,60,47,115,116,121,108,101,
+62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
+120,66,111,120,83,105,122,101,114,34,62,10,32,32,32,32,32,32,60,111,114,
+105,101,110,116,62,119,120,86,69,82,84,73,67,65,76,60,47,111,114,105,101,
+110,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,70,108,
+101,120,71,114,105,100,83,105,122,101,114,34,62,10,32,32,32,32,32,32,32,
+32,32,32,60,99,111,108,115,62,50,60,47,99,111,108,115,62,10,32,32,32,32,
+32,32,32,32,32,32,60,118,103,97,112,62,53,60,47,118,103,97,112,62,10,32,
+32,32,32,32,32,32,32,32,32,60,104,103,97,112,62,53,60,47,104,103,97,112,
+62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
+97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,
+32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
+61,34,119,120,83,116,97,116,105,99,84,101,120,116,34,32,110,97,109,101,
+61,34,115,116,67,108,105,101,110,116,115,34,62,10,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,60,108,97,98,101,108,62,67,108,105,101,110,116,115,
+60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,
+111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,102,
+108,97,103,62,119,120,65,76,73,71,78,95,67,69,78,84,82,69,95,86,69,82,84,
+73,67,65,76,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,60,
+47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,
+106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,
+109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,83,112,105,110,67,116,114,108,34,32,
+110,97,109,101,61,34,115,112,110,67,108,105,101,110,116,115,34,62,10,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,60,118,97,108,117,101,62,52,60,47,
+118,97,108,117,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,109,
+105,110,62,49,60,47,109,105,110,62,10,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,60,109,97,120,62,49,48,48,60,47,109,97,120,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,60,115,116,121,108,101,62,119,120,83,80,95,65,
+82,82,79,87,95,75,69,89,83,60,47,115,116,121,108,101,62,10,32,32,32,32,
+32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,
+32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,
+114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,111,
+98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,82,97,100,105,111,
+66,117,116,116,111,110,34,32,110,97,109,101,61,34,114,98,83,101,99,111,
+110,100,115,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,
+98,101,108,62,68,117,114,97,116,105,111,110,32,40,115,101,99,111,110,100,
+115,41,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,60,118,97,108,117,101,62,49,60,47,118,97,108,117,101,62,10,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,60,115,116,121,108,101,62,119,120,82,
+66,95,71,82,79,85,80,60,47,115,116,121,108,101,62,10,32,32,32,32,32,32,
+32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,
+32,32,32,32,32,60,102,108,97,103,62,119,120,65,76,73,71,78,95,67,69,78,
+84,82,69,95,86,69,82,84,73,67,65,76,60,47,102,108,97,103,62,10,32,32,32,
+32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,
+32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,105,
+122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
+60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,83,112,105,
+110,67,116,114,108,34,32,110,97,109,101,61,34,115,112,110,83,101,99,111,
+110,100,115,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,118,97,
+108,117,101,62,49,48,60,47,118,97,108,117,101,62,10,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,60,109,105,110,62,49,60,47,109,105,110,62,10,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,60,109,97,120,62,56,54,52,48,48,60,
+47,109,97,120,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,116,
+121,108,101,62,119,120,83,80,95,65,82,82,79,87,95,75,69,89,83,60,47,115,
+116,121,108,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,
+106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,
+99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
+99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,
+32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,
+115,115,61,34,119,120,82,97,100,105,111,66,117,116,116,111,110,34,32,110,
+97,109,101,61,34,114,98,73,116,101,114,97,116,105,111,110,115,34,62,10,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,73,116,
+101,114,97,116,105,111,110,115,32,112,101,114,32,99,108,105,101,110,116,
+60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,
+111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,102,
+108,97,103,62,119,120,65,76,73,71,78,95,67,69,78,84,82,69,95,86,69,82,84,
+73,67,65,76,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,60,
+47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,
+106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,
+109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,83,112,105,110,67,116,114,108,34,32,
+110,97,109,101,61,34,115,112,110,73,116,101,114,97,116,105,111,110,115,
+34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,118,97,108,117,101,
+62,49,48,48,60,47,118,97,108,117,101,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,60,109,105,110,62,49,60,47,109,105,110,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,60,109,97,120,62,49,48,48,48,48,48,48,48,60,
+47,109,97,120,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,116,
+121,108,101,62,119,120,83,80,95,65,82,82,79,87,95,75,69,89,83,60,47,115,
+116,121,108,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,
+106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,
+99,116,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
+32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,65,76,76,60,47,102,
+108,97,103,62,10,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,52,
+60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,60,47,111,98,106,101,
+99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,83,116,
+97,116,105,99,84,101,120,116,34,32,110,97,109,101,61,34,115,116,83,116,
+97,116,101,109,101,110,116,115,34,62,10,32,32,32,32,32,32,32,32,32,32,60,
+108,97,98,101,108,47,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,
+99,116,62,10,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,76,69,
+70,84,124,119,120,82,73,71,72,84,124,119,120,66,79,84,84,79,77,60,47,102,
+108,97,103,62,10,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,52,
+60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,60,47,111,98,106,101,
+99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,66,111,
+120,83,105,122,101,114,34,62,10,32,32,32,32,32,32,32,32,32,32,60,111,114,
+105,101,110,116,62,119,120,72,79,82,73,90,79,78,84,65,76,60,47,111,114,
+105,101,110,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,
+116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,
+10,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
+97,115,115,61,34,119,120,76,105,115,116,67,116,114,108,34,32,110,97,109,
+101,61,34,108,115,116,83,117,109,109,97,114,121,34,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,60,115,116,121,108,101,62,119,120,76,67,95,82,
+69,80,79,82,84,124,119,120,76,67,95,83,73,78,71,76,69,95,83,69,76,60,47,
+115,116,121,108,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,
+98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,111,112,
+116,105,111,110,62,50,60,47,111,112,116,105,111,110,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,69,88,80,65,78,68,60,
+47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,
+101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,
+32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
+97,115,115,61,34,119,120,76,105,115,116,67,116,114,108,34,32,110,97,109,
+101,61,34,108,115,116,72,105,115,116,111,103,114,97,109,34,62,10,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,60,115,116,121,108,101,62,119,120,76,
+67,95,82,69,80,79,82,84,124,119,120,76,67,95,83,73,78,71,76,69,95,83,69,
+76,60,47,115,116,121,108,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
+60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,
+111,112,116,105,111,110,62,51,60,47,111,112,116,105,111,110,62,10,32,32,
+32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,69,88,80,65,
+78,68,124,119,120,76,69,70,84,60,47,102,108,97,103,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,52,60,47,98,111,114,100,
+101,114,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
+62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
+32,32,32,32,32,60,111,112,116,105,111,110,62,51,60,47,111,112,116,105,111,
+110,62,10,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,69,88,80,
+65,78,68,124,119,120,76,69,70,84,124,119,120,82,73,71,72,84,60,47,102,108,
+97,103,62,10,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,52,60,
+47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,60,47,111,98,106,101,
+99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,76,105,
+115,116,67,116,114,108,34,32,110,97,109,101,61,34,108,115,116,67,108,105,
+101,110,116,115,34,62,10,32,32,32,32,32,32,32,32,32,32,60,115,116,121,108,
+101,62,119,120,76,67,95,82,69,80,79,82,84,124,119,120,76,67,95,83,73,78,
+71,76,69,95,83,69,76,60,47,115,116,121,108,101,62,10,32,32,32,32,32,32,
+32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,
+112,116,105,111,110,62,50,60,47,111,112,116,105,111,110,62,10,32,32,32,
+32,32,32,32,32,60,102,108,97,103,62,119,120,69,88,80,65,78,68,124,119,120,
+65,76,76,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,60,98,111,114,
+100,101,114,62,52,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,
+60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,
+116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,
+10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
+61,34,119,120,70,108,101,120,71,114,105,100,83,105,122,101,114,34,62,10,
+32,32,32,32,32,32,32,32,32,32,60,99,111,108,115,62,52,60,47,99,111,108,
+115,62,10,32,32,32,32,32,32,32,32,32,32,60,103,114,111,119,97,98,108,101,
+99,111,108,115,62,48,60,47,103,114,111,119,97,98,108,101,99,111,108,115,
+62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
+97,115,115,61,34,115,112,97,99,101,114,34,62,10,32,32,32,32,32,32,32,32,
+32,32,32,32,60,115,105,122,101,62,48,44,48,100,60,47,115,105,122,101,62,
+10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,
+32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
+34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,
+32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,
+66,117,116,116,111,110,34,32,110,97,109,101,61,34,98,116,110,83,116,97,
+114,116,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,
+101,108,62,38,97,109,112,59,83,116,97,114,116,60,47,108,97,98,101,108,62,
+10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
+32,32,32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,65,76,
+76,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,98,
+111,114,100,101,114,62,52,60,47,98,111,114,100,101,114,62,10,32,32,32,32,
+32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,
+32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,
+101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,
+111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,66,117,116,116,
+111,110,34,32,110,97,109,101,61,34,98,116,110,83,116,111,112,34,62,10,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,83,38,97,
+109,112,59,116,111,112,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,
+32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,
+32,32,32,32,32,60,102,108,97,103,62,119,120,65,76,76,60,47,102,108,97,103,
+62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,
+52,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,32,32,32,32,60,
+47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,
+106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,
+109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,66,117,116,116,111,110,34,32,110,97,
+109,101,61,34,119,120,73,68,95,67,65,78,67,69,76,34,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,38,97,109,112,59,67,
+108,111,115,101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,
+32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,60,102,108,97,103,62,119,120,65,76,76,60,47,102,108,97,103,62,10,
+32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,52,60,
+47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,
+98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,
+116,62,10,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,69,88,80,
+65,78,68,60,47,102,108,97,103,62,10,32,32,32,32,32,32,60,47,111,98,106,
+101,99,116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,
+47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,62,
+10};
+
+static size_t xml_res_size_30 = 4728;
+static unsigned char xml_res_file_30[] = {
+60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
+110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
+10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,68,105,97,108,111,103,34,32,110,97,109,
 101,61,34,100,108,103,77,97,105,110,67,111,110,102,105,103,34,62,10,32,
 32,32,32,60,116,105,116,108,101,47,62,10,32,32,32,32,60,115,105,122,101,
 62,50,52,56,44,49,57,56,100,60,47,115,105,122,101,62,10,32,32,32,32,60,
@@ -13185,8 +13394,8 @@ static unsigned char xml_res_file_29[] = {
 32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,
 62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_30 = 2783;
-static unsigned char xml_res_file_30[] = {
+static size_t xml_res_size_31 = 2783;
+static unsigned char xml_res_file_31[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -13317,8 +13526,8 @@ static unsigned char xml_res_file_30[] = {
 10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,
 101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_31 = 4789;
-static unsigned char xml_res_file_31[] = {
+static size_t xml_res_size_32 = 4789;
+static unsigned char xml_res_file_32[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -13540,8 +13749,8 @@ static unsigned char xml_res_file_31[] = {
 62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,
 114,99,101,62,10};
 
-static size_t xml_res_size_32 = 3312;
-static unsigned char xml_res_file_32[] = {
+static size_t xml_res_size_33 = 3312;
+static unsigned char xml_res_file_33[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,85,84,70,45,56,34,63,62,10,60,114,101,
 115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,32,99,108,97,
@@ -13696,8 +13905,8 @@ static unsigned char xml_res_file_32[] = {
 116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,
 98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_33 = 15434;
-static unsigned char xml_res_file_33[] = {
+static size_t xml_res_size_34 = 15434;
+static unsigned char xml_res_file_34[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -14402,8 +14611,8 @@ static unsigned char xml_res_file_33[] = {
 99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,
 111,117,114,99,101,62,10};
 
-static size_t xml_res_size_34 = 6847;
-static unsigned char xml_res_file_34[] = {
+static size_t xml_res_size_35 = 6847;
+static unsigned char xml_res_file_35[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -14719,8 +14928,8 @@ static unsigned char xml_res_file_34[] = {
 32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,
 62,10};
 
-static size_t xml_res_size_35 = 5135;
-static unsigned char xml_res_file_35[] = {
+static size_t xml_res_size_36 = 5135;
+static unsigned char xml_res_file_36[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -14960,8 +15169,228 @@ static unsigned char xml_res_file_35[] = {
 116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,
 117,114,99,101,62,10};
 
-static size_t xml_res_size_36 = 3101;
-static unsigned char xml_res_file_36[] = {
+static size_t xml_res_size_37 = 4681;
+static unsigned char xml_res_file_37[] = {
+60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
+110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
+10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,68,105,97,108,111,103,34,32,110,97,109,
+101,61,34,100,108,103,81,117,101,114,121,66,101,110,99,104,109,97,114,107,
+34,62,10,32,32,32,32,60,116,105,116,108,101,62,66,101,110,99,104,109,97,
+114,107,32,113,117,101,114,121,60,47,116,105,116,108,101,62,10,32,32,32,
+32,60,115,105,122,101,62,53,48,48,44,51,55,48,100,60,47,115,105,122,101,
+62,10,32,32,32,32,60,115,116,121,108,101,62,119,120,68,69,70,65,85,76,84,
+95,68,73,65,76,79,71,95,83,84,89,76,69,124,119,120,67,65,80,84,73,79,78,
+124,119,120,83,89,83,84,69,77,95,77,69,78,85,124,119,120,82,69,83,73,90,
+69,95,66,79,82,68,69,82,60,47,115,116,121,108,101,62,10,32,32,32,32,60,
+111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,66,111,120,83,
+105,122,101,114,34,62,10,32,32,32,32,32,32,60,111,114,105,101,110,116,62,
+119,120,86,69,82,84,73,67,65,76,60,47,111,114,105,101,110,116,62,10,32,
+32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,
+105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,60,111,
+98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,70,108,101,120,71,
+114,105,100,83,105,122,101,114,34,62,10,32,32,32,32,32,32,32,32,32,32,60,
+99,111,108,115,62,50,60,47,99,111,108,115,62,10,32,32,32,32,32,32,32,32,
+32,32,60,118,103,97,112,62,53,60,47,118,103,97,112,62,10,32,32,32,32,32,
+32,32,32,32,32,60,104,103,97,112,62,53,60,47,104,103,97,112,62,10,32,32,
+32,32,32,32,32,32,32,32,60,103,114,111,119,97,98,108,101,99,111,108,115,
+62,49,60,47,103,114,111,119,97,98,108,101,99,111,108,115,62,10,32,32,32,
+32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,
+115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,
+32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,83,
+116,97,116,105,99,84,101,120,116,34,32,110,97,109,101,61,34,115,116,82,
+117,110,115,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,
+98,101,108,62,82,117,110,115,60,47,108,97,98,101,108,62,10,32,32,32,32,
+32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,65,76,73,71,78,95,67,
+69,78,84,82,69,95,86,69,82,84,73,67,65,76,60,47,102,108,97,103,62,10,32,
+32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,
+32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,
+105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,83,112,
+105,110,67,116,114,108,34,32,110,97,109,101,61,34,115,112,110,82,117,110,
+115,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,118,97,108,117,
+101,62,50,48,60,47,118,97,108,117,101,62,10,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,60,109,105,110,62,49,60,47,109,105,110,62,10,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,60,109,97,120,62,49,48,48,48,48,48,60,47,
+109,97,120,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,116,121,
+108,101,62,119,120,83,80,95,65,82,82,79,87,95,75,69,89,83,60,47,115,116,
+121,108,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,
+101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,
+116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
+108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,
+32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,119,120,83,116,97,116,105,99,84,101,120,116,34,32,110,97,109,
+101,61,34,115,116,87,97,114,109,117,112,115,34,62,10,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,87,97,114,109,117,112,32,
+114,117,110,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,
+32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,60,102,108,97,103,62,119,120,65,76,73,71,78,95,67,69,78,84,82,69,
+95,86,69,82,84,73,67,65,76,60,47,102,108,97,103,62,10,32,32,32,32,32,32,
+32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,
+32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,
+114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,111,
+98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,83,112,105,110,67,
+116,114,108,34,32,110,97,109,101,61,34,115,112,110,87,97,114,109,117,112,
+115,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,118,97,108,117,
+101,62,50,60,47,118,97,108,117,101,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,60,109,105,110,62,48,60,47,109,105,110,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,60,109,97,120,62,49,48,48,48,48,60,47,109,97,
+120,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,116,121,108,
+101,62,119,120,83,80,95,65,82,82,79,87,95,75,69,89,83,60,47,115,116,121,
+108,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,
+99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
+62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
+97,115,115,61,34,115,112,97,99,101,114,34,62,10,32,32,32,32,32,32,32,32,
+32,32,32,32,60,115,105,122,101,62,48,44,48,100,60,47,115,105,122,101,62,
+10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,
+32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
+34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,
+32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,
+67,104,101,99,107,66,111,120,34,32,110,97,109,101,61,34,99,104,107,83,101,
+112,97,114,97,116,101,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+60,108,97,98,101,108,62,82,117,110,32,111,110,32,97,32,115,101,112,97,114,
+97,116,101,32,99,111,110,110,101,99,116,105,111,110,60,47,108,97,98,101,
+108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
+62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
+32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
+61,34,115,112,97,99,101,114,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
+60,115,105,122,101,62,48,44,48,100,60,47,115,105,122,101,62,10,32,32,32,
+32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,
+32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,105,
+122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
+60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,67,104,101,
+99,107,66,111,120,34,32,110,97,109,101,61,34,99,104,107,83,101,114,118,
+101,114,84,105,109,105,110,103,115,34,62,10,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,60,108,97,98,101,108,62,83,101,114,118,101,114,32,116,105,
+109,105,110,103,115,32,40,69,88,80,76,65,73,78,32,65,78,65,76,89,90,69,
+44,32,114,117,110,115,32,101,97,99,104,32,113,117,101,114,121,32,111,110,
+99,101,32,109,111,114,101,41,60,47,108,97,98,101,108,62,10,32,32,32,32,
+32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,
+32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,
+114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,111,
+98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,67,104,101,99,107,
+66,111,120,34,32,110,97,109,101,61,34,99,104,107,67,111,109,112,97,114,
+101,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,
+108,62,67,111,109,112,97,114,101,32,119,105,116,104,60,47,108,97,98,101,
+108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
+62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,
+65,76,73,71,78,95,84,79,80,60,47,102,108,97,103,62,10,32,32,32,32,32,32,
+32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,
+32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,
+114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,111,
+98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,84,101,120,116,67,
+116,114,108,34,32,110,97,109,101,61,34,116,120,116,67,111,109,112,97,114,
+101,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,105,122,101,
+62,45,49,44,51,55,100,60,47,115,105,122,101,62,10,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,60,115,116,121,108,101,62,119,120,84,69,95,77,85,76,
+84,73,76,73,78,69,60,47,115,116,121,108,101,62,10,32,32,32,32,32,32,32,
+32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,
+32,32,32,32,60,102,108,97,103,62,119,120,69,88,80,65,78,68,60,47,102,108,
+97,103,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
+62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
+32,32,32,32,32,60,102,108,97,103,62,119,120,69,88,80,65,78,68,124,119,120,
+65,76,76,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,60,98,111,114,
+100,101,114,62,52,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,
+60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,
+116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,
+10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
+61,34,119,120,76,105,115,116,67,116,114,108,34,32,110,97,109,101,61,34,
+108,115,116,82,101,115,117,108,116,115,34,62,10,32,32,32,32,32,32,32,32,
+32,32,60,115,116,121,108,101,62,119,120,76,67,95,82,69,80,79,82,84,124,
+119,120,76,67,95,83,73,78,71,76,69,95,83,69,76,60,47,115,116,121,108,101,
+62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
+32,32,32,32,32,60,111,112,116,105,111,110,62,49,60,47,111,112,116,105,111,
+110,62,10,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,69,88,80,
+65,78,68,124,119,120,76,69,70,84,124,119,120,82,73,71,72,84,60,47,102,108,
+97,103,62,10,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,52,60,
+47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,60,47,111,98,106,101,
+99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,76,105,
+115,116,67,116,114,108,34,32,110,97,109,101,61,34,108,115,116,72,105,115,
+116,111,103,114,97,109,34,62,10,32,32,32,32,32,32,32,32,32,32,60,115,116,
+121,108,101,62,119,120,76,67,95,82,69,80,79,82,84,124,119,120,76,67,95,
+83,73,78,71,76,69,95,83,69,76,60,47,115,116,121,108,101,62,10,32,32,32,
+32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,
+60,111,112,116,105,111,110,62,50,60,47,111,112,116,105,111,110,62,10,32,
+32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,69,88,80,65,78,68,124,
+119,120,65,76,76,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,60,
+98,111,114,100,101,114,62,52,60,47,98,111,114,100,101,114,62,10,32,32,32,
+32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,
+106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,
+109,34,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
+97,115,115,61,34,119,120,71,97,117,103,101,34,32,110,97,109,101,61,34,103,
+97,117,103,101,34,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,110,103,
+101,62,49,48,48,60,47,114,97,110,103,101,62,10,32,32,32,32,32,32,32,32,
+60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,102,108,97,
+103,62,119,120,69,88,80,65,78,68,124,119,120,76,69,70,84,124,119,120,82,
+73,71,72,84,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,60,98,111,
+114,100,101,114,62,52,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,
+32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,
+99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,
+62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,119,120,70,108,101,120,71,114,105,100,83,105,122,101,114,34,62,
+10,32,32,32,32,32,32,32,32,32,32,60,99,111,108,115,62,53,60,47,99,111,108,
+115,62,10,32,32,32,32,32,32,32,32,32,32,60,103,114,111,119,97,98,108,101,
+99,111,108,115,62,48,60,47,103,114,111,119,97,98,108,101,99,111,108,115,
+62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
+97,115,115,61,34,115,112,97,99,101,114,34,62,10,32,32,32,32,32,32,32,32,
+32,32,32,32,60,115,105,122,101,62,48,44,48,100,60,47,115,105,122,101,62,
+10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,
+32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
+34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,
+32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,
+66,117,116,116,111,110,34,32,110,97,109,101,61,34,98,116,110,83,116,97,
+114,116,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,
+101,108,62,38,97,109,112,59,83,116,97,114,116,60,47,108,97,98,101,108,62,
+10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
+32,32,32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,65,76,
+76,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,98,
+111,114,100,101,114,62,52,60,47,98,111,114,100,101,114,62,10,32,32,32,32,
+32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,
+32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,
+101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,
+111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,66,117,116,116,
+111,110,34,32,110,97,109,101,61,34,98,116,110,83,116,111,112,34,62,10,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,83,38,97,
+109,112,59,116,111,112,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,
+32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,
+32,32,32,32,32,60,102,108,97,103,62,119,120,65,76,76,60,47,102,108,97,103,
+62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,
+52,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,32,32,32,32,60,
+47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,
+106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,
+109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,66,117,116,116,111,110,34,32,110,97,
+109,101,61,34,98,116,110,69,120,112,111,114,116,34,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,69,120,112,111,114,116,
+32,67,38,97,109,112,59,83,86,46,46,46,60,47,108,97,98,101,108,62,10,32,
+32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,
+32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,65,76,76,60,
+47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,
+100,101,114,62,52,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,
+32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,
+32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,
+114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,111,
+98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,66,117,116,116,111,
+110,34,32,110,97,109,101,61,34,119,120,73,68,95,67,65,78,67,69,76,34,62,
+10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,38,
+97,109,112,59,67,108,111,115,101,60,47,108,97,98,101,108,62,10,32,32,32,
+32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,
+32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,65,76,76,60,47,102,
+108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,100,
+101,114,62,52,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,32,32,
+32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,47,111,
+98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,
+120,69,88,80,65,78,68,60,47,102,108,97,103,62,10,32,32,32,32,32,32,60,47,
+111,98,106,101,99,116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,
+10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,
+99,101,62,10};
+
+static size_t xml_res_size_38 = 3101;
+static unsigned char xml_res_file_38[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,85,84,70,45,56,34,63,62,10,60,114,101,
 115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,32,99,108,97,
@@ -15107,8 +15536,8 @@ static unsigned char xml_res_file_36[] = {
 116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,
 117,114,99,101,62,10};
 
-static size_t xml_res_size_37 = 5252;
-static unsigned char xml_res_file_37[] = {
+static size_t xml_res_size_39 = 5252;
+static unsigned char xml_res_file_39[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -15351,8 +15780,8 @@ static unsigned char xml_res_file_37[] = {
 116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,
 98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_38 = 9516;
-static unsigned char xml_res_file_38[] = {
+static size_t xml_res_size_40 = 9516;
+static unsigned char xml_res_file_40[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -15788,8 +16217,8 @@ static unsigned char xml_res_file_38[] = {
 32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,
 62,10};
 
-static size_t xml_res_size_39 = 3951;
-static unsigned char xml_res_file_39[] = {
+static size_t xml_res_size_41 = 3951;
+static unsigned char xml_res_file_41[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -15973,8 +16402,8 @@ static unsigned char xml_res_file_39[] = {
 62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,
 114,99,101,62,10};
 
-static size_t xml_res_size_40 = 3280;
-static unsigned char xml_res_file_40[] = {
+static size_t xml_res_size_42 = 3280;
+static unsigned char xml_res_file_42[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -16127,8 +16556,8 @@ static unsigned char xml_res_file_40[] = {
 32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,
 62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_41 = 3852;
-static unsigned char xml_res_file_41[] = {
+static size_t xml_res_size_43 = 3852;
+static unsigned char xml_res_file_43[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -16307,8 +16736,8 @@ static unsigned char xml_res_file_41[] = {
 10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,
 101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_42 = 3944;
-static unsigned char xml_res_file_42[] = {
+static size_t xml_res_size_44 = 3944;
+static unsigned char xml_res_file_44[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -16491,8 +16920,8 @@ static unsigned char xml_res_file_42[] = {
 32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,
 62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_43 = 3333;
-static unsigned char xml_res_file_43[] = {
+static size_t xml_res_size_45 = 3333;
+static unsigned char xml_res_file_45[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -16648,8 +17077,8 @@ static unsigned char xml_res_file_43[] = {
 116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,
 117,114,99,101,62,10};
 
-static size_t xml_res_size_44 = 3318;
-static unsigned char xml_res_file_44[] = {
+static size_t xml_res_size_46 = 3318;
+static unsigned char xml_res_file_46[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -16804,8 +17233,8 @@ static unsigned char xml_res_file_44[] = {
 32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,
 62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_45 = 4226;
-static unsigned char xml_res_file_45[] = {
+static size_t xml_res_size_47 = 4226;
+static unsigned char xml_res_file_47[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -17001,8 +17430,8 @@ static unsigned char xml_res_file_45[] = {
 62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,
 114,99,101,62,10};
 
-static size_t xml_res_size_46 = 4629;
-static unsigned char xml_res_file_46[] = {
+static size_t xml_res_size_48 = 4629;
+static unsigned char xml_res_file_48[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -17216,8 +17645,8 @@ static unsigned char xml_res_file_46[] = {
 116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,
 98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_47 = 5369;
-static unsigned char xml_res_file_47[] = {
+static size_t xml_res_size_49 = 5369;
+static unsigned char xml_res_file_49[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -17465,8 +17894,8 @@ static unsigned char xml_res_file_47[] = {
 116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,
 117,114,99,101,62,10};
 
-static size_t xml_res_size_48 = 3987;
-static unsigned char xml_res_file_48[] = {
+static size_t xml_res_size_50 = 3987;
+static unsigned char xml_res_file_50[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -17652,8 +18081,8 @@ static unsigned char xml_res_file_48[] = {
 10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,
 99,101,62,10};
 
-static size_t xml_res_size_49 = 19951;
-static unsigned char xml_res_file_49[] = {
+static size_t xml_res_size_51 = 19951;
+static unsigned char xml_res_file_51[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -18562,8 +18991,8 @@ static unsigned char xml_res_file_49[] = {
 32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,
 62,10};
 
-static size_t xml_res_size_50 = 8061;
-static unsigned char xml_res_file_50[] = {
+static size_t xml_res_size_52 = 8061;
+static unsigned char xml_res_file_52[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -18934,8 +19363,8 @@ static unsigned char xml_res_file_50[] = {
 60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,
 62,10};
 
-static size_t xml_res_size_51 = 18848;
-static unsigned char xml_res_file_51[] = {
+static size_t xml_res_size_53 = 18848;
+static unsigned char xml_res_file_53[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -19793,8 +20222,8 @@ static unsigned char xml_res_file_51[] = {
 99,116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,
 111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_52 = 5370;
-static unsigned char xml_res_file_52[] = {
+static size_t xml_res_size_54 = 5370;
+static unsigned char xml_res_file_54[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -20042,8 +20471,8 @@ static unsigned char xml_res_file_52[] = {
 32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,
 62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_53 = 7603;
-static unsigned char xml_res_file_53[] = {
+static size_t xml_res_size_55 = 7603;
+static unsigned char xml_res_file_55[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -20395,8 +20824,8 @@ static unsigned char xml_res_file_53[] = {
 32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,
 116,62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_54 = 1165;
-static unsigned char xml_res_file_54[] = {
+static size_t xml_res_size_56 = 1165;
+static unsigned char xml_res_file_56[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -20453,8 +20882,8 @@ static unsigned char xml_res_file_54[] = {
 47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,
 60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_55 = 9836;
-static unsigned char xml_res_file_55[] = {
+static size_t xml_res_size_57 = 9836;
+static unsigned char xml_res_file_57[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -20905,8 +21334,8 @@ static unsigned char xml_res_file_55[] = {
 99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,
 111,117,114,99,101,62,10};
 
-static size_t xml_res_size_56 = 23313;
-static unsigned char xml_res_file_56[] = {
+static size_t xml_res_size_58 = 23313;
+static unsigned char xml_res_file_58[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -21972,8 +22401,8 @@ static unsigned char xml_res_file_56[] = {
 99,116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,
 111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_57 = 10693;
-static unsigned char xml_res_file_57[] = {
+static size_t xml_res_size_59 = 10693;
+static unsigned char xml_res_file_59[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -22462,8 +22891,8 @@ static unsigned char xml_res_file_57[] = {
 111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,
 47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_58 = 7276;
-static unsigned char xml_res_file_58[] = {
+static size_t xml_res_size_60 = 7276;
+static unsigned char xml_res_file_60[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -22798,8 +23227,8 @@ static unsigned char xml_res_file_58[] = {
 99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,
 111,117,114,99,101,62,10};
 
-static size_t xml_res_size_59 = 10220;
-static unsigned char xml_res_file_59[] = {
+static size_t xml_res_size_61 = 10220;
+static unsigned char xml_res_file_61[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -23266,8 +23695,8 @@ static unsigned char xml_res_file_59[] = {
 32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,
 62,10};
 
-static size_t xml_res_size_60 = 39694;
-static unsigned char xml_res_file_60[] = {
+static size_t xml_res_size_62 = 39694;
+static unsigned char xml_res_file_62[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -25067,8 +25496,8 @@ static unsigned char xml_res_file_60[] = {
 32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,
 62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_61 = 12474;
-static unsigned char xml_res_file_61[] = {
+static size_t xml_res_size_63 = 12474;
+static unsigned char xml_res_file_63[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -25637,8 +26066,8 @@ static unsigned char xml_res_file_61[] = {
 62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,
 114,99,101,62,10};
 
-static size_t xml_res_size_62 = 10984;
-static unsigned char xml_res_file_62[] = {
+static size_t xml_res_size_64 = 10984;
+static unsigned char xml_res_file_64[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -26140,8 +26569,8 @@ static unsigned char xml_res_file_62[] = {
 62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,
 114,99,101,62,10};
 
-static size_t xml_res_size_63 = 10400;
-static unsigned char xml_res_file_63[] = {
+static size_t xml_res_size_65 = 10400;
+static unsigned char xml_res_file_65[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -26617,8 +27046,8 @@ static unsigned char xml_res_file_63[] = {
 98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,
 101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_64 = 8260;
-static unsigned char xml_res_file_64[] = {
+static size_t xml_res_size_66 = 8260;
+static unsigned char xml_res_file_66[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -26997,8 +27426,8 @@ static unsigned char xml_res_file_64[] = {
 47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,
 60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_65 = 16218;
-static unsigned char xml_res_file_65[] = {
+static size_t xml_res_size_67 = 16218;
+static unsigned char xml_res_file_67[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -27738,8 +28167,8 @@ static unsigned char xml_res_file_65[] = {
 32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,
 62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_66 = 42127;
-static unsigned char xml_res_file_66[] = {
+static size_t xml_res_size_68 = 42127;
+static unsigned char xml_res_file_68[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -29631,8 +30060,8 @@ static unsigned char xml_res_file_66[] = {
 32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,
 62,10};
 
-static size_t xml_res_size_67 = 8000;
-static unsigned char xml_res_file_67[] = {
+static size_t xml_res_size_69 = 8000;
+static unsigned char xml_res_file_69[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -29999,8 +30428,8 @@ static unsigned char xml_res_file_67[] = {
 62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,
 114,99,101,62,10};
 
-static size_t xml_res_size_68 = 15290;
-static unsigned char xml_res_file_68[] = {
+static size_t xml_res_size_70 = 15290;
+static unsigned char xml_res_file_70[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -30697,8 +31126,8 @@ static unsigned char xml_res_file_68[] = {
 111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,
 47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_69 = 35925;
-static unsigned char xml_res_file_69[] = {
+static size_t xml_res_size_71 = 35925;
+static unsigned char xml_res_file_71[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -32316,8 +32745,8 @@ static unsigned char xml_res_file_69[] = {
 99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,115,
 111,117,114,99,101,62,10};
 
-static size_t xml_res_size_70 = 3982;
-static unsigned char xml_res_file_70[] = {
+static size_t xml_res_size_72 = 3982;
+static unsigned char xml_res_file_72[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -32503,8 +32932,8 @@ static unsigned char xml_res_file_70[] = {
 32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,
 99,116,62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_71 = 3909;
-static unsigned char xml_res_file_71[] = {
+static size_t xml_res_size_73 = 3909;
+static unsigned char xml_res_file_73[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -32687,8 +33116,8 @@ static unsigned char xml_res_file_71[] = {
 47,111,98,106,101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,62,
 10};
 
-static size_t xml_res_size_72 = 17923;
-static unsigned char xml_res_file_72[] = {
+static size_t xml_res_size_74 = 17923;
+static unsigned char xml_res_file_74[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -33505,8 +33934,8 @@ static unsigned char xml_res_file_72[] = {
 106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,
 101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_73 = 3589;
-static unsigned char xml_res_file_73[] = {
+static size_t xml_res_size_75 = 3847;
+static unsigned char xml_res_file_75[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -33514,7 +33943,7 @@ static unsigned char xml_res_file_73[] = {
 101,61,34,102,114,109,69,120,112,111,114,116,34,62,10,32,32,32,32,60,116,
 105,116,108,101,62,69,120,112,111,114,116,32,100,97,116,97,32,116,111,32,
 102,105,108,101,60,47,116,105,116,108,101,62,10,32,32,32,32,60,115,105,
-122,101,62,50,53,51,44,49,52,51,100,60,47,115,105,122,101,62,10,32,32,32,
+122,101,62,50,53,51,44,49,53,56,100,60,47,115,105,122,101,62,10,32,32,32,
 32,60,115,116,121,108,101,62,119,120,68,69,70,65,85,76,84,95,68,73,65,76,
 79,71,95,83,84,89,76,69,60,47,115,116,121,108,101,62,10,32,32,32,32,60,
 111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,83,116,97,116,
@@ -33589,96 +34018,108 @@ static unsigned char xml_res_file_73[] = {
 32,32,32,32,60,115,105,122,101,62,49,50,44,49,50,100,60,47,115,105,122,
 101,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,
 111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,83,116,97,116,
-105,99,66,111,120,34,32,110,97,109,101,61,34,115,98,69,110,99,111,100,105,
-110,103,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,69,110,99,111,
-100,105,110,103,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,112,
-111,115,62,49,51,48,44,53,100,60,47,112,111,115,62,10,32,32,32,32,32,32,
-60,115,105,122,101,62,49,50,48,44,51,56,100,60,47,115,105,122,101,62,10,
-32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,
-101,99,116,32,99,108,97,115,115,61,34,119,120,82,97,100,105,111,66,117,
-116,116,111,110,34,32,110,97,109,101,61,34,114,98,76,111,99,97,108,34,62,
-10,32,32,32,32,32,32,60,108,97,98,101,108,62,76,111,99,97,108,32,99,104,
-97,114,115,101,116,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,118,
-97,108,117,101,62,49,60,47,118,97,108,117,101,62,10,32,32,32,32,32,32,60,
-112,111,115,62,49,52,48,44,49,55,100,60,47,112,111,115,62,10,32,32,32,32,
-32,32,60,115,116,121,108,101,62,119,120,82,66,95,71,82,79,85,80,60,47,115,
-116,121,108,101,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
-32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,82,
-97,100,105,111,66,117,116,116,111,110,34,32,110,97,109,101,61,34,114,98,
-85,110,105,99,111,100,101,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,
-62,85,110,105,99,111,100,101,32,85,84,70,45,56,60,47,108,97,98,101,108,
-62,10,32,32,32,32,32,32,60,112,111,115,62,49,52,48,44,50,57,100,60,47,112,
+105,99,84,101,120,116,34,32,110,97,109,101,61,34,115,116,67,111,109,112,
+114,101,115,115,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,67,111,
+109,112,114,101,115,115,32,40,103,122,105,112,41,60,47,108,97,98,101,108,
+62,10,32,32,32,32,32,32,60,112,111,115,62,53,44,49,48,48,100,60,47,112,
 111,115,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,
-60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,83,116,97,116,
-105,99,66,111,120,34,32,110,97,109,101,61,34,115,98,81,117,111,116,105,
-110,103,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,81,117,111,116,
-105,110,103,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,112,111,
-115,62,49,51,48,44,52,56,100,60,47,112,111,115,62,10,32,32,32,32,32,32,
-60,115,105,122,101,62,49,50,48,44,53,48,100,60,47,115,105,122,101,62,10,
-32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,
-101,99,116,32,99,108,97,115,115,61,34,119,120,82,97,100,105,111,66,117,
-116,116,111,110,34,32,110,97,109,101,61,34,114,98,81,117,111,116,101,78,
-111,110,101,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,110,111,
-32,113,117,111,116,105,110,103,60,47,108,97,98,101,108,62,10,32,32,32,32,
-32,32,60,112,111,115,62,49,52,48,44,54,48,100,60,47,112,111,115,62,10,32,
-32,32,32,32,32,60,115,116,121,108,101,62,119,120,82,66,95,71,82,79,85,80,
-60,47,115,116,121,108,101,62,10,32,32,32,32,60,47,111,98,106,101,99,116,
-62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
-120,82,97,100,105,111,66,117,116,116,111,110,34,32,110,97,109,101,61,34,
-114,98,81,117,111,116,101,83,116,114,105,110,103,115,34,62,10,32,32,32,
-32,32,32,60,108,97,98,101,108,62,111,110,108,121,32,115,116,114,105,110,
-103,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,118,97,108,117,
-101,62,49,60,47,118,97,108,117,101,62,10,32,32,32,32,32,32,60,112,111,115,
-62,49,52,48,44,55,50,100,60,47,112,111,115,62,10,32,32,32,32,60,47,111,
-98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
-97,115,115,61,34,119,120,82,97,100,105,111,66,117,116,116,111,110,34,32,
-110,97,109,101,61,34,114,98,81,117,111,116,101,65,108,108,34,62,10,32,32,
-32,32,32,32,60,108,97,98,101,108,62,97,108,108,32,99,111,108,117,109,110,
-115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,112,111,115,62,49,
-52,48,44,56,52,100,60,47,112,111,115,62,10,32,32,32,32,60,47,111,98,106,
-101,99,116,62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
-115,61,34,119,120,83,116,97,116,105,99,84,101,120,116,34,32,110,97,109,
-101,61,34,115,116,70,105,108,101,110,97,109,101,34,62,10,32,32,32,32,32,
-32,60,108,97,98,101,108,62,70,105,108,101,110,97,109,101,60,47,108,97,98,
-101,108,62,10,32,32,32,32,32,32,60,112,111,115,62,53,44,49,48,55,100,60,
-47,112,111,115,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,
-32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,84,101,
-120,116,67,116,114,108,34,32,110,97,109,101,61,34,116,120,116,70,105,108,
-101,110,97,109,101,34,62,10,32,32,32,32,32,32,60,112,111,115,62,49,48,48,
-44,49,48,53,100,60,47,112,111,115,62,10,32,32,32,32,32,32,60,115,105,122,
-101,62,49,51,48,44,45,49,100,60,47,115,105,122,101,62,10,32,32,32,32,60,
-47,111,98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,119,120,66,117,116,116,111,110,34,32,110,97,109,
-101,61,34,98,116,110,70,105,108,101,110,97,109,101,34,62,10,32,32,32,32,
-32,32,60,108,97,98,101,108,62,46,46,46,60,47,108,97,98,101,108,62,10,32,
-32,32,32,32,32,60,112,111,115,62,50,51,53,44,49,48,53,100,60,47,112,111,
-115,62,10,32,32,32,32,32,32,60,115,105,122,101,62,49,53,44,45,49,100,60,
+60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,67,104,101,
+99,107,66,111,120,34,32,110,97,109,101,61,34,99,104,107,67,111,109,112,
+114,101,115,115,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,47,62,10,
+32,32,32,32,32,32,60,112,111,115,62,49,48,48,44,57,56,100,60,47,112,111,
+115,62,10,32,32,32,32,32,32,60,115,105,122,101,62,49,50,44,49,50,100,60,
 47,115,105,122,101,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
 32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,
-66,117,116,116,111,110,34,32,110,97,109,101,61,34,119,120,73,68,95,72,69,
-76,80,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,38,97,109,112,
-59,72,101,108,112,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,112,
-111,115,62,50,44,49,50,53,100,60,47,112,111,115,62,10,32,32,32,32,32,32,
-60,115,116,121,108,101,47,62,10,32,32,32,32,60,47,111,98,106,101,99,116,
+83,116,97,116,105,99,66,111,120,34,32,110,97,109,101,61,34,115,98,69,110,
+99,111,100,105,110,103,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,
+62,69,110,99,111,100,105,110,103,60,47,108,97,98,101,108,62,10,32,32,32,
+32,32,32,60,112,111,115,62,49,51,48,44,53,100,60,47,112,111,115,62,10,32,
+32,32,32,32,32,60,115,105,122,101,62,49,50,48,44,51,56,100,60,47,115,105,
+122,101,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,
+60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,82,97,100,105,
+111,66,117,116,116,111,110,34,32,110,97,109,101,61,34,114,98,76,111,99,
+97,108,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,76,111,99,97,
+108,32,99,104,97,114,115,101,116,60,47,108,97,98,101,108,62,10,32,32,32,
+32,32,32,60,118,97,108,117,101,62,49,60,47,118,97,108,117,101,62,10,32,
+32,32,32,32,32,60,112,111,115,62,49,52,48,44,49,55,100,60,47,112,111,115,
+62,10,32,32,32,32,32,32,60,115,116,121,108,101,62,119,120,82,66,95,71,82,
+79,85,80,60,47,115,116,121,108,101,62,10,32,32,32,32,60,47,111,98,106,101,
+99,116,62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
+61,34,119,120,82,97,100,105,111,66,117,116,116,111,110,34,32,110,97,109,
+101,61,34,114,98,85,110,105,99,111,100,101,34,62,10,32,32,32,32,32,32,60,
+108,97,98,101,108,62,85,110,105,99,111,100,101,32,85,84,70,45,56,60,47,
+108,97,98,101,108,62,10,32,32,32,32,32,32,60,112,111,115,62,49,52,48,44,
+50,57,100,60,47,112,111,115,62,10,32,32,32,32,60,47,111,98,106,101,99,116,
 62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
-120,66,117,116,116,111,110,34,32,110,97,109,101,61,34,119,120,73,68,95,
-79,75,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,38,97,109,112,
-59,79,75,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,100,101,102,
-97,117,108,116,62,49,60,47,100,101,102,97,117,108,116,62,10,32,32,32,32,
-32,32,60,112,111,115,62,49,52,55,44,49,50,53,100,60,47,112,111,115,62,10,
-32,32,32,32,32,32,60,115,116,121,108,101,47,62,10,32,32,32,32,60,47,111,
+120,83,116,97,116,105,99,66,111,120,34,32,110,97,109,101,61,34,115,98,81,
+117,111,116,105,110,103,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,
+62,81,117,111,116,105,110,103,60,47,108,97,98,101,108,62,10,32,32,32,32,
+32,32,60,112,111,115,62,49,51,48,44,52,56,100,60,47,112,111,115,62,10,32,
+32,32,32,32,32,60,115,105,122,101,62,49,50,48,44,53,48,100,60,47,115,105,
+122,101,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,
+60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,82,97,100,105,
+111,66,117,116,116,111,110,34,32,110,97,109,101,61,34,114,98,81,117,111,
+116,101,78,111,110,101,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,
+62,110,111,32,113,117,111,116,105,110,103,60,47,108,97,98,101,108,62,10,
+32,32,32,32,32,32,60,112,111,115,62,49,52,48,44,54,48,100,60,47,112,111,
+115,62,10,32,32,32,32,32,32,60,115,116,121,108,101,62,119,120,82,66,95,
+71,82,79,85,80,60,47,115,116,121,108,101,62,10,32,32,32,32,60,47,111,98,
+106,101,99,116,62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,
+115,115,61,34,119,120,82,97,100,105,111,66,117,116,116,111,110,34,32,110,
+97,109,101,61,34,114,98,81,117,111,116,101,83,116,114,105,110,103,115,34,
+62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,111,110,108,121,32,115,
+116,114,105,110,103,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,
+60,118,97,108,117,101,62,49,60,47,118,97,108,117,101,62,10,32,32,32,32,
+32,32,60,112,111,115,62,49,52,48,44,55,50,100,60,47,112,111,115,62,10,32,
+32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,101,
+99,116,32,99,108,97,115,115,61,34,119,120,82,97,100,105,111,66,117,116,
+116,111,110,34,32,110,97,109,101,61,34,114,98,81,117,111,116,101,65,108,
+108,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,97,108,108,32,99,
+111,108,117,109,110,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,
+60,112,111,115,62,49,52,48,44,56,52,100,60,47,112,111,115,62,10,32,32,32,
+32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,83,116,97,116,105,99,84,101,120,116,
+34,32,110,97,109,101,61,34,115,116,70,105,108,101,110,97,109,101,34,62,
+10,32,32,32,32,32,32,60,108,97,98,101,108,62,70,105,108,101,110,97,109,
+101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,112,111,115,62,53,
+44,49,50,50,100,60,47,112,111,115,62,10,32,32,32,32,60,47,111,98,106,101,
+99,116,62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
+61,34,119,120,84,101,120,116,67,116,114,108,34,32,110,97,109,101,61,34,
+116,120,116,70,105,108,101,110,97,109,101,34,62,10,32,32,32,32,32,32,60,
+112,111,115,62,49,48,48,44,49,50,48,100,60,47,112,111,115,62,10,32,32,32,
+32,32,32,60,115,105,122,101,62,49,51,48,44,45,49,100,60,47,115,105,122,
+101,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,
+111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,66,117,116,116,
+111,110,34,32,110,97,109,101,61,34,98,116,110,70,105,108,101,110,97,109,
+101,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,46,46,46,60,47,108,
+97,98,101,108,62,10,32,32,32,32,32,32,60,112,111,115,62,50,51,53,44,49,
+50,48,100,60,47,112,111,115,62,10,32,32,32,32,32,32,60,115,105,122,101,
+62,49,53,44,45,49,100,60,47,115,105,122,101,62,10,32,32,32,32,60,47,111,
 98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
 97,115,115,61,34,119,120,66,117,116,116,111,110,34,32,110,97,109,101,61,
-34,119,120,73,68,95,67,65,78,67,69,76,34,62,10,32,32,32,32,32,32,60,108,
-97,98,101,108,62,38,97,109,112,59,67,97,110,99,101,108,60,47,108,97,98,
-101,108,62,10,32,32,32,32,32,32,60,100,101,102,97,117,108,116,62,48,60,
-47,100,101,102,97,117,108,116,62,10,32,32,32,32,32,32,60,112,111,115,62,
-50,48,48,44,49,50,53,100,60,47,112,111,115,62,10,32,32,32,32,60,47,111,
-98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,
-101,115,111,117,114,99,101,62,10};
+34,119,120,73,68,95,72,69,76,80,34,62,10,32,32,32,32,32,32,60,108,97,98,
+101,108,62,38,97,109,112,59,72,101,108,112,60,47,108,97,98,101,108,62,10,
+32,32,32,32,32,32,60,112,111,115,62,50,44,49,52,48,100,60,47,112,111,115,
+62,10,32,32,32,32,32,32,60,115,116,121,108,101,47,62,10,32,32,32,32,60,
+47,111,98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,101,99,116,32,
+99,108,97,115,115,61,34,119,120,66,117,116,116,111,110,34,32,110,97,109,
+101,61,34,119,120,73,68,95,79,75,34,62,10,32,32,32,32,32,32,60,108,97,98,
+101,108,62,38,97,109,112,59,79,75,60,47,108,97,98,101,108,62,10,32,32,32,
+32,32,32,60,100,101,102,97,117,108,116,62,49,60,47,100,101,102,97,117,108,
+116,62,10,32,32,32,32,32,32,60,112,111,115,62,49,52,55,44,49,52,48,100,
+60,47,112,111,115,62,10,32,32,32,32,32,32,60,115,116,121,108,101,47,62,
+10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,111,98,
+106,101,99,116,32,99,108,97,115,115,61,34,119,120,66,117,116,116,111,110,
+34,32,110,97,109,101,61,34,119,120,73,68,95,67,65,78,67,69,76,34,62,10,
+32,32,32,32,32,32,60,108,97,98,101,108,62,38,97,109,112,59,67,97,110,99,
+101,108,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,100,101,102,
+97,117,108,116,62,48,60,47,100,101,102,97,117,108,116,62,10,32,32,32,32,
+32,32,60,112,111,115,62,50,48,48,44,49,52,48,100,60,47,112,111,115,62,10,
+32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,
+99,116,62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_74 = 1443;
-static unsigned char xml_res_file_74[] = {
+static size_t xml_res_size_76 = 1443;
+static unsigned char xml_res_file_76[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -33748,8 +34189,8 @@ static unsigned char xml_res_file_74[] = {
 101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,
 115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_75 = 3111;
-static unsigned char xml_res_file_75[] = {
+static size_t xml_res_size_77 = 3111;
+static unsigned char xml_res_file_77[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -33895,8 +34336,8 @@ static unsigned char xml_res_file_75[] = {
 60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,
 10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_76 = 12040;
-static unsigned char xml_res_file_76[] = {
+static size_t xml_res_size_78 = 12040;
+static unsigned char xml_res_file_78[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -34448,8 +34889,8 @@ static unsigned char xml_res_file_76[] = {
 10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,
 101,99,116,62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_77 = 5019;
-static unsigned char xml_res_file_77[] = {
+static size_t xml_res_size_79 = 5019;
+static unsigned char xml_res_file_79[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -34681,8 +35122,8 @@ static unsigned char xml_res_file_77[] = {
 101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,10,60,47,114,101,
 115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_78 = 65793;
-static unsigned char xml_res_file_78[] = {
+static size_t xml_res_size_80 = 66663;
+static unsigned char xml_res_file_80[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -35486,6 +35927,46 @@ static unsigned char xml_res_file_78[] = {
 10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,
 106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,
 109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,67,104,
+101,99,107,66,111,120,34,32,110,97,109,101,61,34,99,104,107,80,114,101,
+112,97,114,101,67,97,116,97,108,111,103,81,117,101,114,105,101,115,34,62,
+10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,60,108,97,98,101,108,62,80,114,101,112,97,114,101,32,114,101,112,101,
+97,116,101,100,32,99,97,116,97,108,111,103,32,113,117,101,114,105,101,115,
+32,111,110,32,110,101,119,32,99,111,110,110,101,99,116,105,111,110,115,
+60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,60,99,104,101,99,107,101,100,62,48,60,47,
+99,104,101,99,107,101,100,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,
+62,119,120,69,88,80,65,78,68,124,119,120,84,79,80,124,119,120,76,69,70,
+84,124,119,120,82,73,71,72,84,60,47,102,108,97,103,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,100,101,
+114,62,52,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,
+99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,
+62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,67,104,101,
+99,107,66,111,120,34,32,110,97,109,101,61,34,99,104,107,66,105,110,97,114,
+121,67,97,116,97,108,111,103,82,101,115,117,108,116,115,34,62,10,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,
+97,98,101,108,62,70,101,116,99,104,32,99,97,116,97,108,111,103,32,113,117,
+101,114,121,32,114,101,115,117,108,116,115,32,105,110,32,98,105,110,97,
+114,121,32,111,110,32,110,101,119,32,99,111,110,110,101,99,116,105,111,
+110,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,60,99,104,101,99,107,101,100,62,
+48,60,47,99,104,101,99,107,101,100,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,102,108,
+97,103,62,119,120,69,88,80,65,78,68,124,119,120,84,79,80,124,119,120,76,
+69,70,84,124,119,120,82,73,71,72,84,60,47,102,108,97,103,62,10,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,
+100,101,114,62,52,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,
+10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,
+106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,
+109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
 32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,70,108,
 101,120,71,114,105,100,83,105,122,101,114,34,62,10,32,32,32,32,32,32,32,
 32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,99,111,108,115,62,
@@ -37666,8 +38147,8 @@ static unsigned char xml_res_file_78[] = {
 32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,
 62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_79 = 1417;
-static unsigned char xml_res_file_79[] = {
+static size_t xml_res_size_81 = 1417;
+static unsigned char xml_res_file_81[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -37736,8 +38217,8 @@ static unsigned char xml_res_file_79[] = {
 60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,116,62,
 10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_80 = 5273;
-static unsigned char xml_res_file_80[] = {
+static size_t xml_res_size_82 = 5273;
+static unsigned char xml_res_file_82[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -37992,8 +38473,8 @@ static unsigned char xml_res_file_80[] = {
 32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,
 99,116,62,10,60,47,114,101,115,111,117,114,99,101,62,10};
 
-static size_t xml_res_size_81 = 15609;
-static unsigned char xml_res_file_81[] = {
+static size_t xml_res_size_83 = 15609;
+static unsigned char xml_res_file_83[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,73,83,79,45,56,56,53,57,45,49,34,63,62,
 10,60,114,101,115,111,117,114,99,101,62,10,32,32,60,111,98,106,101,99,116,
@@ -38748,59 +39229,61 @@ void InitXmlResource()
     XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgIndex.xrc"), xml_res_file_26, xml_res_size_26, wxT("text/xml"));
     XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgJob.xrc"), xml_res_file_27, xml_res_size_27, wxT("text/xml"));
     XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgLanguage.xrc"), xml_res_file_28, xml_res_size_28, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgMainConfig.xrc"), xml_res_file_29, xml_res_size_29, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgManageFavourites.xrc"), xml_res_file_30, xml_res_size_30, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgManageMacros.xrc"), xml_res_file_31, xml_res_size_31, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgMoveTablespace.xrc"), xml_res_file_32, xml_res_size_32, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgOperator.xrc"), xml_res_file_33, xml_res_size_33, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgPackage.xrc"), xml_res_file_34, xml_res_size_34, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgPgpassConfig.xrc"), xml_res_file_35, xml_res_size_35, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgReassignDropOwned.xrc"), xml_res_file_36, xml_res_size_36, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepClusterUpgrade.xrc"), xml_res_file_37, xml_res_size_37, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepCluster.xrc"), xml_res_file_38, xml_res_size_38, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepListen.xrc"), xml_res_file_39, xml_res_size_39, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepNode.xrc"), xml_res_file_40, xml_res_size_40, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepPath.xrc"), xml_res_file_41, xml_res_size_41, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepSequence.xrc"), xml_res_file_42, xml_res_size_42, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepSetMerge.xrc"), xml_res_file_43, xml_res_size_43, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepSetMove.xrc"), xml_res_file_44, xml_res_size_44, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepSet.xrc"), xml_res_file_45, xml_res_size_45, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepSubscription.xrc"), xml_res_file_46, xml_res_size_46, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepTable.xrc"), xml_res_file_47, xml_res_size_47, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgResourceGroup.xrc"), xml_res_file_48, xml_res_size_48, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRole.xrc"), xml_res_file_49, xml_res_size_49, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRule.xrc"), xml_res_file_50, xml_res_size_50, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgSchedule.xrc"), xml_res_file_51, xml_res_size_51, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgSchema.xrc"), xml_res_file_52, xml_res_size_52, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgSearchObject.xrc"), xml_res_file_53, xml_res_size_53, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgSelectConnection.xrc"), xml_res_file_54, xml_res_size_54, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgSequence.xrc"), xml_res_file_55, xml_res_size_55, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgServer.xrc"), xml_res_file_56, xml_res_size_56, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgStep.xrc"), xml_res_file_57, xml_res_size_57, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgSynonym.xrc"), xml_res_file_58, xml_res_size_58, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgTablespace.xrc"), xml_res_file_59, xml_res_size_59, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgTable.xrc"), xml_res_file_60, xml_res_size_60, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgTextSearchConfiguration.xrc"), xml_res_file_61, xml_res_size_61, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgTextSearchDictionary.xrc"), xml_res_file_62, xml_res_size_62, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgTextSearchParser.xrc"), xml_res_file_63, xml_res_size_63, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgTextSearchTemplate.xrc"), xml_res_file_64, xml_res_size_64, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgTrigger.xrc"), xml_res_file_65, xml_res_size_65, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgType.xrc"), xml_res_file_66, xml_res_size_66, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgUserMapping.xrc"), xml_res_file_67, xml_res_size_67, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgUser.xrc"), xml_res_file_68, xml_res_size_68, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgView.xrc"), xml_res_file_69, xml_res_size_69, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmBackupGlobals.xrc"), xml_res_file_70, xml_res_size_70, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmBackupServer.xrc"), xml_res_file_71, xml_res_size_71, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmBackup.xrc"), xml_res_file_72, xml_res_size_72, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmExport.xrc"), xml_res_file_73, xml_res_size_73, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmGrantWizard.xrc"), xml_res_file_74, xml_res_size_74, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmHint.xrc"), xml_res_file_75, xml_res_size_75, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmImport.xrc"), xml_res_file_76, xml_res_size_76, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmMaintenance.xrc"), xml_res_file_77, xml_res_size_77, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmOptions.xrc"), xml_res_file_78, xml_res_size_78, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmPassword.xrc"), xml_res_file_79, xml_res_size_79, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmReport.xrc"), xml_res_file_80, xml_res_size_80, wxT("text/xml"));
-    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmRestore.xrc"), xml_res_file_81, xml_res_size_81, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgLoadTest.xrc"), xml_res_file_29, xml_res_size_29, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgMainConfig.xrc"), xml_res_file_30, xml_res_size_30, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgManageFavourites.xrc"), xml_res_file_31, xml_res_size_31, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgManageMacros.xrc"), xml_res_file_32, xml_res_size_32, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgMoveTablespace.xrc"), xml_res_file_33, xml_res_size_33, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgOperator.xrc"), xml_res_file_34, xml_res_size_34, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgPackage.xrc"), xml_res_file_35, xml_res_size_35, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgPgpassConfig.xrc"), xml_res_file_36, xml_res_size_36, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgQueryBenchmark.xrc"), xml_res_file_37, xml_res_size_37, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgReassignDropOwned.xrc"), xml_res_file_38, xml_res_size_38, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepClusterUpgrade.xrc"), xml_res_file_39, xml_res_size_39, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepCluster.xrc"), xml_res_file_40, xml_res_size_40, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepListen.xrc"), xml_res_file_41, xml_res_size_41, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepNode.xrc"), xml_res_file_42, xml_res_size_42, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepPath.xrc"), xml_res_file_43, xml_res_size_43, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepSequence.xrc"), xml_res_file_44, xml_res_size_44, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepSetMerge.xrc"), xml_res_file_45, xml_res_size_45, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepSetMove.xrc"), xml_res_file_46, xml_res_size_46, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepSet.xrc"), xml_res_file_47, xml_res_size_47, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepSubscription.xrc"), xml_res_file_48, xml_res_size_48, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepTable.xrc"), xml_res_file_49, xml_res_size_49, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgResourceGroup.xrc"), xml_res_file_50, xml_res_size_50, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRole.xrc"), xml_res_file_51, xml_res_size_51, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRule.xrc"), xml_res_file_52, xml_res_size_52, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgSchedule.xrc"), xml_res_file_53, xml_res_size_53, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgSchema.xrc"), xml_res_file_54, xml_res_size_54, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgSearchObject.xrc"), xml_res_file_55, xml_res_size_55, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgSelectConnection.xrc"), xml_res_file_56, xml_res_size_56, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgSequence.xrc"), xml_res_file_57, xml_res_size_57, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgServer.xrc"), xml_res_file_58, xml_res_size_58, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgStep.xrc"), xml_res_file_59, xml_res_size_59, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgSynonym.xrc"), xml_res_file_60, xml_res_size_60, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgTablespace.xrc"), xml_res_file_61, xml_res_size_61, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgTable.xrc"), xml_res_file_62, xml_res_size_62, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgTextSearchConfiguration.xrc"), xml_res_file_63, xml_res_size_63, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgTextSearchDictionary.xrc"), xml_res_file_64, xml_res_size_64, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgTextSearchParser.xrc"), xml_res_file_65, xml_res_size_65, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgTextSearchTemplate.xrc"), xml_res_file_66, xml_res_size_66, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgTrigger.xrc"), xml_res_file_67, xml_res_size_67, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgType.xrc"), xml_res_file_68, xml_res_size_68, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgUserMapping.xrc"), xml_res_file_69, xml_res_size_69, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgUser.xrc"), xml_res_file_70, xml_res_size_70, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgView.xrc"), xml_res_file_71, xml_res_size_71, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmBackupGlobals.xrc"), xml_res_file_72, xml_res_size_72, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmBackupServer.xrc"), xml_res_file_73, xml_res_size_73, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmBackup.xrc"), xml_res_file_74, xml_res_size_74, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmExport.xrc"), xml_res_file_75, xml_res_size_75, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmGrantWizard.xrc"), xml_res_file_76, xml_res_size_76, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmHint.xrc"), xml_res_file_77, xml_res_size_77, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmImport.xrc"), xml_res_file_78, xml_res_size_78, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmMaintenance.xrc"), xml_res_file_79, xml_res_size_79, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmOptions.xrc"), xml_res_file_80, xml_res_size_80, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmPassword.xrc"), xml_res_file_81, xml_res_size_81, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmReport.xrc"), xml_res_file_82, xml_res_size_82, wxT("text/xml"));
+    XRC_ADD_FILE(wxT("XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_frmRestore.xrc"), xml_res_file_83, xml_res_size_83, wxT("text/xml"));
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_ddPrecisionScaleDialog.xrc"));
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_ddTableNameDialog.xrc"));
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgAddFavourite.xrc"));
@@ -38830,6 +39313,7 @@ void InitXmlResource()
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgIndex.xrc"));
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgJob.xrc"));
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgLanguage.xrc"));
+    wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgLoadTest.xrc"));
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgMainConfig.xrc"));
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgManageFavourites.xrc"));
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgManageMacros.xrc"));
@@ -38837,6 +39321,7 @@ void InitXmlResource()
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgOperator.xrc"));
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgPackage.xrc"));
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgPgpassConfig.xrc"));
+    wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgQueryBenchmark.xrc"));
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgReassignDropOwned.xrc"));
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepClusterUpgrade.xrc"));
     wxXmlResource::Get()->Load(wxT("memory:XRC_resource/xrcDialogs.cpp.new$._pgadmin_ui_3.1_dlgRepCluster.xrc"));
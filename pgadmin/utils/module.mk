@@ -21,7 +21,10 @@ pgadmin3_SOURCES += \
 	utils/sysSettings.cpp \
 	utils/tabcomplete.c \
 	utils/utffile.cpp \
-	utils/macros.cpp
+	utils/macros.cpp \
+	utils/queryHistory.cpp \
+	utils/sqlLexer.cpp \
+	utils/sqlStatementIndex.cpp
 
 if BUILD_SSH_TUNNEL
 pgadmin3_SOURCES += \
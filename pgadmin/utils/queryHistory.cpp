@@ -0,0 +1,615 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// queryHistory.cpp - History of the queries executed in the Query Tool
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/file.h>
+#include <wx/ffile.h>
+#include <wx/filename.h>
+#include <wx/arrimpl.cpp>
+
+#include <libxml/parser.h>
+
+#include "utils/queryHistory.h"
+
+WX_DEFINE_OBJARRAY(queryHistoryEntryArray);
+
+//
+// libxml convenience macros
+//
+#define WXSTRING_FROM_XML(s) wxString((char *)s, wxConvUTF8)
+
+// The log starts with these, followed by the time it was written at, which
+// changes whenever it is rewritten
+#define QUERYHISTORY_MAGIC          "PGAHIST1"
+#define QUERYHISTORY_HEADER_SIZE    16
+
+// Every record is its length (of what follows the type) and type, then
+//   entry:  time (8), duration (4), rows (4), then the title, server,
+//           database and query, each as length (4) and UTF-8 text
+//   delete: the offset of the entry record dropped (8)
+// in little endian byte order
+#define QUERYHISTORY_RECORD_HEADER  5
+
+enum
+{
+	QUERYHISTORY_ENTRY = 1,
+	QUERYHISTORY_DELETE
+};
+
+// Sanity limit for the strings of the index
+#define QUERYHISTORY_MAX_STRING     65536
+
+
+static void PutUint32(wxMemoryBuffer &buf, wxUint32 value)
+{
+	unsigned char bytes[4];
+	bytes[0] = value & 0xff;
+	bytes[1] = (value >> 8) & 0xff;
+	bytes[2] = (value >> 16) & 0xff;
+	bytes[3] = (value >> 24) & 0xff;
+	buf.AppendData(bytes, 4);
+}
+
+
+static void PutInt64(wxMemoryBuffer &buf, wxLongLong value)
+{
+	PutUint32(buf, value.GetLo());
+	PutUint32(buf, (wxUint32)value.GetHi());
+}
+
+
+static void PutString(wxMemoryBuffer &buf, const wxString &str)
+{
+	wxCharBuffer text = str.mb_str(wxConvUTF8);
+	size_t len = text ? strlen(text) : 0;
+
+	PutUint32(buf, len);
+	if (len)
+		buf.AppendData((void *)(const char *)text, len);
+}
+
+
+static bool GetUint32(wxFFile &file, wxUint32 &value)
+{
+	unsigned char bytes[4];
+	if (file.Read(bytes, 4) != 4)
+		return false;
+
+	value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((wxUint32)bytes[3] << 24);
+	return true;
+}
+
+
+static bool GetInt64(wxFFile &file, wxLongLong &value)
+{
+	wxUint32 lo, hi;
+	if (!GetUint32(file, lo) || !GetUint32(file, hi))
+		return false;
+
+	value = wxLongLong((long)(wxInt32)hi, lo);
+	return true;
+}
+
+
+static bool GetString(wxFFile &file, wxString &str)
+{
+	wxUint32 len;
+	if (!GetUint32(file, len) || len > QUERYHISTORY_MAX_STRING)
+		return false;
+
+	wxCharBuffer text(len);
+	if (len && file.Read(text.data(), len) != len)
+		return false;
+	text.data()[len] = 0;
+
+	str = wxString(text, wxConvUTF8);
+	return true;
+}
+
+
+// The time the log was written at, or 0 if it can't be read
+static wxLongLong ReadStamp(const wxString &filename)
+{
+	wxFFile file;
+	char magic[8];
+	wxLongLong stamp = 0;
+
+	if (!wxFileExists(filename) || !file.Open(filename, wxT("rb")))
+		return 0;
+
+	if (file.Read(magic, 8) != 8 || memcmp(magic, QUERYHISTORY_MAGIC, 8) || !GetInt64(file, stamp))
+		return 0;
+
+	return stamp;
+}
+
+
+static bool WriteHeader(wxFFile &file, wxLongLong &stamp)
+{
+	wxMemoryBuffer buf;
+
+	stamp = wxGetLocalTimeMillis();
+	buf.AppendData((void *)QUERYHISTORY_MAGIC, 8);
+	PutInt64(buf, stamp);
+
+	return file.Write(buf.GetData(), buf.GetDataLen()) == buf.GetDataLen();
+}
+
+
+queryHistory::queryHistory(const wxString &_xmlFile, size_t _maxEntries)
+{
+	xmlFile = _xmlFile;
+	maxEntries = _maxEntries;
+
+	// Next to the XML file, which older versions may still use
+	wxFileName fn(xmlFile);
+	fn.SetExt(wxT("log"));
+	logFile = fn.GetFullPath();
+
+	logLength = -1;
+	logStamp = 0;
+	droppedLength = 0;
+	damaged = false;
+}
+
+
+wxString queryHistory::MakeTitle(const wxString &query)
+{
+	wxString title = query.Left(QUERYHISTORY_TITLE_LENGTH);
+	title.Replace(wxT("\r"), wxT(" "));
+	title.Replace(wxT("\n"), wxT(" "));
+	title.Replace(wxT("\t"), wxT(" "));
+	return title.Trim().Trim(false);
+}
+
+
+bool queryHistory::Load()
+{
+	if (!wxFileExists(logFile))
+	{
+		if (wxFileExists(xmlFile) && ImportXml())
+		{
+			ReadLog(true);
+			return true;
+		}
+
+		bool changed = logLength != 0;
+		entries.Empty();
+		searchTitles.Empty();
+		logLength = 0;
+		logStamp = 0;
+		droppedLength = 0;
+		return changed;
+	}
+
+	wxLongLong stamp = ReadStamp(logFile);
+	if (stamp != logStamp)
+	{
+		// Written anew, possibly by another window
+		ReadLog(true);
+		return true;
+	}
+
+	wxFile file(logFile);
+	if (file.IsOpened() && file.Length() != logLength)
+	{
+		// Appended to by another window; past a record cut short, the
+		// records can't be told apart but from the start
+		ReadLog(damaged);
+		return true;
+	}
+
+	return false;
+}
+
+
+// Read the log from the start, or the records appended since it was read
+bool queryHistory::ReadLog(bool all)
+{
+	wxFFile file;
+
+	if (all)
+	{
+		entries.Empty();
+		searchTitles.Empty();
+		logLength = 0;
+		logStamp = 0;
+		droppedLength = 0;
+	}
+
+	if (!file.Open(logFile, wxT("rb")))
+		return false;
+
+	wxFileOffset offset = logLength, end = file.Length();
+	if (all)
+	{
+		char magic[8];
+		if (file.Read(magic, 8) != 8 || memcmp(magic, QUERYHISTORY_MAGIC, 8) || !GetInt64(file, logStamp))
+		{
+			// Not a log we know of; it's started anew
+			logStamp = 0;
+			logLength = end;
+			damaged = true;
+			return false;
+		}
+		offset = QUERYHISTORY_HEADER_SIZE;
+	}
+
+	damaged = false;
+	while (offset + QUERYHISTORY_RECORD_HEADER <= end)
+	{
+		wxUint32 length;
+		unsigned char type;
+
+		if (!file.Seek(offset) || !GetUint32(file, length) || file.Read(&type, 1) != 1)
+			break;
+
+		// A record cut short, when pgAdmin didn't get to write all of it
+		if (offset + QUERYHISTORY_RECORD_HEADER + (wxFileOffset)length > end)
+			break;
+
+		if (type == QUERYHISTORY_ENTRY)
+		{
+			queryHistoryEntry entry;
+			if (ReadEntry(file, offset, length, entry))
+			{
+				entries.Add(entry);
+				searchTitles.Add(entry.title.Lower());
+			}
+			else
+				droppedLength += QUERYHISTORY_RECORD_HEADER + length;
+		}
+		else if (type == QUERYHISTORY_DELETE)
+		{
+			wxLongLong deleted;
+			if (GetInt64(file, deleted))
+			{
+				int n = FindEntry(deleted.GetValue());
+				if (n >= 0)
+				{
+					const queryHistoryEntry &entry = entries.Item(n);
+					droppedLength += entry.queryOffset + entry.queryLength - entry.offset;
+					entries.RemoveAt(n);
+					searchTitles.RemoveAt(n);
+				}
+			}
+			droppedLength += QUERYHISTORY_RECORD_HEADER + length;
+		}
+		else
+			droppedLength += QUERYHISTORY_RECORD_HEADER + length;
+
+		offset += QUERYHISTORY_RECORD_HEADER + length;
+	}
+
+	// Anything after the last complete record would spoil what's appended
+	if (offset != end)
+		damaged = true;
+
+	logLength = end;
+	Trim();
+
+	return true;
+}
+
+
+// The file is positioned after the header of the record; the query is
+// skipped
+bool queryHistory::ReadEntry(wxFFile &file, wxFileOffset offset, size_t length, queryHistoryEntry &entry)
+{
+	wxUint32 duration, rows, queryLength;
+
+	if (!GetInt64(file, entry.time) || !GetUint32(file, duration) || !GetUint32(file, rows) ||
+	        !GetString(file, entry.title) || !GetString(file, entry.server) ||
+	        !GetString(file, entry.database) || !GetUint32(file, queryLength))
+		return false;
+
+	entry.duration = (wxInt32)duration;
+	entry.rows = (wxInt32)rows;
+	entry.offset = offset;
+	entry.queryOffset = file.Tell();
+	entry.queryLength = queryLength;
+
+	return entry.queryOffset + (wxFileOffset)queryLength == offset + QUERYHISTORY_RECORD_HEADER + (wxFileOffset)length;
+}
+
+
+int queryHistory::FindEntry(wxFileOffset offset) const
+{
+	size_t n;
+	for (n = 0 ; n < entries.GetCount() ; n++)
+	{
+		if (entries.Item(n).offset == offset)
+			return n;
+	}
+	return -1;
+}
+
+
+// Entries beyond the maximum are left in the log until it's rewritten
+void queryHistory::Trim()
+{
+	while (entries.GetCount() > maxEntries)
+	{
+		const queryHistoryEntry &entry = entries.Item(0);
+		droppedLength += entry.queryOffset + entry.queryLength - entry.offset;
+		entries.RemoveAt(0);
+		searchTitles.RemoveAt(0);
+	}
+}
+
+
+wxString queryHistory::GetQuery(size_t n)
+{
+	const queryHistoryEntry &entry = entries.Item(n);
+	wxFFile file;
+
+	if (!file.Open(logFile, wxT("rb")) || !file.Seek(entry.queryOffset))
+		return wxEmptyString;
+
+	wxCharBuffer text(entry.queryLength);
+	if (entry.queryLength && file.Read(text.data(), entry.queryLength) != entry.queryLength)
+		return wxEmptyString;
+	text.data()[entry.queryLength] = 0;
+
+	return wxString(text, wxConvUTF8);
+}
+
+
+void queryHistory::Find(const wxString &text, bool prefix, wxArrayInt &found) const
+{
+	wxString search = text.Lower();
+	size_t n;
+
+	found.Empty();
+	for (n = searchTitles.GetCount() ; n-- > 0 ; )
+	{
+		if (prefix ? searchTitles.Item(n).StartsWith(search) : searchTitles.Item(n).Find(search) != wxNOT_FOUND)
+			found.Add(n);
+	}
+}
+
+
+int queryHistory::Find(const queryHistoryEntry &entry) const
+{
+	size_t n;
+	for (n = entries.GetCount() ; n-- > 0 ; )
+	{
+		if (entries.Item(n).time == entry.time && entries.Item(n).title == entry.title)
+			return n;
+	}
+	return -1;
+}
+
+
+void queryHistory::AddRecord(wxMemoryBuffer &buf, int type, const wxMemoryBuffer &payload)
+{
+	unsigned char typeByte = type;
+
+	PutUint32(buf, payload.GetDataLen());
+	buf.AppendData(&typeByte, 1);
+	buf.AppendData(payload.GetData(), payload.GetDataLen());
+}
+
+
+void queryHistory::AddEntryRecord(wxMemoryBuffer &buf, const queryHistoryEntry &entry, const wxString &query)
+{
+	wxMemoryBuffer payload;
+
+	PutInt64(payload, entry.time);
+	PutUint32(payload, (wxUint32)entry.duration);
+	PutUint32(payload, (wxUint32)entry.rows);
+	PutString(payload, entry.title);
+	PutString(payload, entry.server);
+	PutString(payload, entry.database);
+	PutString(payload, query);
+
+	AddRecord(buf, QUERYHISTORY_ENTRY, payload);
+}
+
+
+bool queryHistory::Add(const wxString &query, long duration, long rows, const wxString &server, const wxString &database)
+{
+	Load();
+
+	queryHistoryEntry entry;
+	entry.title = MakeTitle(query);
+	entry.time = wxGetLocalTimeMillis();
+	entry.duration = duration;
+	entry.rows = rows;
+	entry.server = server;
+	entry.database = database;
+
+	wxMemoryBuffer records;
+
+	// Drop earlier entries of the same query
+	wxArrayInt found;
+	size_t i;
+	Find(entry.title, true, found);
+	for (i = 0 ; i < found.GetCount() ; i++)
+	{
+		const queryHistoryEntry &old = entries.Item(found.Item(i));
+		if (old.title == entry.title && GetQuery(found.Item(i)) == query)
+		{
+			wxMemoryBuffer payload;
+			PutInt64(payload, old.offset);
+			AddRecord(records, QUERYHISTORY_DELETE, payload);
+		}
+	}
+
+	AddEntryRecord(records, entry, query);
+
+	if (!Append(records))
+		return false;
+
+	if (droppedLength > QUERYHISTORY_COMPACT_SIZE)
+		Compact();
+
+	return true;
+}
+
+
+bool queryHistory::Delete(size_t n)
+{
+	wxMemoryBuffer records, payload;
+
+	PutInt64(payload, entries.Item(n).offset);
+	AddRecord(records, QUERYHISTORY_DELETE, payload);
+
+	if (!Append(records))
+		return false;
+
+	if (droppedLength > QUERYHISTORY_COMPACT_SIZE)
+		Compact();
+
+	return true;
+}
+
+
+bool queryHistory::Clear()
+{
+	entries.Empty();
+	searchTitles.Empty();
+	return Compact();
+}
+
+
+// The records are written at once; the index is brought up to date by
+// reading them back
+bool queryHistory::Append(const wxMemoryBuffer &records)
+{
+	// Offsets taken from the index would be meaningless in a log written
+	// anew meanwhile
+	if (logStamp != ReadStamp(logFile) && wxFileExists(logFile))
+	{
+		Load();
+		return false;
+	}
+
+	if (damaged && !Compact())
+		return false;
+
+	wxFFile file;
+	bool create = !wxFileExists(logFile);
+	if (!file.Open(logFile, wxT("ab")))
+		return false;
+
+	wxLongLong stamp;
+	if (create && !WriteHeader(file, stamp))
+		return false;
+
+	bool ok = file.Write(records.GetData(), records.GetDataLen()) == records.GetDataLen();
+	file.Close();
+
+	Load();
+	return ok;
+}
+
+
+// Write the entries left into a new log, replacing the old one
+bool queryHistory::Compact()
+{
+	wxString tmpFile = logFile + wxT(".tmp");
+	wxLongLong stamp;
+	bool ok;
+
+	{
+		wxFFile in, out;
+
+		ok = out.Open(tmpFile, wxT("wb")) && WriteHeader(out, stamp);
+		if (ok && entries.GetCount())
+			ok = in.Open(logFile, wxT("rb"));
+
+		char buf[65536];
+		size_t n;
+		for (n = 0 ; ok && n < entries.GetCount() ; n++)
+		{
+			const queryHistoryEntry &entry = entries.Item(n);
+			wxFileOffset pos, end = entry.queryOffset + entry.queryLength;
+
+			ok = in.Seek(entry.offset);
+			for (pos = entry.offset ; ok && pos < end ; )
+			{
+				size_t len = wxMin((wxFileOffset)sizeof(buf), end - pos);
+				ok = in.Read(buf, len) == len && out.Write(buf, len) == len;
+				pos += len;
+			}
+		}
+
+		if (out.IsOpened() && !out.Close())
+			ok = false;
+	}
+
+	// Nothing half written is left behind
+	if (!ok || !wxRenameFile(tmpFile, logFile, true))
+	{
+		if (wxFileExists(tmpFile))
+			wxRemoveFile(tmpFile);
+		return false;
+	}
+
+	ReadLog(true);
+	return true;
+}
+
+
+// The history of older versions, in an XML file, becomes the first log
+bool queryHistory::ImportXml()
+{
+	xmlDocPtr doc;
+	xmlNodePtr cur;
+	xmlChar *key;
+
+	doc = xmlParseFile((const char *)xmlFile.mb_str(wxConvUTF8));
+	if (doc == NULL)
+		return false;
+
+	cur = xmlDocGetRootElement(doc);
+	if (cur == NULL || xmlStrcmp(cur->name, (const xmlChar *) "histoqueries"))
+	{
+		xmlFreeDoc(doc);
+		return false;
+	}
+
+	wxMemoryBuffer records;
+	queryHistoryEntry entry;
+	entry.time = 0;
+	entry.duration = -1;
+	entry.rows = -1;
+
+	for (cur = cur->xmlChildrenNode ; cur != NULL ; cur = cur->next)
+	{
+		if (xmlStrcmp(cur->name, (const xmlChar *)"histoquery"))
+			continue;
+
+		key = xmlNodeListGetString(doc, cur->xmlChildrenNode, 1);
+		if (key)
+		{
+			wxString query = WXSTRING_FROM_XML(key);
+			if (!query.IsEmpty())
+			{
+				entry.title = MakeTitle(query);
+				AddEntryRecord(records, entry, query);
+			}
+			xmlFree(key);
+		}
+	}
+	xmlFreeDoc(doc);
+
+	wxFFile file;
+	wxLongLong stamp;
+	if (!file.Open(logFile, wxT("wb")) || !WriteHeader(file, stamp))
+		return false;
+
+	return file.Write(records.GetData(), records.GetDataLen()) == records.GetDataLen();
+}
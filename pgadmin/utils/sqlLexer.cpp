@@ -0,0 +1,404 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// sqlLexer.cpp - Incremental splitting of SQL text into statements
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+
+#include <string.h>
+
+// App headers
+#include "utils/sqlLexer.h"
+
+
+sqlLexer::sqlLexer()
+{
+	Reset();
+}
+
+
+void sqlLexer::Reset()
+{
+	state = LEX_NORMAL;
+	commentDepth = 0;
+	tagLength = tagMatched = 0;
+	escaped = false;
+	StartStatement();
+}
+
+
+void sqlLexer::StartStatement()
+{
+	prev = 0;
+	parenDepth = beginDepth = 0;
+	content = pendingContent = meta = false;
+	ended = false;
+	scanned = 0;
+	contentStart = -1;
+	lastQuote = LEX_NORMAL;
+
+	wordLength = 0;
+	inWord = wordIsIdent = false;
+	firstWord[0] = 0;
+	memset(initials, 0, sizeof(initials));
+	wordCount = 0;
+}
+
+
+wxString sqlLexer::GetFirstWord() const
+{
+	return wxString(firstWord, wxConvUTF8);
+}
+
+
+// CREATE [OR REPLACE] FUNCTION or PROCEDURE
+bool sqlLexer::IsFunctionStatement() const
+{
+	return initials[0] == 'c' &&
+	       (initials[1] == 'f' || initials[1] == 'p' ||
+	        (initials[1] == 'o' && initials[2] == 'r' && (initials[3] == 'f' || initials[3] == 'p')));
+}
+
+
+void sqlLexer::EndWord()
+{
+	if (!inWord)
+		return;
+	inWord = false;
+
+	if (!wordIsIdent)
+		return;
+
+	if (wordLength <= SQLLEXER_WORD_LENGTH)
+	{
+		word[wordLength] = 0;
+
+		if (!wordCount)
+			strcpy(firstWord, word);
+
+		if (wordCount < (int)sizeof(initials) &&
+		        (!strcmp(word, "create") || !strcmp(word, "function") || !strcmp(word, "procedure") ||
+		         !strcmp(word, "or") || !strcmp(word, "replace")))
+			initials[wordCount] = word[0];
+	}
+	wordCount++;
+
+	// The semicolons of a BEGIN ATOMIC ... END body don't end the statement;
+	// CASE ... END may be nested in it
+	if (wordLength <= SQLLEXER_WORD_LENGTH && parenDepth == 0 && IsFunctionStatement())
+	{
+		if (!strcmp(word, "begin"))
+			beginDepth++;
+		else if (!strcmp(word, "case"))
+		{
+			if (beginDepth > 0)
+				beginDepth++;
+		}
+		else if (!strcmp(word, "end"))
+		{
+			if (beginDepth > 0)
+				beginDepth--;
+		}
+	}
+}
+
+
+size_t sqlLexer::Scan(const char *data, size_t len, bool &end)
+{
+	end = false;
+
+	size_t pos = 0;
+	while (pos < len)
+	{
+		unsigned char c = (unsigned char)data[pos];
+
+		if (ended)
+			StartStatement();
+
+		switch (state)
+		{
+			case LEX_NORMAL:
+			{
+				// Comments start with two bytes, the first of which may
+				// turn out to be an operator
+				if (c == '-' && prev == '-')
+				{
+					state = LEX_LINE_COMMENT;
+					pendingContent = false;
+					if (!content)
+						contentStart = -1;
+					prev = 0;
+					break;
+				}
+				if (c == '*' && prev == '/')
+				{
+					state = LEX_BLOCK_COMMENT;
+					commentDepth = 1;
+					pendingContent = false;
+					if (!content)
+						contentStart = -1;
+					prev = 0;
+					break;
+				}
+				if (pendingContent)
+				{
+					content = true;
+					pendingContent = false;
+				}
+
+				bool identChar = IsIdentChar(c);
+				bool extended = false;
+				if (inWord && !identChar)
+				{
+					// A string right after a lone E has backslash escapes
+					extended = (c == '\'' && wordLength == 1 && word[0] == 'e');
+					EndWord();
+				}
+				else if (!inWord && identChar && c != '$')
+				{
+					inWord = true;
+					wordIsIdent = IsIdentStart(c);
+					wordLength = 0;
+				}
+
+				if (inWord)
+				{
+					if (wordLength < SQLLEXER_WORD_LENGTH)
+						word[wordLength] = (char)((c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c);
+					if (wordLength <= SQLLEXER_WORD_LENGTH)
+						wordLength++;
+					content = true;
+					prev = c;
+					break;
+				}
+
+				switch (c)
+				{
+					case ' ':
+					case '\t':
+					case '\n':
+					case '\r':
+					case '\f':
+						break;
+
+					case '\'':
+						// A doubled quote reopens the string it closed
+						if (prev == '\'' && lastQuote != LEX_IDENTIFIER)
+							state = lastQuote;
+						else
+							state = extended ? LEX_EXTENDED_QUOTE : LEX_QUOTE;
+						escaped = false;
+						content = true;
+						break;
+
+					case '"':
+						state = LEX_IDENTIFIER;
+						content = true;
+						break;
+
+					case '$':
+						state = LEX_DOLLAR_TAG;
+						tag[0] = '$';
+						tagLength = 1;
+						content = true;
+						break;
+
+					case '(':
+						parenDepth++;
+						content = true;
+						break;
+
+					case ')':
+						if (parenDepth > 0)
+							parenDepth--;
+						content = true;
+						break;
+
+					case ';':
+						if (parenDepth == 0 && beginDepth == 0)
+						{
+							ended = true;
+							end = true;
+							scanned += pos + 1;
+							return pos + 1;
+						}
+						break;
+
+					case '\\':
+						if (!content)
+						{
+							state = LEX_META;
+							meta = true;
+						}
+						content = true;
+						break;
+
+					case '-':
+					case '/':
+						if (!content)
+							pendingContent = true;
+						break;
+
+					default:
+						content = true;
+						break;
+				}
+				prev = c;
+				break;
+			}
+
+			case LEX_QUOTE:
+			case LEX_IDENTIFIER:
+				if (c == (state == LEX_QUOTE ? '\'' : '"'))
+				{
+					lastQuote = state;
+					state = LEX_NORMAL;
+					prev = c;
+				}
+				break;
+
+			case LEX_EXTENDED_QUOTE:
+				if (escaped)
+					escaped = false;
+				else if (c == '\\')
+					escaped = true;
+				else if (c == '\'')
+				{
+					lastQuote = state;
+					state = LEX_NORMAL;
+					prev = c;
+				}
+				break;
+
+			case LEX_LINE_COMMENT:
+				if (c == '\n')
+				{
+					state = LEX_NORMAL;
+					prev = 0;
+				}
+				break;
+
+			case LEX_BLOCK_COMMENT:
+				if (prev == '/' && c == '*')
+				{
+					commentDepth++;
+					prev = 0;
+				}
+				else if (prev == '*' && c == '/')
+				{
+					prev = 0;
+					if (!--commentDepth)
+						state = LEX_NORMAL;
+				}
+				else
+					prev = c;
+				break;
+
+			case LEX_DOLLAR_TAG:
+				if (c == '$')
+				{
+					tag[tagLength++] = '$';
+					tagMatched = 0;
+					state = LEX_DOLLAR;
+				}
+				else if (IsIdentChar(c) && tagLength <= SQLLEXER_TAG_LENGTH && (tagLength > 1 || IsIdentStart(c)))
+					tag[tagLength++] = (char)c;
+				else
+				{
+					// Not a dollar quote, but a parameter such as $1, or
+					// just a dollar sign; the byte is scanned once more
+					state = LEX_NORMAL;
+					prev = '$';
+					continue;
+				}
+				break;
+
+			case LEX_DOLLAR:
+				if ((char)c == tag[tagMatched])
+				{
+					if (++tagMatched == tagLength)
+					{
+						state = LEX_NORMAL;
+						prev = 0;
+					}
+				}
+				else
+					tagMatched = (c == '$') ? 1 : 0;
+				break;
+
+			case LEX_META:
+				if (c == '\n')
+				{
+					state = LEX_NORMAL;
+					ended = true;
+					end = true;
+					scanned += pos + 1;
+					return pos + 1;
+				}
+				break;
+		}
+
+		if (contentStart < 0 && (content || pendingContent))
+			contentStart = scanned + pos;
+		pos++;
+	}
+
+	scanned += pos;
+	return pos;
+}
+
+
+wxArrayString sqlLexer::Split(const wxString &text, wxArrayInt *offsets)
+{
+	wxArrayString statements;
+
+	wxCharBuffer buf = text.mb_str(wxConvUTF8);
+	const char *data = buf;
+	if (!data)
+		return statements;
+
+	size_t len = strlen(data), start = 0, chars = 0;
+
+	sqlLexer lexer;
+	while (start < len)
+	{
+		bool end;
+		size_t used = lexer.Scan(data + start, len - start, end);
+
+		if (lexer.HasContent() && !lexer.IsMetaCommand())
+		{
+			// Without the semicolon
+			size_t length = (end && used) ? used - 1 : used;
+			wxString statement(data + start, wxConvUTF8, length);
+			if (offsets)
+			{
+				size_t lead = statement.Length() - statement.Strip(wxString::leading).Length();
+				offsets->Add((int)(chars + lead));
+			}
+			statements.Add(statement.Strip(wxString::both));
+		}
+
+		if (offsets)
+		{
+			// Characters, not counting the continuation bytes of UTF-8
+			for (size_t i = 0 ; i < used ; i++)
+			{
+				if ((data[start + i] & 0xC0) != 0x80)
+					chars++;
+			}
+		}
+
+		start += used;
+	}
+
+	return statements;
+}
@@ -0,0 +1,263 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2016, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// sqlStatementIndex.cpp - Statements of an editor, kept up to date as it is edited
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/stc/stc.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+// App headers
+#include "utils/sqlStatementIndex.h"
+
+
+// Adds the statement the lexer just scanned to a list
+static void AddStatement(sqlStatementInfo *&list, size_t &listCount, size_t &listAllocated,
+                         int start, const sqlLexer &lexer, bool terminated)
+{
+	if (listCount == listAllocated)
+	{
+		listAllocated = listAllocated ? listAllocated * 2 : 64;
+		list = (sqlStatementInfo *)realloc(list, listAllocated * sizeof(sqlStatementInfo));
+	}
+
+	sqlStatementInfo &info = list[listCount++];
+	info.start = start;
+	info.contentStart = lexer.HasContent() ? start + (int)lexer.GetContentStart() : -1;
+	info.terminated = terminated;
+	info.meta = lexer.IsMetaCommand();
+	info.unbalanced = lexer.GetParenDepth() > 0;
+
+	wxString word = lexer.GetFirstWord();
+	strncpy(info.firstWord, word.mb_str(wxConvUTF8), SQLLEXER_WORD_LENGTH);
+	info.firstWord[SQLLEXER_WORD_LENGTH] = 0;
+}
+
+
+static void Move(sqlStatementInfo &info, int offset)
+{
+	info.start += offset;
+	if (info.contentStart >= 0)
+		info.contentStart += offset;
+}
+
+
+sqlStatementIndex::sqlStatementIndex()
+{
+	items = NULL;
+	count = allocated = 0;
+	length = 0;
+
+	// Whatever the text is, it's yet to be lexed
+	dirty = true;
+	dirtyFrom = dirtyTo = 0;
+}
+
+
+sqlStatementIndex::~sqlStatementIndex()
+{
+	free(items);
+}
+
+
+void sqlStatementIndex::Changed(int pos, int len)
+{
+	size_t i;
+
+	if (len > 0)
+	{
+		// The statements after the insertion move
+		for (i = count ; i > 0 && items[i - 1].start > pos ; i--)
+			Move(items[i - 1], len);
+
+		if (dirty)
+		{
+			if (dirtyTo > pos)
+				dirtyTo += len;
+			if (dirtyFrom > pos)
+				dirtyFrom = pos;
+			if (dirtyTo < pos + len)
+				dirtyTo = pos + len;
+		}
+		else
+		{
+			dirtyFrom = pos;
+			dirtyTo = pos + len;
+		}
+	}
+	else if (len < 0)
+	{
+		int end = pos - len;
+
+		// The statements which started in the deleted text (or right after
+		// it, where one may still start) are lexed again, and those after it
+		// move
+		size_t first = count, last = count;
+		for (i = count ; i > 0 && items[i - 1].start > pos ; i--)
+		{
+			if (items[i - 1].start > end)
+			{
+				Move(items[i - 1], len);
+				last = i - 1;
+			}
+			first = i - 1;
+		}
+		if (first < last)
+		{
+			memmove(items + first, items + last, (count - last) * sizeof(sqlStatementInfo));
+			count -= last - first;
+		}
+
+		// The byte now after the deletion is in a statement changed by it
+		if (dirty)
+		{
+			if (dirtyTo >= end)
+				dirtyTo += len;
+			else if (dirtyTo > pos)
+				dirtyTo = pos;
+			if (dirtyTo <= pos)
+				dirtyTo = pos + 1;
+			if (dirtyFrom > pos)
+				dirtyFrom = pos;
+		}
+		else
+		{
+			dirtyFrom = pos;
+			dirtyTo = pos + 1;
+		}
+	}
+	else
+		return;
+
+	length += len;
+	dirty = true;
+}
+
+
+void sqlStatementIndex::Update(wxStyledTextCtrl *text)
+{
+	if (!dirty)
+		return;
+
+	length = text->GetLength();
+
+	// Lex from the start of the statement holding the first change, which
+	// the text before it can't have any bearing on
+	size_t first = 0;
+	int index = FindStatement(dirtyFrom);
+	if (index > 0)
+		first = index;
+	int pos = first < count ? items[first].start : 0;
+	int start = pos;
+
+	sqlStatementInfo *lexed = NULL;
+	size_t lexedCount = 0, lexedAllocated = 0;
+	size_t resume = count;
+	bool resumed = false;
+
+	sqlLexer lexer;
+	wxCharBuffer chunk;
+	int chunkStart = pos, chunkEnd = pos;
+
+	while (pos < length)
+	{
+		if (pos >= chunkEnd)
+		{
+			chunkStart = pos;
+			chunkEnd = wxMin(pos + SQLSTATEMENTINDEX_CHUNK, length);
+			chunk = text->GetTextRangeRaw(chunkStart, chunkEnd);
+		}
+
+		bool end;
+		const char *data = chunk;
+		pos += (int)lexer.Scan(data + pos - chunkStart, chunkEnd - pos, end);
+
+		if (end)
+		{
+			AddStatement(lexed, lexedCount, lexedAllocated, start, lexer, true);
+			start = pos;
+
+			// Past the changes, a statement ending where one ended before
+			// means the rest is as it was
+			if (pos >= dirtyTo)
+			{
+				int next = FindStart(pos, first + 1);
+				if (next >= 0)
+				{
+					resume = next;
+					resumed = true;
+					break;
+				}
+			}
+		}
+	}
+
+	if (!resumed && start < length)
+	{
+		lexer.Finish();
+		AddStatement(lexed, lexedCount, lexedAllocated, start, lexer, false);
+	}
+
+	// Replace the statements lexed again
+	size_t newCount = count - (resume - first) + lexedCount;
+	if (newCount > allocated)
+	{
+		allocated = wxMax(newCount, allocated * 2);
+		items = (sqlStatementInfo *)realloc(items, allocated * sizeof(sqlStatementInfo));
+	}
+	memmove(items + first + lexedCount, items + resume, (count - resume) * sizeof(sqlStatementInfo));
+	if (lexedCount)
+		memcpy(items + first, lexed, lexedCount * sizeof(sqlStatementInfo));
+	count = newCount;
+
+	free(lexed);
+	dirty = false;
+}
+
+
+int sqlStatementIndex::FindStatement(int pos) const
+{
+	if (!count)
+		return -1;
+
+	// The last statement starting at or before the position
+	size_t low = 0, high = count;
+	while (high - low > 1)
+	{
+		size_t mid = (low + high) / 2;
+		if (items[mid].start <= pos)
+			low = mid;
+		else
+			high = mid;
+	}
+	return (int)low;
+}
+
+
+int sqlStatementIndex::FindStart(int pos, size_t from) const
+{
+	size_t low = from, high = count;
+	while (low < high)
+	{
+		size_t mid = (low + high) / 2;
+		if (items[mid].start < pos)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	if (low < count && items[low].start == pos)
+		return (int)low;
+	return -1;
+}
@@ -26,6 +26,9 @@
  * Callbacks to the C++ world
  */
 char *pg_query_to_single_ordered_string(char *query, void *dbptr);
+int pg_complete_from_catalog(const char *text, const char *kinds, int systemNames, const char *addon, void *dbptr, char **result);
+int pg_complete_columns(const char *text, const char *relation, void *dbptr, char **result);
+int pg_complete_schemas(const char *text, void *dbptr, char **result);
 
 
 /*
@@ -227,6 +230,36 @@ static char *complete_from_const(const char *text, const char *string)
 	return strdup(string);
 }
 
+/*
+ * The kinds of names of the catalog cache a schema query asks for, using
+ * the relkinds of pg_class and the letters of pgCatalogCache.h, or NULL if
+ * it can only be answered by the server.
+ */
+static const char *schema_query_kinds(const SchemaQuery *squery)
+{
+	if (squery == &Query_for_list_of_aggregates)
+		return "A";
+	if (squery == &Query_for_list_of_datatypes)
+		return "TD";
+	if (squery == &Query_for_list_of_domains)
+		return "D";
+	if (squery == &Query_for_list_of_functions)
+		return "FA";
+	if (squery == &Query_for_list_of_indexes)
+		return "i";
+	if (squery == &Query_for_list_of_sequences)
+		return "S";
+	if (squery == &Query_for_list_of_tables)
+		return "r";
+	if (squery == &Query_for_list_of_tisv)
+		return "risv";
+	if (squery == &Query_for_list_of_tsv)
+		return "rSv";
+	if (squery == &Query_for_list_of_views)
+		return "v";
+	return NULL;
+}
+
 static char *_complete_from_query(const char *text, const char *query, const SchemaQuery *squery, const char *addon, void *dbptr)
 {
 	int string_length = strlen(text);
@@ -234,6 +267,27 @@ static char *_complete_from_query(const char *text, const char *query, const Sch
 	char *complete_query = NULL;
 	char *t;
 
+	/* Answer from the names cached by the SQL box if we can */
+	if (squery != NULL)
+	{
+		const char *kinds = schema_query_kinds(squery);
+		int systemNames = strcmp(squery->catname, "pg_catalog.pg_class c") != 0 ||
+		                  strncmp(text, "pg_", 3) == 0;
+
+		if (kinds && pg_complete_from_catalog(text, kinds, systemNames, addon, dbptr, &t))
+			return t;
+	}
+	else if (strcmp(query, Query_for_list_of_attributes) == 0)
+	{
+		if (addon && pg_complete_columns(text, addon, dbptr, &t))
+			return t;
+	}
+	else if (strcmp(query, Query_for_list_of_schemas) == 0)
+	{
+		if (pg_complete_schemas(text, dbptr, &t))
+			return t;
+	}
+
 	e_text = malloc(string_length*2+1);
 	PQescapeString(e_text, text, string_length);
 